@@ -79,6 +79,59 @@ MU_TEST(test_bit_lib_push) {
     mu_assert_mem_eq(expected_data_6, data, TEST_BIT_LIB_PUSH_DATA_SIZE);
 }
 
+MU_TEST(test_bit_lib_ring_push) {
+#define TEST_BIT_LIB_RING_PUSH_DATA_SIZE 5
+#define TEST_BIT_LIB_RING_PUSH_BITS      (TEST_BIT_LIB_RING_PUSH_DATA_SIZE * 8)
+    uint8_t data[TEST_BIT_LIB_RING_PUSH_DATA_SIZE] = {0};
+    uint8_t ring[BIT_LIB_RING_SIZE(TEST_BIT_LIB_RING_PUSH_BITS)] = {0};
+    uint8_t frame[TEST_BIT_LIB_RING_PUSH_DATA_SIZE] = {0};
+    size_t head = 0;
+
+    // ring must always read back the same as the shift register
+    for(uint32_t i = 0; i < TEST_BIT_LIB_RING_PUSH_BITS * 3 + 5; ++i) {
+        bool bit = ((i * 7) % 3) == 0 || (i % 11) == 0;
+        bit_lib_push_bit(data, TEST_BIT_LIB_RING_PUSH_DATA_SIZE, bit);
+        bit_lib_ring_push_bit(ring, TEST_BIT_LIB_RING_PUSH_BITS, &head, bit);
+        mu_assert_int_less_than(TEST_BIT_LIB_RING_PUSH_BITS, head);
+
+        mu_assert_int_eq(bit_lib_get_bits_32(data, 0, 32), bit_lib_get_bits_32(ring, head, 32));
+        mu_assert_int_eq(bit_lib_get_bits(data, 33, 7), bit_lib_get_bits(ring, head + 33, 7));
+
+        bit_lib_copy_bits(frame, 0, TEST_BIT_LIB_RING_PUSH_BITS, ring, head);
+        mu_assert_mem_eq(data, frame, TEST_BIT_LIB_RING_PUSH_DATA_SIZE);
+    }
+}
+
+MU_TEST(test_bit_lib_ring_copy_if) {
+    uint8_t storage[BIT_LIB_RING_SIZE(24)];
+    uint8_t frame[3] = {0};
+    BitLibRing ring;
+    bit_lib_ring_init(&ring, storage, 24);
+
+    // preamble 1011 at the start of the window and again 12 bits later
+    const uint8_t expected[3] = {0xB0, 0x0B, 0x66};
+    for(size_t i = 0; i < 24; ++i) {
+        mu_check(!bit_lib_ring_copy_if(&ring, frame, 4, 0b1011, 12));
+        bit_lib_ring_push(&ring, bit_lib_get_bit(expected, i));
+    }
+    mu_check(bit_lib_ring_copy_if(&ring, frame, 4, 0b1011, 12));
+    mu_assert_mem_eq(expected, frame, 3);
+
+    // a window without the repeated preamble matches only when it is checked once
+    const uint8_t single[3] = {0xB0, 0x00, 0x00};
+    memset(frame, 0, sizeof(frame));
+    for(size_t i = 0; i < 24; ++i) {
+        bit_lib_ring_push(&ring, bit_lib_get_bit(single, i));
+    }
+    mu_check(!bit_lib_ring_copy_if(&ring, frame, 4, 0b1011, 12));
+    mu_assert_mem_eq(((uint8_t[]){0x00, 0x00, 0x00}), frame, 3);
+    mu_check(bit_lib_ring_copy_if(&ring, frame, 4, 0b1011, 0));
+    mu_assert_mem_eq(single, frame, 3);
+
+    bit_lib_ring_copy(&ring, frame);
+    mu_assert_mem_eq(single, frame, 3);
+}
+
 MU_TEST(test_bit_lib_set_bit) {
     uint8_t value[2] = {0x00, 0xFF};
     bit_lib_set_bit(value, 15, false);
@@ -521,6 +574,13 @@ MU_TEST(test_bit_lib_copy_bits) {
     // data_1_o[4..11] = data_1_i[0..7]
     bit_lib_copy_bits(data_1_o, 4, 8, data_1_i, 0);
     mu_assert_mem_eq(((uint8_t[]){0b00001100, 0b10100000}), data_1_o, 2);
+
+    uint8_t data_2_i[5] = {0x12, 0x34, 0x56, 0x78, 0x9A};
+    uint8_t data_2_o[5] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    // data_2_o[3..30] = data_2_i[5..32], surrounding bits untouched
+    bit_lib_copy_bits(data_2_o, 3, 28, data_2_i, 5);
+    mu_assert_mem_eq(((uint8_t[]){0xE8, 0xD1, 0x59, 0xE3, 0xFF}), data_2_o, 5);
 }
 
 MU_TEST(test_bit_lib_get_bit_count) {
@@ -712,6 +772,8 @@ MU_TEST_SUITE(test_bit_lib) {
     MU_RUN_TEST(test_bit_lib_increment_index);
     MU_RUN_TEST(test_bit_lib_is_set);
     MU_RUN_TEST(test_bit_lib_push);
+    MU_RUN_TEST(test_bit_lib_ring_push);
+    MU_RUN_TEST(test_bit_lib_ring_copy_if);
     MU_RUN_TEST(test_bit_lib_set_bit);
     MU_RUN_TEST(test_bit_lib_set_bits);
     MU_RUN_TEST(test_bit_lib_get_bit);
@@ -292,6 +292,16 @@ MU_TEST(flipper_format_string_test) {
     stream_write_cstring(stream, test_data_win);
     MU_RUN_TEST_1(flipper_format_read_and_update_test, flipper_format);
 
+    // Same reads and updates through key index, stale index must never be used
+    flipper_format_set_key_index(flipper_format, true);
+    stream_clean(stream);
+    stream_write_cstring(stream, test_data_nix);
+    MU_RUN_TEST_1(flipper_format_read_and_update_test, flipper_format);
+
+    stream_clean(stream);
+    stream_write_cstring(stream, test_data_win);
+    MU_RUN_TEST_1(flipper_format_read_and_update_test, flipper_format);
+
     flipper_format_free(flipper_format);
 }
 
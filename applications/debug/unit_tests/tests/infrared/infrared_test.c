@@ -523,6 +523,163 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolPioneer, 1);
 }
 
+/* Encode frames the way a RAW capture holds them: from the first mark to the last one */
+static size_t infrared_test_encode_raw(
+    const InfraredMessage* message,
+    size_t frame_count,
+    uint32_t* timings,
+    size_t timings_size) {
+    size_t timings_count = 0;
+    bool level = false;
+
+    infrared_reset_encoder(test->encoder_handler, message);
+
+    for(size_t i = 0; i < frame_count;) {
+        uint32_t duration;
+        bool level_read;
+        if(infrared_encode(test->encoder_handler, &duration, &level_read) == InfraredStatusDone) {
+            ++i;
+        }
+
+        if(!timings_count && !level_read) {
+            continue;
+        } else if(timings_count && (level_read == level)) {
+            timings[timings_count - 1] += duration;
+        } else {
+            furi_check(timings_count < timings_size);
+            timings[timings_count++] = duration;
+        }
+        level = level_read;
+    }
+
+    return level ? timings_count : timings_count - 1;
+}
+
+MU_TEST(infrared_test_raw_to_message) {
+    const InfraredMessage messages[] = {
+        {.protocol = InfraredProtocolNEC, .address = 0x04, .command = 0x08},
+        {.protocol = InfraredProtocolRC5, .address = 0x01, .command = 0x0C},
+        {.protocol = InfraredProtocolSIRC, .address = 0x01, .command = 0x15},
+        {.protocol = InfraredProtocolSamsung32, .address = 0x07, .command = 0x02},
+    };
+    const size_t timings_size = 512;
+    uint32_t* timings = malloc(sizeof(uint32_t) * timings_size);
+
+    for(size_t i = 0; i < COUNT_OF(messages); ++i) {
+        InfraredMessage message;
+        const size_t timings_count =
+            infrared_test_encode_raw(&messages[i], 3, timings, timings_size);
+
+        mu_assert(
+            infrared_raw_to_message(
+                test->decoder_handler,
+                test->encoder_handler,
+                INFRARED_COMMON_CARRIER_FREQUENCY,
+                timings,
+                timings_count,
+                &message),
+            "RAW signal that decodes cleanly was not converted");
+        infrared_test_compare_message_results(&message, &messages[i]);
+    }
+
+    free(timings);
+}
+
+MU_TEST(infrared_test_raw_to_message_mixed) {
+    const InfraredMessage nec = {
+        .protocol = InfraredProtocolNEC,
+        .address = 0x04,
+        .command = 0x08,
+    };
+    const InfraredMessage sirc = {
+        .protocol = InfraredProtocolSIRC,
+        .address = 0x01,
+        .command = 0x15,
+    };
+    const uint32_t unknown_frame[] = {3000, 1000, 3000, 1000, 3000};
+    const size_t timings_size = 512;
+    uint32_t* timings = malloc(sizeof(uint32_t) * timings_size);
+    InfraredMessage message;
+
+    // NEC frame followed by a frame no decoder knows
+    size_t timings_count = infrared_test_encode_raw(&nec, 1, timings, timings_size);
+    timings[timings_count++] = 40000;
+    memcpy(&timings[timings_count], unknown_frame, sizeof(unknown_frame));
+    timings_count += COUNT_OF(unknown_frame);
+    mu_assert(
+        !infrared_raw_to_message(
+            test->decoder_handler,
+            test->encoder_handler,
+            INFRARED_COMMON_CARRIER_FREQUENCY,
+            timings,
+            timings_count,
+            &message),
+        "RAW signal with an undecoded frame was converted");
+
+    // SIRC frames followed by the first half of another one
+    const size_t frame_count = infrared_test_encode_raw(&sirc, 1, timings, timings_size);
+    timings_count = infrared_test_encode_raw(&sirc, 3, timings, timings_size);
+    timings_count -= frame_count / 2;
+    mu_assert(
+        !infrared_raw_to_message(
+            test->decoder_handler,
+            test->encoder_handler,
+            INFRARED_COMMON_CARRIER_FREQUENCY,
+            timings,
+            timings_count,
+            &message),
+        "RAW signal with a partial frame was converted");
+
+    free(timings);
+}
+
+MU_TEST(infrared_test_raw_is_similar) {
+    const InfraredMessage nec = {
+        .protocol = InfraredProtocolNEC,
+        .address = 0x04,
+        .command = 0x08,
+    };
+    const InfraredMessage other = {
+        .protocol = InfraredProtocolNEC,
+        .address = 0x04,
+        .command = 0x09,
+    };
+    const size_t timings_size = 256;
+    uint32_t* timings = malloc(sizeof(uint32_t) * timings_size);
+    uint32_t* jittered = malloc(sizeof(uint32_t) * timings_size);
+    InfraredMessage message;
+
+    const size_t timings_count = infrared_test_encode_raw(&nec, 2, timings, timings_size);
+    // A few tens of microseconds either way, enough to cross any fixed rounding grid
+    for(size_t i = 0; i < timings_count; ++i) {
+        jittered[i] = (i % 2) ? timings[i] + 60 : timings[i] - 60;
+    }
+
+    mu_assert(
+        infrared_raw_is_similar(
+            INFRARED_COMMON_CARRIER_FREQUENCY, timings, jittered, timings_count),
+        "jittered copy of a RAW signal is not similar");
+    mu_assert(
+        infrared_raw_to_message(
+            test->decoder_handler,
+            test->encoder_handler,
+            INFRARED_COMMON_CARRIER_FREQUENCY,
+            jittered,
+            timings_count,
+            &message),
+        "jittered RAW signal was not converted");
+    infrared_test_compare_message_results(&message, &nec);
+
+    mu_check(infrared_test_encode_raw(&other, 2, jittered, timings_size) == timings_count);
+    mu_assert(
+        !infrared_raw_is_similar(
+            INFRARED_COMMON_CARRIER_FREQUENCY, timings, jittered, timings_count),
+        "different RAW signals are similar");
+
+    free(jittered);
+    free(timings);
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -543,6 +700,9 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_pioneer);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_raw_to_message);
+    MU_RUN_TEST(infrared_test_raw_to_message_mixed);
+    MU_RUN_TEST(infrared_test_raw_is_similar);
 }
 
 int run_minunit_test_infrared(void) {
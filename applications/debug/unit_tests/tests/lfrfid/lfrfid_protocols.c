@@ -3,9 +3,19 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
+#include <lfrfid/lfrfid_read_decoder.h>
+#include <lfrfid/lfrfid_raw_file.h>
+#include <lfrfid/tools/varint_pair.h>
+#include <storage/storage.h>
 
 #define LF_RFID_READ_TIMING_MULTIPLIER 8
 
+#define LF_RFID_READ_RAW_TEST_PATH        EXT_PATH("unit_tests/lfrfid_read_test.raw")
+#define LF_RFID_READ_RAW_BUFFER_SIZE      64
+#define LF_RFID_PSK_READ_US_PER_BIT       255
+#define LF_RFID_PSK_READ_PULSES_PER_BIT   16
+#define LF_RFID_PSK_READ_EMULATION_PULSES (INDALA26_EMULATION_TIMINGS_COUNT * 8)
+
 #define EM_TEST_DATA                    {0x58, 0x00, 0x85, 0x64, 0x02}
 #define EM_TEST_DATA_SIZE               5
 #define EM_TEST_EMULATION_TIMINGS_COUNT (64 * 2)
@@ -526,6 +536,130 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+static void lfrfid_read_test_pair_write(
+    LFRFIDRawFile* file,
+    VarintPair* pair,
+    uint32_t pulse,
+    uint32_t duration) {
+    varint_pair_pack(pair, true, pulse);
+    if(varint_pair_pack(pair, false, duration)) {
+        mu_check(lfrfid_raw_file_write_buffer(
+            file, varint_pair_get_data(pair), varint_pair_get_size(pair)));
+        varint_pair_reset(pair);
+    }
+}
+
+// one capture with EM4100 frames followed by demodulated Indala26 phase runs
+static void lfrfid_read_test_capture_write(ProtocolDict* dict, const char* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    VarintPair* pair = varint_pair_alloc();
+
+    mu_check(lfrfid_raw_file_open_write(file, path));
+    mu_check(lfrfid_raw_file_write_header(file, 125000, 0.5, LF_RFID_READ_RAW_BUFFER_SIZE));
+
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    for(size_t i = 0; i < EM_TEST_EMULATION_TIMINGS_COUNT * 20; i++) {
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            em_test_timings[i % EM_TEST_EMULATION_TIMINGS_COUNT] >= 0,
+            abs(em_test_timings[i % EM_TEST_EMULATION_TIMINGS_COUNT]) *
+                LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+            lfrfid_read_test_pair_write(file, pair, period, length);
+        }
+    }
+    pulse_glue_free(pulse_glue);
+
+    const uint8_t data[INDALA26_TEST_DATA_SIZE] = INDALA26_TEST_DATA;
+    protocol_dict_set_data(dict, LFRFIDProtocolIndala26, data, INDALA26_TEST_DATA_SIZE);
+    mu_check(protocol_dict_encoder_start(dict, LFRFIDProtocolIndala26));
+
+    // every phase run of the encoder is one level of the demodulated capture
+    bool level = true;
+    uint32_t run = 0;
+    uint32_t pulse = 0;
+    for(size_t i = 0; i < LF_RFID_PSK_READ_EMULATION_PULSES; i++) {
+        LevelDuration level_duration = protocol_dict_encoder_yield(dict, LFRFIDProtocolIndala26);
+        protocol_dict_encoder_yield(dict, LFRFIDProtocolIndala26);
+
+        if(run > 0 && level_duration_get_level(level_duration) != level) {
+            uint32_t time = run * LF_RFID_PSK_READ_US_PER_BIT / LF_RFID_PSK_READ_PULSES_PER_BIT;
+            if(level) {
+                pulse = time;
+            } else if(pulse > 0) {
+                lfrfid_read_test_pair_write(file, pair, pulse, pulse + time);
+            }
+            run = 0;
+        }
+
+        level = level_duration_get_level(level_duration);
+        run++;
+    }
+
+    varint_pair_free(pair);
+    lfrfid_raw_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(test_lfrfid_read_decoder_mixed_capture) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    lfrfid_read_test_capture_write(dict, LF_RFID_READ_RAW_TEST_PATH);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    mu_check(lfrfid_raw_file_open_read(file, LF_RFID_READ_RAW_TEST_PATH));
+
+    float frequency, duty_cycle;
+    mu_check(lfrfid_raw_file_read_header(file, &frequency, &duty_cycle));
+
+    LFRFIDReadDecoder* decoder = lfrfid_read_decoder_alloc(dict);
+    lfrfid_read_decoder_start(decoder, LFRFIDFeatureASK | LFRFIDFeaturePSK);
+
+    // both modulations have to validate from a single pass over the capture
+    bool valid[LFRFIDProtocolMax] = {0};
+    uint8_t em_received_data[EM_TEST_DATA_SIZE] = {0};
+    uint8_t indala_received_data[INDALA26_TEST_DATA_SIZE] = {0};
+    bool pass_end = false;
+    while(!pass_end) {
+        uint32_t duration, pulse;
+        mu_check(lfrfid_raw_file_read_pair(file, &duration, &pulse, &pass_end));
+
+        ProtocolId protocol = PROTOCOL_NO;
+        if(lfrfid_read_decoder_feed(decoder, pulse, duration, &protocol) !=
+           LFRFIDReadDecoderResultValid) {
+            continue;
+        }
+
+        if(protocol == LFRFIDProtocolEM4100) {
+            protocol_dict_get_data(dict, protocol, em_received_data, EM_TEST_DATA_SIZE);
+        } else if(protocol == LFRFIDProtocolIndala26) {
+            protocol_dict_get_data(dict, protocol, indala_received_data, INDALA26_TEST_DATA_SIZE);
+        }
+        valid[protocol] = true;
+    }
+
+    lfrfid_read_decoder_stop(decoder);
+    lfrfid_read_decoder_free(decoder);
+    lfrfid_raw_file_free(file);
+    storage_simply_remove(storage, LF_RFID_READ_RAW_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_check(valid[LFRFIDProtocolEM4100]);
+    mu_check(valid[LFRFIDProtocolIndala26]);
+
+    const uint8_t em_data[EM_TEST_DATA_SIZE] = EM_TEST_DATA;
+    mu_assert_mem_eq(em_data, em_received_data, EM_TEST_DATA_SIZE);
+
+    const uint8_t indala_data[INDALA26_TEST_DATA_SIZE] = INDALA26_TEST_DATA;
+    mu_assert_mem_eq(indala_data, indala_received_data, INDALA26_TEST_DATA_SIZE);
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
@@ -540,6 +674,8 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_read_decoder_mixed_capture);
 }
 
 int run_minunit_test_lfrfid_protocols(void) {
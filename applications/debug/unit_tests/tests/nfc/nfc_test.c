@@ -652,6 +652,88 @@ MU_TEST(mf_classic_dict_test) {
         "Remove test dict failed");
 }
 
+MU_TEST(mf_classic_dict_in_memory_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    if(storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NULL) == FSE_OK) {
+        mu_assert(
+            storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+            "Remove test dict failed");
+    }
+
+    // File with every key twice
+    const uint32_t test_key_num = 30;
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    for(size_t i = 0; i < test_key_num * 2; i++) {
+        if(i < test_key_num) {
+            furi_hal_random_fill_buf(key_arr_ref[i].data, sizeof(MfClassicKey));
+        }
+        mu_assert(
+            keys_dict_add_key(dict, key_arr_ref[i % test_key_num].data, sizeof(MfClassicKey)),
+            "add key failed");
+    }
+    keys_dict_free(dict);
+
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH,
+        KeysDictModeOpenExisting | KeysDictModeInMemory,
+        sizeof(MfClassicKey));
+    mu_assert_int_eq(test_key_num, keys_dict_get_total_keys(dict));
+
+    MfClassicKey key_dut = {};
+    MfClassicKey key_prev = {};
+    size_t key_idx = 0;
+    while(keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey))) {
+        mu_assert(
+            key_idx == 0 || memcmp(key_prev.data, key_dut.data, sizeof(MfClassicKey)) < 0,
+            "Keys are not sorted");
+        key_prev = key_dut;
+        key_idx++;
+    }
+    mu_assert_int_eq(test_key_num, key_idx);
+
+    uint32_t delete_keys_idx[] = {1, 3, 9, 11, 19, 27};
+    for(size_t i = 0; i < COUNT_OF(delete_keys_idx); i++) {
+        MfClassicKey* key = &key_arr_ref[delete_keys_idx[i]];
+        mu_assert(
+            keys_dict_delete_key(dict, key->data, sizeof(MfClassicKey)),
+            "keys_dict_delete_key() failed");
+        mu_assert(
+            !keys_dict_is_key_present(dict, key->data, sizeof(MfClassicKey)),
+            "Deleted key is present");
+    }
+    // Added back once, must not duplicate
+    for(size_t i = 0; i < 2; i++) {
+        mu_assert(
+            keys_dict_add_key(dict, key_arr_ref[3].data, sizeof(MfClassicKey)), "add key failed");
+    }
+    const size_t keys_left = test_key_num - COUNT_OF(delete_keys_idx) + 1;
+    mu_assert_int_eq(keys_left, keys_dict_get_total_keys(dict));
+    keys_dict_free(dict);
+
+    // Changes are written back, file mode sees the same keys
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert_int_eq(keys_left, keys_dict_get_total_keys(dict));
+    for(size_t i = 0; i < test_key_num; i++) {
+        bool deleted = false;
+        for(size_t j = 0; j < COUNT_OF(delete_keys_idx); j++) {
+            deleted |= (delete_keys_idx[j] == i) && (i != 3);
+        }
+        mu_assert(
+            keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)) != deleted,
+            "Written back key mismatch");
+    }
+    keys_dict_free(dict);
+    free(key_arr_ref);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    furi_record_close(RECORD_STORAGE);
+}
+
 static FelicaError
     felica_do_request_response(FelicaData* felica_data, const FelicaCardKey* card_key) {
     NfcDeviceData* nfc_device = nfc_device_alloc();
@@ -864,6 +946,7 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_in_memory_test);
     MU_RUN_TEST(felica_read);
     MU_RUN_TEST(felica_read_auth);
 
@@ -517,12 +517,63 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+MU_TEST_1(stream_peek_subtest, Stream* stream) {
+    FuriString* input_data = furi_string_alloc();
+    FuriString* output_data = furi_string_alloc();
+
+    // more than one buffered stream cache
+    for(size_t i = 0; i < 16; ++i) {
+        furi_string_cat_printf(input_data, "%s\n", stream_test_data);
+    }
+    mu_assert_int_eq(furi_string_size(input_data), stream_write_string(stream, input_data));
+    mu_check(stream_rewind(stream));
+
+    const uint8_t* data;
+    size_t size;
+    while((size = stream_peek(stream, &data)) != 0) {
+        // peek must not move RW pointer
+        mu_assert_int_eq(furi_string_size(output_data), stream_tell(stream));
+        for(size_t i = 0; i < size; i++) {
+            furi_string_push_back(output_data, data[i]);
+        }
+        mu_check(stream_seek(stream, size, StreamOffsetFromCurrent));
+    }
+
+    mu_check(stream_eof(stream));
+    mu_check(furi_string_equal(input_data, output_data));
+
+    furi_string_free(input_data);
+    furi_string_free(output_data);
+}
+
+MU_TEST(stream_peek_test) {
+    Stream* stream = string_stream_alloc();
+    MU_RUN_TEST_1(stream_peek_subtest, stream);
+    stream_free(stream);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(
+        buffered_file_stream_open(stream, FILESTREAM_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_peek_subtest, stream);
+    stream_free(stream);
+
+    // no buffer, nothing to peek
+    const uint8_t* data;
+    stream = file_stream_alloc(storage);
+    mu_check(file_stream_open(stream, FILESTREAM_PATH, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(0, stream_peek(stream, &data));
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_peek_test);
 }
 
 int run_minunit_test_stream(void) {
@@ -5,7 +5,9 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_binary.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
@@ -18,7 +20,12 @@
 #define ALUTECH_AT_4N_DIR_NAME  EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME    EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
+#define TEST_KEYSTORE_FILE_NAME EXT_PATH(".tmp/unit_tests/subghz_keystore")
+#define TEST_RAW_BINARY_NAME    EXT_PATH(".tmp/unit_tests/subghz_raw_binary.sub")
 #define TEST_TIMEOUT            10000
+#define TEST_BATCH_SIZE         64
+#define TEST_RECEIVER_BATCH     512
+#define TEST_DECODE_LOG_SIZE    64
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
@@ -26,6 +33,16 @@ static SubGhzReceiver* receiver_handler;
 static SubGhzFileEncoderWorker* file_worker_encoder_handler;
 static uint16_t subghz_test_decoder_count = 0;
 
+typedef struct {
+    const char* protocol_name;
+    uint32_t hash;
+} SubGhzTestDecode;
+
+typedef struct {
+    SubGhzTestDecode items[TEST_DECODE_LOG_SIZE];
+    size_t count;
+} SubGhzTestDecodeLog;
+
 static void subghz_test_rx_callback(
     SubGhzReceiver* receiver,
     SubGhzProtocolDecoderBase* decoder_base,
@@ -41,6 +58,20 @@ static void subghz_test_rx_callback(
     subghz_test_decoder_count++;
 }
 
+static void subghz_test_rx_log_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    SubGhzTestDecodeLog* log = context;
+    if(log->count < TEST_DECODE_LOG_SIZE) {
+        log->items[log->count].protocol_name = decoder_base->protocol->name;
+        log->items[log->count].hash =
+            subghz_protocol_decoder_base_get_hash_data_long(decoder_base);
+    }
+    log->count++;
+    subghz_receiver_reset(receiver);
+}
+
 static void subghz_test_init(void) {
     environment_handler = subghz_environment_alloc();
     subghz_environment_set_nice_flor_s_rainbow_table_file_name(
@@ -106,6 +137,98 @@ static bool subghz_decoder_test(const char* path, const char* name_decoder) {
     }
 }
 
+static uint16_t subghz_decoder_batch_test(const char* path, const char* name_decoder) {
+    subghz_test_decoder_count = 0;
+    uint32_t test_start = furi_get_tick();
+
+    SubGhzProtocolDecoderBase* decoder =
+        subghz_receiver_search_decoder_base_by_name(receiver_handler, name_decoder);
+
+    if(decoder) {
+        LevelDuration* block = malloc(sizeof(LevelDuration) * TEST_BATCH_SIZE);
+        size_t block_count = 0;
+
+        file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
+        if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path, NULL)) {
+            // the worker needs a file in order to open and read part of the file
+            furi_delay_ms(100);
+
+            LevelDuration level_duration;
+            while(furi_get_tick() - test_start < TEST_TIMEOUT) {
+                level_duration =
+                    subghz_file_encoder_worker_get_level_duration(file_worker_encoder_handler);
+                bool is_end = level_duration_is_reset(level_duration);
+                if(!is_end) {
+                    block[block_count++] = level_duration;
+                    // Yield, to load data inside the worker
+                    furi_thread_yield();
+                }
+                if(block_count == TEST_BATCH_SIZE || (is_end && block_count)) {
+                    subghz_protocol_decoder_base_feed_batch(decoder, block, block_count);
+                    block_count = 0;
+                }
+                if(is_end) break;
+            }
+            furi_delay_ms(10);
+        }
+        if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
+            subghz_file_encoder_worker_stop(file_worker_encoder_handler);
+        }
+        subghz_file_encoder_worker_free(file_worker_encoder_handler);
+        free(block);
+    }
+    FURI_LOG_T(TAG, "Decoder batch count parse %d", subghz_test_decoder_count);
+    return subghz_test_decoder_count;
+}
+
+// Batch size 1 feeds pairs one by one through subghz_receiver_decode
+static void subghz_receiver_decode_test(const char* path, size_t batch_size) {
+    subghz_test_decoder_count = 0;
+    subghz_receiver_reset(receiver_handler);
+    uint32_t test_start = furi_get_tick();
+
+    LevelDuration* block = malloc(sizeof(LevelDuration) * batch_size);
+    size_t block_count = 0;
+
+    file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path, NULL)) {
+        // the worker needs a file in order to open and read part of the file
+        furi_delay_ms(100);
+
+        LevelDuration level_duration;
+        while(furi_get_tick() - test_start < TEST_TIMEOUT * 10) {
+            level_duration =
+                subghz_file_encoder_worker_get_level_duration(file_worker_encoder_handler);
+            bool is_end = level_duration_is_reset(level_duration);
+            if(!is_end) {
+                block[block_count++] = level_duration;
+                // Yield, to load data inside the worker
+                furi_thread_yield();
+            }
+            if(block_count == batch_size || (is_end && block_count)) {
+                if(batch_size > 1) {
+                    subghz_receiver_decode_batch(receiver_handler, block, block_count);
+                } else {
+                    subghz_receiver_decode(
+                        receiver_handler,
+                        level_duration_get_level(block[0]),
+                        level_duration_get_duration(block[0]));
+                }
+                block_count = 0;
+            }
+            if(is_end) break;
+        }
+        furi_delay_ms(10);
+    }
+    if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
+        subghz_file_encoder_worker_stop(file_worker_encoder_handler);
+    }
+    subghz_file_encoder_worker_free(file_worker_encoder_handler);
+    free(block);
+
+    FURI_LOG_D(TAG, "Receiver count parse %d", subghz_test_decoder_count);
+}
+
 static bool subghz_decode_random_test(const char* path) {
     subghz_test_decoder_count = 0;
     subghz_receiver_reset(receiver_handler);
@@ -215,6 +338,88 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keystore_compiled_test) {
+    const size_t count = 40;
+    SubGhzKeystore* source = subghz_keystore_alloc();
+    for(size_t i = 0; i < count; i++) {
+        SubGhzKey key = {
+            .name = furi_string_alloc_printf("Test_%zu", i % 3),
+            .key = 0x0123456789ABCDEFULL * (i + 1),
+            .type = i % 9,
+        };
+        SubGhzKeyArray_push_back(*subghz_keystore_get_data(source), key);
+    }
+    uint8_t iv[16] = {0x13, 0x37, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    mu_assert(subghz_keystore_save(source, TEST_KEYSTORE_FILE_NAME, iv), "Keystore save error");
+
+    // First load decrypts text keystore and compiles it, second one uses compiled keystore
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const char* compiled_path = TEST_KEYSTORE_FILE_NAME ".cache";
+    for(size_t pass = 0; pass < 2; pass++) {
+        mu_assert(
+            storage_file_exists(storage, compiled_path) == (pass > 0),
+            "Compiled keystore state error");
+
+        SubGhzKeystore* keystore = subghz_keystore_alloc();
+        mu_assert(subghz_keystore_load(keystore, TEST_KEYSTORE_FILE_NAME), "Keystore load error");
+        SubGhzKeyArray_t* data = subghz_keystore_get_data(keystore);
+        mu_assert_int_eq(count, SubGhzKeyArray_size(*data));
+        for(size_t i = 0; i < count; i++) {
+            const SubGhzKey* expected = SubGhzKeyArray_cget(*subghz_keystore_get_data(source), i);
+            const SubGhzKey* key = SubGhzKeyArray_cget(*data, i);
+            mu_assert(expected->key == key->key, "Key mismatch");
+            mu_assert_int_eq(expected->type, key->type);
+            mu_assert_string_eq(
+                furi_string_get_cstr(expected->name), furi_string_get_cstr(key->name));
+        }
+        subghz_keystore_free(keystore);
+    }
+
+    storage_simply_remove(storage, compiled_path);
+    storage_simply_remove(storage, TEST_KEYSTORE_FILE_NAME);
+    furi_record_close(RECORD_STORAGE);
+    subghz_keystore_free(source);
+}
+
+MU_TEST(subghz_keeloq_batch_test) {
+    // Not a multiple of batch size, so partial batch is covered as well
+    const size_t count = KEELOQ_BATCH_SIZE + 5;
+    uint64_t* key = malloc(sizeof(uint64_t) * count);
+    uint64_t* man = malloc(sizeof(uint64_t) * count);
+    uint32_t* result = malloc(sizeof(uint32_t) * count);
+
+    uint64_t value = 0x0123456789ABCDEFULL;
+    for(size_t i = 0; i < count; i++) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        key[i] = value;
+    }
+
+    const uint32_t data = 0x1A2B3C4D;
+    const uint32_t seed = 0x0BADF00D;
+    subghz_protocol_keeloq_common_decrypt_batch(data, key, result, count);
+    for(size_t i = 0; i < count; i++) {
+        mu_assert_int_eq(subghz_protocol_keeloq_common_decrypt(data, key[i]), result[i]);
+    }
+
+    subghz_protocol_keeloq_common_normal_learning_batch(data, key, man, count);
+    for(size_t i = 0; i < count; i++) {
+        mu_assert(
+            subghz_protocol_keeloq_common_normal_learning(data, key[i]) == man[i],
+            "Normal learning batch mismatch");
+    }
+
+    subghz_protocol_keeloq_common_secure_learning_batch(data, seed, key, man, count);
+    for(size_t i = 0; i < count; i++) {
+        mu_assert(
+            subghz_protocol_keeloq_common_secure_learning(data, seed, key[i]) == man[i],
+            "Secure learning batch mismatch");
+    }
+
+    free(result);
+    free(man);
+    free(key);
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -370,6 +575,29 @@ MU_TEST(subghz_hal_async_tx_test) {
 }
 
 //test decoders
+MU_TEST(subghz_decoder_batch_feed_test) {
+    static const struct {
+        const char* path;
+        const char* name;
+    } files[] = {
+        {EXT_PATH("unit_tests/subghz/Princeton_raw.sub"), SUBGHZ_PROTOCOL_PRINCETON_NAME},
+        {EXT_PATH("unit_tests/subghz/came_raw.sub"), SUBGHZ_PROTOCOL_CAME_NAME},
+        {EXT_PATH("unit_tests/subghz/nice_flo_raw.sub"), SUBGHZ_PROTOCOL_NICE_FLO_NAME},
+        {EXT_PATH("unit_tests/subghz/doorhan_raw.sub"), SUBGHZ_PROTOCOL_KEELOQ_NAME},
+        {EXT_PATH("unit_tests/subghz/holtek_raw.sub"), SUBGHZ_PROTOCOL_HOLTEK_NAME},
+    };
+
+    for(size_t i = 0; i < COUNT_OF(files); i++) {
+        subghz_receiver_reset(receiver_handler);
+        mu_assert(subghz_decoder_test(files[i].path, files[i].name), files[i].name);
+        uint16_t count = subghz_test_decoder_count;
+
+        // Batch must decode exactly the same, generic fallback included
+        subghz_receiver_reset(receiver_handler);
+        mu_assert_int_eq(count, subghz_decoder_batch_test(files[i].path, files[i].name));
+    }
+}
+
 MU_TEST(subghz_decoder_came_atomo_test) {
     mu_assert(
         subghz_decoder_test(
@@ -851,12 +1079,92 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_receiver_decode_batch_test) {
+    // Gate TX and Princeton decode 100 pairs apart in this capture, so in one block.
+    // Rx callback resets receiver, decodes must come as with one pair per block.
+    const char* path = EXT_PATH("unit_tests/subghz/gate_tx_raw.sub");
+    static SubGhzTestDecodeLog pair_log;
+    static SubGhzTestDecodeLog batch_log;
+    memset(&pair_log, 0, sizeof(pair_log));
+    memset(&batch_log, 0, sizeof(batch_log));
+
+    subghz_receiver_set_rx_callback(receiver_handler, subghz_test_rx_log_callback, &pair_log);
+    subghz_receiver_decode_test(path, 1);
+    subghz_receiver_set_rx_callback(receiver_handler, subghz_test_rx_log_callback, &batch_log);
+    subghz_receiver_decode_test(path, TEST_RECEIVER_BATCH);
+    subghz_receiver_set_rx_callback(receiver_handler, subghz_test_rx_callback, NULL);
+
+    mu_assert(pair_log.count, "Receiver decoded nothing");
+    mu_assert_int_eq(pair_log.count, batch_log.count);
+    for(size_t i = 0; i < MIN(pair_log.count, (size_t)TEST_DECODE_LOG_SIZE); i++) {
+        mu_assert(
+            strcmp(pair_log.items[i].protocol_name, batch_log.items[i].protocol_name) == 0 &&
+                pair_log.items[i].hash == batch_log.items[i].hash,
+            "Receiver batch decode order mismatch");
+    }
+
+    subghz_receiver_decode_test(TEST_RANDOM_DIR_NAME, TEST_BATCH_SIZE);
+    mu_assert_int_eq(TEST_RANDOM_COUNT_PARSE, subghz_test_decoder_count);
+}
+
+MU_TEST(subghz_raw_binary_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    for(size_t compress = 0; compress < 2; compress++) {
+        mu_assert(
+            subghz_raw_binary_convert(
+                storage, TEST_RANDOM_DIR_NAME, TEST_RAW_BINARY_NAME, compress),
+            "Binary RAW convert error");
+        // Playback of binary payload must decode exactly the same as text
+        mu_assert(subghz_decode_random_test(TEST_RAW_BINARY_NAME), "Binary RAW decode error");
+
+        FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+        SubGhzRawBinaryReader* reader = subghz_raw_binary_reader_alloc();
+        FuriString* temp_str = furi_string_alloc();
+        uint32_t version = 0;
+        mu_assert(
+            flipper_format_file_open_existing(flipper_format, TEST_RAW_BINARY_NAME),
+            "Binary RAW open error");
+        mu_assert(flipper_format_read_header(flipper_format, temp_str, &version), "Header error");
+        mu_assert(
+            flipper_format_read_string(flipper_format, "Protocol", temp_str), "Protocol error");
+        mu_assert(subghz_raw_binary_reader_start(reader, flipper_format), "Reader start error");
+
+        // Seek must land on the same sample as sequential read
+        size_t count = subghz_raw_binary_reader_get_sample_count(reader);
+        mu_assert(count > SUBGHZ_RAW_BINARY_BLOCK_SAMPLES, "Too few samples");
+        size_t target = count - SUBGHZ_RAW_BINARY_BLOCK_SAMPLES / 2;
+        int32_t* samples = malloc(sizeof(int32_t) * count);
+        mu_assert_int_eq(count, subghz_raw_binary_reader_read(reader, samples, count));
+        mu_assert_int_eq(0, subghz_raw_binary_reader_read(reader, samples, 1));
+        int32_t sample = 0;
+        mu_assert(subghz_raw_binary_reader_seek(reader, target), "Seek error");
+        mu_assert_int_eq(1, subghz_raw_binary_reader_read(reader, &sample, 1));
+        mu_assert_int_eq(samples[target], sample);
+        mu_assert(!subghz_raw_binary_reader_seek(reader, count), "Seek out of range");
+        free(samples);
+
+        furi_string_free(temp_str);
+        subghz_raw_binary_reader_free(reader);
+        flipper_format_free(flipper_format);
+    }
+    // Binary file is not converted twice
+    mu_assert(
+        !subghz_raw_binary_convert(
+            storage, TEST_RAW_BINARY_NAME, TEST_RAW_BINARY_NAME "_2", false),
+        "Binary RAW converted twice");
+    storage_simply_remove(storage, TEST_RAW_BINARY_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_compiled_test);
+    MU_RUN_TEST(subghz_keeloq_batch_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
+    MU_RUN_TEST(subghz_decoder_batch_feed_test);
     MU_RUN_TEST(subghz_decoder_came_atomo_test);
     MU_RUN_TEST(subghz_decoder_came_test);
     MU_RUN_TEST(subghz_decoder_came_twee_test);
@@ -931,6 +1239,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dickert_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_receiver_decode_batch_test);
+    MU_RUN_TEST(subghz_raw_binary_test);
     subghz_test_deinit();
 }
 
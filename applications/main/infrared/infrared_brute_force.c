@@ -3,12 +3,54 @@
 #include <stdlib.h>
 #include <m-dict.h>
 #include <flipper_format/flipper_format.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <toolbox/crc32_calc.h>
+#include <infrared_worker.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+// Compiled database (.irdb) generated from the .ir file by scripts/infrared.py at build time.
+// See scripts/flipper/assets/irdb.py for the layout.
+#define INFRARED_BRUTE_FORCE_DB_SUFFIX  "db"
+#define INFRARED_BRUTE_FORCE_DB_MAGIC   "IRDB"
+#define INFRARED_BRUTE_FORCE_DB_VERSION (2U)
+
+#define INFRARED_BRUTE_FORCE_DB_TYPE_PARSED (0U)
+#define INFRARED_BRUTE_FORCE_DB_TYPE_RAW    (1U)
+
+typedef struct FURI_PACKED {
+    char magic[4];
+    uint16_t version;
+    uint16_t name_count;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint8_t protocol_count;
+} InfraredBruteForceDbHeader;
+
+typedef struct FURI_PACKED {
+    uint16_t signal_count;
+    uint32_t offset;
+} InfraredBruteForceDbIndexEntry;
+
+typedef struct FURI_PACKED {
+    uint8_t protocol;
+    uint8_t address[4];
+    uint8_t command[4];
+} InfraredBruteForceDbParsed;
+
+typedef struct FURI_PACKED {
+    uint32_t frequency;
+    float duty_cycle;
+    uint16_t timings_size;
+    uint16_t packed_size;
+} InfraredBruteForceDbRaw;
+
 typedef struct {
     uint32_t index;
     uint32_t count;
+    uint32_t offset;
 } InfraredBruteForceRecord;
 
 DICT_DEF2(
@@ -20,18 +62,28 @@ DICT_DEF2(
 
 struct InfraredBruteForce {
     FlipperFormat* ff;
+    Stream* db_stream;
     const char* db_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    InfraredProtocol* db_protocols;
+    uint8_t db_protocol_count;
+    uint32_t signals_left;
+    bool is_compiled;
     bool is_started;
 };
 
 InfraredBruteForce* infrared_brute_force_alloc(void) {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
+    brute_force->db_stream = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->db_protocols = NULL;
+    brute_force->db_protocol_count = 0;
+    brute_force->signals_left = 0;
+    brute_force->is_compiled = false;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
@@ -40,6 +92,7 @@ InfraredBruteForce* infrared_brute_force_alloc(void) {
 
 void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
+    free(brute_force->db_protocols);
     InfraredBruteForceRecordDict_clear(brute_force->records);
     furi_string_free(brute_force->current_record_name);
     free(brute_force);
@@ -50,12 +103,11 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
     brute_force->db_filename = db_filename;
 }
 
-bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
-    furi_assert(!brute_force->is_started);
-    furi_assert(brute_force->db_filename);
+static bool infrared_brute_force_calculate_messages_text(
+    InfraredBruteForce* brute_force,
+    Storage* storage) {
     bool success = false;
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
     FuriString* signal_name = furi_string_alloc();
     InfraredSignal* signal = infrared_signal_alloc();
@@ -84,6 +136,129 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     furi_string_free(signal_name);
 
     flipper_format_free(ff);
+    return success;
+}
+
+static bool infrared_brute_force_open_db(
+    InfraredBruteForce* brute_force,
+    Stream* stream,
+    InfraredBruteForceDbHeader* header) {
+    FuriString* db_path = furi_string_alloc_printf(
+        "%s" INFRARED_BRUTE_FORCE_DB_SUFFIX, brute_force->db_filename);
+    bool success = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               stream, furi_string_get_cstr(db_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        if(stream_read(stream, (uint8_t*)header, sizeof(*header)) != sizeof(*header)) break;
+        if(memcmp(header->magic, INFRARED_BRUTE_FORCE_DB_MAGIC, sizeof(header->magic)) != 0)
+            break;
+        if(header->version != INFRARED_BRUTE_FORCE_DB_VERSION) break;
+        success = true;
+    } while(false);
+
+    furi_string_free(db_path);
+    return success;
+}
+
+static bool infrared_brute_force_is_source_unchanged(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    const InfraredBruteForceDbHeader* header) {
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    // Size first, so that most edits are caught without reading the whole file
+    if(storage_file_open(file, brute_force->db_filename, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       storage_file_size(file) == header->source_size) {
+        success = crc32_calc_file(file, NULL, NULL) == header->source_crc;
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return success;
+}
+
+static bool infrared_brute_force_calculate_messages_compiled(
+    InfraredBruteForce* brute_force,
+    Storage* storage) {
+    bool success = false;
+
+    Stream* stream = buffered_file_stream_alloc(storage);
+    FuriString* name = furi_string_alloc();
+    char buf[UINT8_MAX + 1];
+
+    do {
+        InfraredBruteForceDbHeader header;
+        if(!infrared_brute_force_open_db(brute_force, stream, &header)) break;
+
+        // The .ir file may have been edited on the SD card after the database was built
+        if(!infrared_brute_force_is_source_unchanged(brute_force, storage, &header)) {
+            FURI_LOG_W(TAG, "Stale %s" INFRARED_BRUTE_FORCE_DB_SUFFIX, brute_force->db_filename);
+            break;
+        }
+
+        free(brute_force->db_protocols);
+        brute_force->db_protocols = malloc(sizeof(InfraredProtocol) * header.protocol_count);
+        brute_force->db_protocol_count = header.protocol_count;
+
+        uint8_t len;
+        size_t i;
+        for(i = 0; i < header.protocol_count; ++i) {
+            if(stream_read(stream, &len, 1) != 1 || stream_read(stream, (uint8_t*)buf, len) != len)
+                break;
+            buf[len] = '\0';
+            brute_force->db_protocols[i] = infrared_get_protocol_by_name(buf);
+        }
+        if(i != header.protocol_count) break;
+
+        for(i = 0; i < header.name_count; ++i) {
+            InfraredBruteForceDbIndexEntry entry;
+            if(stream_read(stream, &len, 1) != 1 ||
+               stream_read(stream, (uint8_t*)buf, len) != len ||
+               stream_read(stream, (uint8_t*)&entry, sizeof(entry)) != sizeof(entry))
+                break;
+
+            furi_string_set_strn(name, buf, len);
+            InfraredBruteForceRecord* record =
+                InfraredBruteForceRecordDict_get(brute_force->records, name);
+            if(record) {
+                record->count = entry.signal_count;
+                record->offset = entry.offset;
+            }
+        }
+        if(i != header.name_count) break;
+
+        success = true;
+    } while(false);
+
+    furi_string_free(name);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    return success;
+}
+
+bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
+    furi_assert(!brute_force->is_started);
+    furi_assert(brute_force->db_filename);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    brute_force->is_compiled =
+        infrared_brute_force_calculate_messages_compiled(brute_force, storage);
+    if(!brute_force->is_compiled) {
+        // Drop the counts a partially read database may have left behind
+        InfraredBruteForceRecordDict_it_t it;
+        for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+            !InfraredBruteForceRecordDict_end_p(it);
+            InfraredBruteForceRecordDict_next(it)) {
+            InfraredBruteForceRecordDict_ref(it)->value.count = 0;
+        }
+    }
+    const bool success = brute_force->is_compiled ||
+                         infrared_brute_force_calculate_messages_text(brute_force, storage);
+
     furi_record_close(RECORD_STORAGE);
     return success;
 }
@@ -94,6 +269,7 @@ bool infrared_brute_force_start(
     uint32_t* record_count) {
     furi_assert(!brute_force->is_started);
     bool success = false;
+    uint32_t offset = 0;
     *record_count = 0;
 
     InfraredBruteForceRecordDict_it_t it;
@@ -105,6 +281,8 @@ bool infrared_brute_force_start(
             *record_count = record->value.count;
             if(*record_count) {
                 furi_string_set(brute_force->current_record_name, record->key);
+                brute_force->signals_left = record->value.count;
+                offset = record->value.offset;
             }
             break;
         }
@@ -112,11 +290,18 @@ bool infrared_brute_force_start(
 
     if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+        if(brute_force->is_compiled) {
+            InfraredBruteForceDbHeader header;
+            brute_force->db_stream = buffered_file_stream_alloc(storage);
+            success = infrared_brute_force_open_db(brute_force, brute_force->db_stream, &header) &&
+                      stream_seek(brute_force->db_stream, offset, StreamOffsetFromStart);
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+        }
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -130,19 +315,97 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->db_stream) {
+        buffered_file_stream_close(brute_force->db_stream);
+        stream_free(brute_force->db_stream);
+    } else {
+        flipper_format_free(brute_force->ff);
+    }
     brute_force->current_signal = NULL;
     brute_force->ff = NULL;
+    brute_force->db_stream = NULL;
+    brute_force->signals_left = 0;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
 }
 
+static bool infrared_brute_force_read_next_compiled(InfraredBruteForce* brute_force) {
+    Stream* stream = brute_force->db_stream;
+    bool success = false;
+
+    uint8_t type;
+    if(!brute_force->signals_left || stream_read(stream, &type, 1) != 1) return false;
+
+    if(type == INFRARED_BRUTE_FORCE_DB_TYPE_PARSED) {
+        InfraredBruteForceDbParsed parsed;
+        if(stream_read(stream, (uint8_t*)&parsed, sizeof(parsed)) == sizeof(parsed) &&
+           parsed.protocol < brute_force->db_protocol_count) {
+            InfraredMessage message = {
+                .protocol = brute_force->db_protocols[parsed.protocol],
+                .repeat = false,
+            };
+            memcpy(&message.address, parsed.address, sizeof(parsed.address));
+            memcpy(&message.command, parsed.command, sizeof(parsed.command));
+            infrared_signal_set_message(brute_force->current_signal, &message);
+            // Same checks as for a parsed signal read from the .ir file
+            success = infrared_signal_is_valid(brute_force->current_signal);
+        }
+
+    } else if(type == INFRARED_BRUTE_FORCE_DB_TYPE_RAW) {
+        InfraredBruteForceDbRaw raw;
+        if(stream_read(stream, (uint8_t*)&raw, sizeof(raw)) == sizeof(raw) &&
+           raw.timings_size > 0 && raw.timings_size <= MAX_TIMINGS_AMOUNT) {
+            uint8_t* packed = malloc(raw.packed_size);
+            uint32_t* timings = malloc(sizeof(uint32_t) * raw.timings_size);
+
+            if(stream_read(stream, packed, raw.packed_size) == raw.packed_size) {
+                // Zigzag varint deltas against the timing of the same polarity
+                size_t count = 0;
+                uint32_t value = 0;
+                uint32_t shift = 0;
+                for(size_t i = 0; i < raw.packed_size && count < raw.timings_size; ++i) {
+                    value |= (uint32_t)(packed[i] & 0x7F) << shift;
+                    shift += 7;
+                    if(packed[i] & 0x80) {
+                        if(shift >= 32) break;
+                        continue;
+                    }
+
+                    const int32_t delta = (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+                    timings[count] = (count >= 2 ? timings[count - 2] : 0) + delta;
+                    ++count;
+                    value = shift = 0;
+                }
+
+                if(count == raw.timings_size) {
+                    infrared_signal_set_raw_signal(
+                        brute_force->current_signal,
+                        timings,
+                        raw.timings_size,
+                        raw.frequency,
+                        raw.duty_cycle);
+                    success = true;
+                }
+            }
+
+            free(timings);
+            free(packed);
+        }
+    }
+
+    --brute_force->signals_left;
+    return success;
+}
+
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_by_name_and_read(
-        brute_force->current_signal,
-        brute_force->ff,
-        furi_string_get_cstr(brute_force->current_record_name));
+    const bool success =
+        brute_force->is_compiled ?
+            infrared_brute_force_read_next_compiled(brute_force) :
+            infrared_signal_search_by_name_and_read(
+                brute_force->current_signal,
+                brute_force->ff,
+                furi_string_get_cstr(brute_force->current_record_name));
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
@@ -153,7 +416,7 @@ void infrared_brute_force_add_record(
     InfraredBruteForce* brute_force,
     uint32_t index,
     const char* name) {
-    InfraredBruteForceRecord value = {.index = index, .count = 0};
+    InfraredBruteForceRecord value = {.index = index, .count = 0, .offset = 0};
     FuriString* key;
     key = furi_string_alloc_set(name);
     InfraredBruteForceRecordDict_set_at(brute_force->records, key, value);
@@ -44,6 +44,10 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
  * This function must be called each time after setting the database via
  * a infrared_brute_force_set_db_filename() call.
  *
+ * If a compiled database (same path with an .irdb extension) built from the
+ * current file contents exists, only its index is read and the signals are
+ * later read from it without text parsing. Otherwise the text file is parsed.
+ *
  * @param[in,out] brute_force pointer to the instance to be updated.
  * @returns true on success, false otherwise.
  */
@@ -6,6 +6,7 @@
 #include <flipper_format.h>
 #include <toolbox/args.h>
 #include <m-dict.h>
+#include <m-array.h>
 
 #include "infrared_signal.h"
 #include "infrared_brute_force.h"
@@ -15,12 +16,20 @@
 #define INFRARED_FILE_EXTENSION          ".ir"
 #define INFRARED_ASSETS_FOLDER           EXT_PATH("infrared/assets")
 #define INFRARED_BRUTE_FORCE_DUMMY_INDEX 0
+#define INFRARED_CLI_ANALYZE_TMP_SUFFIX  ".tmp"
+
+typedef struct {
+    uint64_t key;
+    size_t index;
+} InfraredCliAnalyzeEntry;
 
 DICT_DEF2(dict_signals, FuriString*, FURI_STRING_OPLIST, int, M_DEFAULT_OPLIST)
+ARRAY_DEF(InfraredCliAnalyzeEntries, InfraredCliAnalyzeEntry, M_POD_OPLIST) // NOLINT
 
 static void infrared_cli_start_ir_rx(Cli* cli, FuriString* args);
 static void infrared_cli_start_ir_tx(Cli* cli, FuriString* args);
 static void infrared_cli_process_decode(Cli* cli, FuriString* args);
+static void infrared_cli_process_analyze(Cli* cli, FuriString* args);
 static void infrared_cli_process_universal(Cli* cli, FuriString* args);
 
 static const struct {
@@ -30,6 +39,7 @@ static const struct {
     {.cmd = "rx", .process_function = infrared_cli_start_ir_rx},
     {.cmd = "tx", .process_function = infrared_cli_start_ir_tx},
     {.cmd = "decode", .process_function = infrared_cli_process_decode},
+    {.cmd = "analyze", .process_function = infrared_cli_process_analyze},
     {.cmd = "universal", .process_function = infrared_cli_process_universal},
 };
 
@@ -116,6 +126,7 @@ static void infrared_cli_print_usage(void) {
         INFRARED_MIN_FREQUENCY,
         INFRARED_MAX_FREQUENCY);
     printf("\tir decode <input_file> [<output_file>]\r\n");
+    printf("\tir analyze <input_file> [<output_file>]\r\n");
     printf("\tir universal <remote_name> <signal_name>\r\n");
     printf("\tir universal list <remote_name>\r\n");
     printf("\tAvailable universal remotes: ");
@@ -389,6 +400,249 @@ static void infrared_cli_process_decode(Cli* cli, FuriString* args) {
     furi_record_close(RECORD_STORAGE);
 }
 
+/* Replace a RAW signal with a parsed one if the parsed message reproduces all of its timings */
+static bool infrared_cli_analyze_raw_signal(
+    InfraredSignal* signal,
+    InfraredDecoderHandler* decoder,
+    InfraredEncoderHandler* encoder) {
+    const InfraredRawSignal* raw_signal = infrared_signal_get_raw_signal(signal);
+    InfraredMessage message;
+
+    if(infrared_raw_to_message(
+           decoder,
+           encoder,
+           raw_signal->frequency,
+           raw_signal->timings,
+           raw_signal->timings_size,
+           &message)) {
+        infrared_signal_set_message(signal, &message);
+        return true;
+    }
+
+    return false;
+}
+
+static uint64_t infrared_cli_hash_add(uint64_t hash, const void* data, size_t size) {
+    // FNV-1a
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/* Possible duplicates share a key: same name and either same message or same RAW frequency
+ * and timing count. Only infrared_cli_is_duplicate() decides. */
+static uint64_t infrared_cli_analyze_key(const InfraredSignal* signal, const char* name) {
+    uint64_t hash = infrared_cli_hash_add(0xCBF29CE484222325ULL, name, strlen(name) + 1);
+
+    if(infrared_signal_is_raw(signal)) {
+        const InfraredRawSignal* raw_signal = infrared_signal_get_raw_signal(signal);
+        hash = infrared_cli_hash_add(hash, &raw_signal->frequency, sizeof(raw_signal->frequency));
+        hash = infrared_cli_hash_add(
+            hash, &raw_signal->timings_size, sizeof(raw_signal->timings_size));
+    } else {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        hash = infrared_cli_hash_add(hash, &message->protocol, sizeof(message->protocol));
+        hash = infrared_cli_hash_add(hash, &message->address, sizeof(message->address));
+        hash = infrared_cli_hash_add(hash, &message->command, sizeof(message->command));
+    }
+
+    return hash;
+}
+
+static bool infrared_cli_is_duplicate(const InfraredSignal* signal, const InfraredSignal* other) {
+    if(infrared_signal_is_raw(signal) != infrared_signal_is_raw(other)) return false;
+
+    if(infrared_signal_is_raw(signal)) {
+        const InfraredRawSignal* raw_signal = infrared_signal_get_raw_signal(signal);
+        const InfraredRawSignal* other_raw_signal = infrared_signal_get_raw_signal(other);
+        return (raw_signal->frequency == other_raw_signal->frequency) &&
+               (raw_signal->timings_size == other_raw_signal->timings_size) &&
+               infrared_raw_is_similar(
+                   raw_signal->frequency,
+                   raw_signal->timings,
+                   other_raw_signal->timings,
+                   raw_signal->timings_size);
+    } else {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        const InfraredMessage* other_message = infrared_signal_get_message(other);
+        return (message->protocol == other_message->protocol) &&
+               (message->address == other_message->address) &&
+               (message->command == other_message->command);
+    }
+}
+
+/* Kept signals are read back from the input file by index, so only keys stay in memory */
+static bool infrared_cli_analyze_file(
+    FlipperFormat* input_file,
+    FlipperFormat* lookup_file,
+    FlipperFormat* output_file) {
+    bool ret = true;
+    size_t signal_count = 0, converted_count = 0, duplicate_count = 0;
+
+    InfraredSignal* signal = infrared_signal_alloc();
+    InfraredSignal* kept_signal = infrared_signal_alloc();
+    InfraredDecoderHandler* decoder = infrared_alloc_decoder();
+    InfraredEncoderHandler* encoder = infrared_alloc_encoder();
+    InfraredCliAnalyzeEntries_t entries;
+    InfraredCliAnalyzeEntries_init(entries);
+    FuriString* name = furi_string_alloc();
+
+    // Name and body are read separately, so a broken signal fails instead of ending the file
+    for(; infrared_signal_read_name(input_file, name); ++signal_count) {
+        if(!infrared_signal_read_body(signal, input_file) || !infrared_signal_is_valid(signal)) {
+            printf("Invalid signal: %s\r\n", furi_string_get_cstr(name));
+            ret = false;
+            break;
+        }
+
+        if(infrared_signal_is_raw(signal) &&
+           infrared_cli_analyze_raw_signal(signal, decoder, encoder)) {
+            const InfraredMessage* message = infrared_signal_get_message(signal);
+            printf(
+                "%s: RAW -> %s A:0x%lX C:0x%lX\r\n",
+                furi_string_get_cstr(name),
+                infrared_get_protocol_name(message->protocol),
+                message->address,
+                message->command);
+            ++converted_count;
+        }
+
+        const InfraredCliAnalyzeEntry entry = {
+            .key = infrared_cli_analyze_key(signal, furi_string_get_cstr(name)),
+            .index = signal_count,
+        };
+        bool is_duplicate = false;
+
+        for(size_t i = 0; i < InfraredCliAnalyzeEntries_size(entries) && !is_duplicate; ++i) {
+            const InfraredCliAnalyzeEntry* kept = InfraredCliAnalyzeEntries_get(entries, i);
+            if(kept->key != entry.key) continue;
+
+            if(!flipper_format_rewind(lookup_file) ||
+               !infrared_signal_search_by_index_and_read(kept_signal, lookup_file, kept->index)) {
+                printf("Failed to read back signal #%zu\r\n", kept->index);
+                ret = false;
+                break;
+            }
+            if(infrared_signal_is_raw(kept_signal)) {
+                infrared_cli_analyze_raw_signal(kept_signal, decoder, encoder);
+            }
+            is_duplicate = infrared_cli_is_duplicate(signal, kept_signal);
+        }
+
+        if(!ret) break;
+
+        if(is_duplicate) {
+            printf("%s: duplicate, removed\r\n", furi_string_get_cstr(name));
+            ++duplicate_count;
+            continue;
+        }
+        InfraredCliAnalyzeEntries_push_back(entries, entry);
+
+        if(!infrared_cli_save_signal(signal, output_file, furi_string_get_cstr(name))) {
+            ret = false;
+            break;
+        }
+    }
+
+    printf(
+        "%zu signals: %zu RAW converted to parsed, %zu duplicates removed\r\n",
+        signal_count,
+        converted_count,
+        duplicate_count);
+
+    furi_string_free(name);
+    InfraredCliAnalyzeEntries_clear(entries);
+    infrared_free_encoder(encoder);
+    infrared_free_decoder(decoder);
+    infrared_signal_free(kept_signal);
+    infrared_signal_free(signal);
+
+    return ret;
+}
+
+static void infrared_cli_process_analyze(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* input_file = flipper_format_buffered_file_alloc(storage);
+    FlipperFormat* lookup_file = flipper_format_buffered_file_alloc(storage);
+    FlipperFormat* output_file = flipper_format_file_alloc(storage);
+
+    uint32_t version;
+    FuriString *header, *input_path, *output_path;
+    header = furi_string_alloc();
+    input_path = furi_string_alloc();
+    output_path = furi_string_alloc();
+    bool in_place = false, success = false;
+
+    do {
+        if(!args_read_probably_quoted_string_and_trim(args, input_path)) {
+            printf("Wrong arguments.\r\n");
+            infrared_cli_print_usage();
+            break;
+        }
+        if(!args_read_probably_quoted_string_and_trim(args, output_path)) {
+            // Rewrite the input file through a temporary one
+            furi_string_printf(
+                output_path,
+                "%s" INFRARED_CLI_ANALYZE_TMP_SUFFIX,
+                furi_string_get_cstr(input_path));
+            in_place = true;
+        }
+        if(!flipper_format_buffered_file_open_existing(
+               input_file, furi_string_get_cstr(input_path)) ||
+           !flipper_format_buffered_file_open_existing(
+               lookup_file, furi_string_get_cstr(input_path))) {
+            printf(
+                "Failed to open file for reading: \"%s\"\r\n", furi_string_get_cstr(input_path));
+            break;
+        }
+        if(!flipper_format_read_header(input_file, header, &version) ||
+           (!furi_string_start_with_str(header, "IR")) || version != 1) {
+            printf(
+                "Invalid or corrupted input file: \"%s\"\r\n", furi_string_get_cstr(input_path));
+            break;
+        }
+        if(!flipper_format_file_open_always(output_file, furi_string_get_cstr(output_path)) ||
+           !flipper_format_write_header(output_file, header, version)) {
+            printf(
+                "Failed to open file for writing: \"%s\"\r\n", furi_string_get_cstr(output_path));
+            break;
+        }
+        success = infrared_cli_analyze_file(input_file, lookup_file, output_file);
+    } while(false);
+
+    flipper_format_free(input_file);
+    flipper_format_free(lookup_file);
+    flipper_format_free(output_file);
+
+    if(in_place) {
+        if(success) {
+            success = storage_common_rename(
+                          storage,
+                          furi_string_get_cstr(output_path),
+                          furi_string_get_cstr(input_path)) == FSE_OK;
+        } else {
+            storage_common_remove(storage, furi_string_get_cstr(output_path));
+        }
+    }
+
+    if(success) {
+        FileInfo file_info;
+        const char* result_path = furi_string_get_cstr(in_place ? input_path : output_path);
+        if(storage_common_stat(storage, result_path, &file_info) == FSE_OK) {
+            printf("Written %s, %llu bytes\r\n", result_path, file_info.size);
+        }
+    }
+
+    furi_string_free(header);
+    furi_string_free(input_path);
+    furi_string_free(output_path);
+    furi_record_close(RECORD_STORAGE);
+}
+
 static void infrared_cli_list_remote_signals(FuriString* remote_name) {
     if(furi_string_empty(remote_name)) {
         printf("Missing remote name.\r\n");
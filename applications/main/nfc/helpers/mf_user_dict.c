@@ -8,6 +8,7 @@
 #define NFC_APP_MF_CLASSIC_DICT_USER_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict_user.nfc")
 
 struct MfUserDict {
+    KeysDict* dict;
     size_t keys_num;
     MfClassicKey* keys_arr;
 };
@@ -15,21 +16,24 @@ struct MfUserDict {
 MfUserDict* mf_user_dict_alloc(size_t max_keys_to_load) {
     MfUserDict* instance = malloc(sizeof(MfUserDict));
 
-    KeysDict* dict = keys_dict_alloc(
-        NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    // Kept in memory until free, deleted keys are written back once
+    instance->dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH,
+        KeysDictModeOpenAlways | KeysDictModeInMemory,
+        sizeof(MfClassicKey));
 
-    size_t dict_keys_num = keys_dict_get_total_keys(dict);
+    size_t dict_keys_num = keys_dict_get_total_keys(instance->dict);
     instance->keys_num = MIN(max_keys_to_load, dict_keys_num);
+    instance->keys_arr = NULL;
 
     if(instance->keys_num > 0) {
         instance->keys_arr = malloc(instance->keys_num * sizeof(MfClassicKey));
         for(size_t i = 0; i < instance->keys_num; i++) {
-            bool key_loaded =
-                keys_dict_get_next_key(dict, instance->keys_arr[i].data, sizeof(MfClassicKey));
+            bool key_loaded = keys_dict_get_next_key(
+                instance->dict, instance->keys_arr[i].data, sizeof(MfClassicKey));
             furi_assert(key_loaded);
         }
     }
-    keys_dict_free(dict);
 
     return instance;
 }
@@ -37,9 +41,8 @@ MfUserDict* mf_user_dict_alloc(size_t max_keys_to_load) {
 void mf_user_dict_free(MfUserDict* instance) {
     furi_assert(instance);
 
-    if(instance->keys_num > 0) {
-        free(instance->keys_arr);
-    }
+    keys_dict_free(instance->dict);
+    free(instance->keys_arr);
     free(instance);
 }
 
@@ -66,15 +69,15 @@ bool mf_user_dict_delete_key(MfUserDict* instance, uint32_t index) {
     furi_assert(index < instance->keys_num);
     furi_assert(instance->keys_arr);
 
-    KeysDict* dict = keys_dict_alloc(
-        NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
-
-    bool key_delete_success =
-        keys_dict_delete_key(dict, instance->keys_arr[index].data, sizeof(MfClassicKey));
-    keys_dict_free(dict);
+    bool key_delete_success = keys_dict_delete_key(
+        instance->dict, instance->keys_arr[index].data, sizeof(MfClassicKey));
 
     if(key_delete_success) {
         instance->keys_num--;
+        memmove(
+            &instance->keys_arr[index],
+            &instance->keys_arr[index + 1],
+            (instance->keys_num - index) * sizeof(MfClassicKey));
     }
 
     return key_delete_success;
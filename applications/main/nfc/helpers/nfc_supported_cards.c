@@ -8,27 +8,65 @@
 #include <flipper_application/plugins/composite_resolver.h>
 #include <loader/firmware_api/firmware_api.h>
 
+#include <nfc/protocols/mf_classic/mf_classic.h>
+#include <nfc/protocols/mf_ultralight/mf_ultralight.h>
+#include <nfc/protocols/st25tb/st25tb.h>
+
 #include <furi.h>
 #include <path.h>
 #include <m-array.h>
+#include <bit_lib/bit_lib.h>
+#include <toolbox/crc32_calc.h>
+#include <toolbox/version.h>
 
 #define TAG "NfcSupportedCards"
 
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH  APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_INDEX_PATH    APP_DATA_PATH(".plugins.idx")
+#define NFC_SUPPORTED_CARDS_INDEX_MAGIC   (0x4E464349UL)
+#define NFC_SUPPORTED_CARDS_INDEX_VERSION (1U)
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
     NfcSupportedCardsPluginFeatureHasParse = (1U << 2),
 } NfcSupportedCardsPluginFeature;
 
+/** Copy of NfcSupportedCardPluginMatch, that doesn't point into the unloaded plugin */
+typedef struct {
+    uint32_t type_mask;
+    uint64_t key_a;
+    uint8_t uid_len;
+    uint8_t key_a_sector;
+    bool has_key_a;
+    bool has_desfire_app;
+    MfDesfireApplicationId desfire_app;
+} NfcSupportedCardsPluginMatchCache;
+
 typedef struct {
     FuriString* name;
     NfcProtocol protocol;
     NfcSupportedCardsPluginFeature feature;
+    NfcSupportedCardsPluginMatchCache match;
 } NfcSupportedCardsPluginCache;
 
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t fingerprint; /**< Firmware, plugin API and plugin files the index was built for */
+    uint32_t count;
+} NfcSupportedCardsIndexHeader;
+
+/** Followed by name_len bytes of plugin name */
+typedef struct {
+    uint32_t protocol;
+    uint32_t feature;
+    NfcSupportedCardsPluginMatchCache match;
+    uint8_t name_len;
+} NfcSupportedCardsIndexEntry;
+
 ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
 
 typedef enum {
@@ -64,9 +102,7 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
     return instance;
 }
 
-void nfc_supported_cards_free(NfcSupportedCards* instance) {
-    furi_assert(instance);
-
+static void nfc_supported_cards_cache_reset(NfcSupportedCards* instance) {
     NfcSupportedCardsPluginCache_it_t iter;
     for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
         !NfcSupportedCardsPluginCache_end_p(iter);
@@ -74,6 +110,13 @@ void nfc_supported_cards_free(NfcSupportedCards* instance) {
         NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
         furi_string_free(plugin_cache->name);
     }
+    NfcSupportedCardsPluginCache_reset(instance->plugins_cache_arr);
+}
+
+void nfc_supported_cards_free(NfcSupportedCards* instance) {
+    furi_assert(instance);
+
+    nfc_supported_cards_cache_reset(instance);
     NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
 
     composite_api_resolver_free(instance->api_resolver);
@@ -118,6 +161,7 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     do {
         if(instance->app) flipper_application_free(instance->app);
         instance->app = flipper_application_alloc(instance->storage, api_interface);
+        flipper_application_set_load_cache(instance->app, true);
 
         if(flipper_application_preload(instance->app, furi_string_get_cstr(plugin_path)) !=
            FlipperApplicationPreloadStatusSuccess)
@@ -140,6 +184,15 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     return plugin;
 }
 
+static bool nfc_supported_cards_is_plugin_file(const char* file_name, size_t* suffix_start_pos) {
+    const size_t suffix_len = strlen(NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
+    const size_t file_name_len = strlen(file_name);
+    if(file_name_len <= suffix_len) return false;
+
+    *suffix_start_pos = file_name_len - suffix_len;
+    return strcmp(&file_name[*suffix_start_pos], NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX) == 0;
+}
+
 static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
     NfcSupportedCardsLoadContext* instance,
     const ElfApiInterface* api_interface) {
@@ -151,16 +204,8 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
                instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
             break;
 
-        const size_t suffix_len = strlen(NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
-        const size_t file_name_len = strlen(instance->file_name);
-        if(file_name_len <= suffix_len) break;
-
-        size_t suffix_start_pos = file_name_len - suffix_len;
-        if(memcmp(
-               &instance->file_name[suffix_start_pos],
-               NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX,
-               suffix_len) != 0) //-V1051
-            break;
+        size_t suffix_start_pos = 0;
+        if(!nfc_supported_cards_is_plugin_file(instance->file_name, &suffix_start_pos)) break;
 
         // Trim suffix from file_name to save memory. The suffix will be concatenated on plugin load.
         instance->file_name[suffix_start_pos] = '\0';
@@ -171,6 +216,227 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
     return plugin;
 }
 
+static void nfc_supported_cards_cache_match(
+    NfcSupportedCardsPluginMatchCache* match_cache,
+    const NfcSupportedCardPluginMatch* match) {
+    if(match == NULL) return;
+
+    match_cache->type_mask = match->type_mask;
+    match_cache->uid_len = match->uid_len;
+    if(match->key_a) {
+        match_cache->has_key_a = true;
+        match_cache->key_a_sector = match->key_a_sector;
+        match_cache->key_a = *match->key_a;
+    }
+    if(match->desfire_app) {
+        match_cache->has_desfire_app = true;
+        match_cache->desfire_app = *match->desfire_app;
+    }
+}
+
+static bool nfc_supported_cards_match(
+    const NfcSupportedCardsPluginMatchCache* match,
+    const NfcDevice* device) {
+    const NfcProtocol protocol = nfc_device_get_protocol(device);
+    bool matched = false;
+
+    do {
+        if(match->uid_len) {
+            size_t uid_len = 0;
+            nfc_device_get_uid(device, &uid_len);
+            if(uid_len != match->uid_len) break;
+        }
+
+        uint32_t type_bit = 0;
+        if(protocol == NfcProtocolMfClassic) {
+            const MfClassicData* data = nfc_device_get_data(device, NfcProtocolMfClassic);
+            type_bit = 1U << data->type;
+
+            if(match->has_key_a) {
+                const MfClassicSectorTrailer* sec_tr =
+                    mf_classic_get_sector_trailer_by_sector(data, match->key_a_sector);
+                const uint64_t key_a =
+                    bit_lib_bytes_to_num_be(sec_tr->key_a.data, COUNT_OF(sec_tr->key_a.data));
+                if(key_a != match->key_a) break;
+            }
+        } else if(protocol == NfcProtocolMfUltralight) {
+            const MfUltralightData* data = nfc_device_get_data(device, NfcProtocolMfUltralight);
+            type_bit = 1U << data->type;
+        } else if(protocol == NfcProtocolSt25tb) {
+            const St25tbData* data = nfc_device_get_data(device, NfcProtocolSt25tb);
+            type_bit = 1U << data->type;
+        } else if(protocol == NfcProtocolMfDesfire && match->has_desfire_app) {
+            const MfDesfireData* data = nfc_device_get_data(device, NfcProtocolMfDesfire);
+            if(mf_desfire_get_application(data, &match->desfire_app) == NULL) break;
+        }
+
+        if(match->type_mask && type_bit && (match->type_mask & type_bit) == 0) break;
+
+        matched = true;
+    } while(false);
+
+    return matched;
+}
+
+static uint32_t nfc_supported_cards_index_fingerprint(Storage* storage) {
+    const char* githash = version_get_githash(NULL);
+    const uint32_t api_version = NFC_SUPPORTED_CARD_PLUGIN_API_VERSION;
+
+    uint32_t crc = crc32_calc_buffer(0, githash, strlen(githash));
+    crc = crc32_calc_buffer(crc, &api_version, sizeof(api_version));
+
+    File* directory = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    char file_name[256];
+    FileInfo file_info;
+
+    if(storage_dir_open(directory, NFC_SUPPORTED_CARDS_PLUGINS_PATH)) {
+        while(storage_dir_read(directory, &file_info, file_name, sizeof(file_name))) {
+            size_t suffix_start_pos = 0;
+            if(!nfc_supported_cards_is_plugin_file(file_name, &suffix_start_pos)) continue;
+
+            uint32_t timestamp = 0;
+            furi_string_printf(path, "%s/%s", NFC_SUPPORTED_CARDS_PLUGINS_PATH, file_name);
+            storage_common_timestamp(storage, furi_string_get_cstr(path), &timestamp);
+
+            crc = crc32_calc_buffer(crc, file_name, strlen(file_name));
+            crc = crc32_calc_buffer(crc, &file_info.size, sizeof(file_info.size));
+            crc = crc32_calc_buffer(crc, &timestamp, sizeof(timestamp));
+        }
+    }
+    storage_dir_close(directory);
+
+    furi_string_free(path);
+    storage_file_free(directory);
+
+    return crc;
+}
+
+static bool nfc_supported_cards_index_load(
+    NfcSupportedCards* instance,
+    Storage* storage,
+    uint32_t fingerprint) {
+    File* file = storage_file_alloc(storage);
+    char name[UINT8_MAX + 1];
+    bool success = false;
+
+    do {
+        if(!storage_file_open(
+               file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        NfcSupportedCardsIndexHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != NFC_SUPPORTED_CARDS_INDEX_MAGIC ||
+           header.version != NFC_SUPPORTED_CARDS_INDEX_VERSION ||
+           header.fingerprint != fingerprint)
+            break;
+
+        uint32_t loaded = 0;
+        for(; loaded < header.count; loaded++) {
+            NfcSupportedCardsIndexEntry entry;
+            if(storage_file_read(file, &entry, sizeof(entry)) != sizeof(entry)) break;
+            if(storage_file_read(file, name, entry.name_len) != entry.name_len) break;
+            name[entry.name_len] = '\0';
+
+            NfcSupportedCardsPluginCache plugin_cache = {
+                .name = furi_string_alloc_set(name),
+                .protocol = entry.protocol,
+                .feature = entry.feature,
+                .match = entry.match,
+            };
+            NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+        }
+
+        success = (loaded == header.count);
+    } while(false);
+
+    if(!success) {
+        nfc_supported_cards_cache_reset(instance);
+    }
+    storage_file_free(file);
+
+    return success;
+}
+
+static void nfc_supported_cards_index_save(
+    NfcSupportedCards* instance,
+    Storage* storage,
+    uint32_t fingerprint) {
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    do {
+        if(!storage_file_open(
+               file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        const NfcSupportedCardsIndexHeader header = {
+            .magic = NFC_SUPPORTED_CARDS_INDEX_MAGIC,
+            .version = NFC_SUPPORTED_CARDS_INDEX_VERSION,
+            .fingerprint = fingerprint,
+            .count = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr),
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        NfcSupportedCardsPluginCache_it_t iter;
+        for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
+            !NfcSupportedCardsPluginCache_end_p(iter);
+            NfcSupportedCardsPluginCache_next(iter)) {
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
+
+            NfcSupportedCardsIndexEntry entry = {};
+            entry.protocol = plugin_cache->protocol;
+            entry.feature = plugin_cache->feature;
+            entry.match = plugin_cache->match;
+            entry.name_len = MIN(furi_string_size(plugin_cache->name), (size_t)UINT8_MAX);
+
+            if(storage_file_write(file, &entry, sizeof(entry)) != sizeof(entry)) break;
+            if(storage_file_write(
+                   file, furi_string_get_cstr(plugin_cache->name), entry.name_len) !=
+               entry.name_len)
+                break;
+        }
+
+        success = NfcSupportedCardsPluginCache_end_p(iter);
+    } while(false);
+
+    storage_file_free(file);
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save plugin index");
+        storage_common_remove(storage, NFC_SUPPORTED_CARDS_INDEX_PATH);
+    }
+}
+
+static void nfc_supported_cards_load_plugins(NfcSupportedCards* instance) {
+    instance->load_context = nfc_supported_cards_load_context_alloc();
+
+    while(true) {
+        const ElfApiInterface* api_interface = composite_api_resolver_get(instance->api_resolver);
+        const NfcSupportedCardsPlugin* plugin =
+            nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
+        if(plugin == NULL) break; //-V547
+
+        NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
+        plugin_cache.name = furi_string_alloc_set(instance->load_context->file_name);
+        plugin_cache.protocol = plugin->protocol;
+        if(plugin->verify) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
+        }
+        if(plugin->read) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
+        }
+        if(plugin->parse) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
+        }
+        nfc_supported_cards_cache_match(&plugin_cache.match, plugin->match);
+        NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+    }
+
+    nfc_supported_cards_load_context_free(instance->load_context);
+}
+
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
     furi_assert(instance);
 
@@ -179,31 +445,15 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
            (instance->load_state == NfcSupportedCardsLoadStateFail))
             break;
 
-        instance->load_context = nfc_supported_cards_load_context_alloc();
-
-        while(true) {
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin =
-                nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
-            if(plugin == NULL) break; //-V547
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        const uint32_t fingerprint = nfc_supported_cards_index_fingerprint(storage);
+        const bool index_loaded = nfc_supported_cards_index_load(instance, storage, fingerprint);
 
-            NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
-            plugin_cache.name = furi_string_alloc_set(instance->load_context->file_name);
-            plugin_cache.protocol = plugin->protocol;
-            if(plugin->verify) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
-            }
-            if(plugin->read) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
-            }
-            if(plugin->parse) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
-            }
-            NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+        if(!index_loaded) {
+            nfc_supported_cards_load_plugins(instance);
+            nfc_supported_cards_index_save(instance, storage, fingerprint);
         }
-
-        nfc_supported_cards_load_context_free(instance->load_context);
+        furi_record_close(RECORD_STORAGE);
 
         size_t plugins_loaded = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr);
         if(plugins_loaded == 0) {
@@ -285,6 +535,7 @@ bool nfc_supported_cards_parse(
             NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
             if(plugin_cache->protocol != protocol) continue;
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasParse) == 0) continue;
+            if(!nfc_supported_cards_match(&plugin_cache->match, device)) continue;
 
             const ElfApiInterface* api_interface =
                 composite_api_resolver_get(instance->api_resolver);
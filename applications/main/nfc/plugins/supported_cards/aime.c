@@ -148,11 +148,17 @@ static bool aime_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch aime_match = {
+    .key_a_sector = 0,
+    .key_a = &aime_key,
+};
+
 static const NfcSupportedCardsPlugin aime_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = aime_verify,
     .read = aime_read,
     .parse = aime_parse,
+    .match = &aime_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -327,11 +327,18 @@ static bool bip_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch bip_match = {
+    .type_mask = (1U << MfClassicType1k),
+    .key_a_sector = 0,
+    .key_a = &bip_1k_keys[0].a,
+};
+
 static const NfcSupportedCardsPlugin bip_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = bip_verify,
     .read = bip_read,
     .parse = bip_parse,
+    .match = &bip_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -1256,11 +1256,18 @@ static bool charliecard_read(Nfc* nfc, NfcDevice* device) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch charliecard_match = {
+    .type_mask = (1U << MfClassicType1k),
+    .key_a_sector = 3,
+    .key_a = &charliecard_1k_keys[3].a,
+};
+
 static const NfcSupportedCardsPlugin charliecard_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = charliecard_verify,
     .read = charliecard_read,
     .parse = charliecard_parse,
+    .match = &charliecard_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
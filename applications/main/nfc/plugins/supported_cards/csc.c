@@ -129,11 +129,16 @@ bool csc_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch csc_match = {
+    .type_mask = (1U << MfClassicType1k),
+};
+
 static const NfcSupportedCardsPlugin csc_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = csc_parse,
+    .match = &csc_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
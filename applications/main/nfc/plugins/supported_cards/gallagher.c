@@ -68,11 +68,16 @@ static bool gallagher_parse(const NfcDevice* device, FuriString* parsed_data) {
     return true;
 }
 
+static const NfcSupportedCardPluginMatch gallagher_match = {
+    .type_mask = (1U << MfClassicType1k) | (1U << MfClassicType4k),
+};
+
 static const NfcSupportedCardsPlugin gallagher_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = gallagher_parse,
+    .match = &gallagher_match,
 };
 
 static const FlipperAppPluginDescriptor gallagher_plugin_descriptor = {
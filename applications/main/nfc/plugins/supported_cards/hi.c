@@ -207,11 +207,16 @@ static bool hi_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch hi_match = {
+    .type_mask = (1U << MfClassicType1k),
+};
+
 static const NfcSupportedCardsPlugin hi_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hi_verify,
     .read = hi_read,
     .parse = hi_parse,
+    .match = &hi_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -132,11 +132,17 @@ static bool hid_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch hid_match = {
+    .key_a_sector = 1,
+    .key_a = &hid_key,
+};
+
 static const NfcSupportedCardsPlugin hid_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hid_verify,
     .read = hid_read,
     .parse = hid_parse,
+    .match = &hid_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -105,11 +105,16 @@ static bool itso_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch itso_match = {
+    .desfire_app = &itso_app_id,
+};
+
 static const NfcSupportedCardsPlugin itso_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = itso_parse,
+    .match = &itso_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
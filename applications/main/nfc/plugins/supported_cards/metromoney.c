@@ -170,11 +170,17 @@ static bool metromoney_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch metromoney_match = {
+    .key_a_sector = 1,
+    .key_a = &metromoney_1k_keys[1].a,
+};
+
 static const NfcSupportedCardsPlugin metromoney_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = metromoney_verify,
     .read = metromoney_read,
     .parse = metromoney_parse,
+    .match = &metromoney_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -211,12 +211,17 @@ static bool microel_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch microel_match = {
+    .uid_len = UID_LENGTH,
+};
+
 static const NfcSupportedCardsPlugin microel_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify =
         NULL, // the verification I need is based on verifying the keys generated via uid and try to authenticate not like on mizip that there is default b0 but added verify in read function
     .read = microel_read,
     .parse = microel_parse,
+    .match = &microel_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
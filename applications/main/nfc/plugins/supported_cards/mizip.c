@@ -238,11 +238,16 @@ static bool mizip_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch mizip_match = {
+    .type_mask = (1U << MfClassicType1k) | (1U << MfClassicTypeMini),
+};
+
 static const NfcSupportedCardsPlugin mizip_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = mizip_verify,
     .read = mizip_read,
     .parse = mizip_parse,
+    .match = &mizip_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -137,11 +137,16 @@ static bool mykey_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch mykey_match = {
+    .type_mask = (1U << St25tbType04k) | (1U << St25tbTypeX4k),
+};
+
 static const NfcSupportedCardsPlugin mykey_plugin = {
     .protocol = NfcProtocolSt25tb,
     .verify = NULL,
     .read = NULL,
     .parse = mykey_parse,
+    .match = &mykey_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -96,11 +96,16 @@ static bool myki_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch myki_match = {
+    .desfire_app = &myki_app_id,
+};
+
 static const NfcSupportedCardsPlugin myki_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = myki_parse,
+    .match = &myki_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -462,11 +462,18 @@ static bool ndef_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch ndef_match = {
+    .type_mask = (1U << MfUltralightTypeNTAG203) | (1U << MfUltralightTypeNTAG213) |
+                 (1U << MfUltralightTypeNTAG215) | (1U << MfUltralightTypeNTAG216) |
+                 (1U << MfUltralightTypeNTAGI2C1K) | (1U << MfUltralightTypeNTAGI2C2K),
+};
+
 static const NfcSupportedCardsPlugin ndef_plugin = {
     .protocol = NfcProtocolMfUltralight,
     .verify = NULL,
     .read = NULL,
     .parse = ndef_parse,
+    .match = &ndef_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -13,6 +13,8 @@
  *
  * To add a new plugin, create a uniquely-named .c file in the `supported_cards` directory
  * and implement at least the parse() function in the NfcSupportedCardsPlugin structure.
+ * If the card can be rejected by its type, UID length, a known key or a DESFire application,
+ * describe that in the match field, so the plugin isn't loaded for cards it can't parse.
  * Then, register the plugin in the `application.fam` file in the `nfc` directory. Use the existing
  * entries as an example. After being registered, the plugin will be automatically deployed with the application.
  *
@@ -27,6 +29,7 @@
 
 #include <nfc/nfc.h>
 #include <nfc/nfc_device.h>
+#include <nfc/protocols/mf_desfire/mf_desfire.h>
 
 /**
  * @brief Unique string identifier for supported card plugins.
@@ -36,7 +39,7 @@
 /**
  * @brief Currently supported plugin API version.
  */
-#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 1
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 2
 
 /**
  * @brief Verify that the card is of a supported type.
@@ -81,6 +84,23 @@ typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
  */
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
 
+/**
+ * @brief Cheap checks the card data must pass before parse() is worth calling.
+ *
+ * The application keeps these in its plugin index and skips plugins that can't match
+ * the card without loading them. Every check must be implied by the plugin's own parse()
+ * checks, otherwise a card it could parse will be skipped. Zeroed fields match any card.
+ * read() is not filtered, as there is no card data yet at the time of calling.
+ */
+typedef struct {
+    /** Allowed card types as (1 << type) bits of MfClassicType, MfUltralightType or St25tbType. */
+    uint32_t type_mask;
+    uint8_t uid_len; /**< Exact UID length in bytes. */
+    uint8_t key_a_sector; /**< MfClassic sector holding the key_a value in its trailer. */
+    const uint64_t* key_a; /**< MfClassic key A expected in the key_a_sector trailer. */
+    const MfDesfireApplicationId* desfire_app; /**< MfDesfire application the card must have. */
+} NfcSupportedCardPluginMatch;
+
 /**
  * @brief Supported card plugin interface.
  *
@@ -91,4 +111,5 @@ typedef struct {
     NfcSupportedCardPluginVerify verify; /**< Pointer to the verify() function. */
     NfcSupportedCardPluginRead read; /**< Pointer to the read() function. */
     NfcSupportedCardPluginParse parse; /**< Pointer to the parse() function. */
+    const NfcSupportedCardPluginMatch* match; /**< Optional fast-reject checks for parse(). */
 } NfcSupportedCardsPlugin;
@@ -213,11 +213,16 @@ static bool opal_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch opal_match = {
+    .desfire_app = &opal_app_id,
+};
+
 static const NfcSupportedCardsPlugin opal_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = opal_parse,
+    .match = &opal_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -237,11 +237,16 @@ static bool plantain_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch plantain_match = {
+    .type_mask = (1U << MfClassicType1k) | (1U << MfClassicType4k),
+};
+
 static const NfcSupportedCardsPlugin plantain_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = plantain_verify,
     .read = plantain_read,
     .parse = plantain_parse,
+    .match = &plantain_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -438,11 +438,16 @@ bool saflok_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch saflok_match = {
+    .type_mask = (1U << MfClassicType1k),
+};
+
 static const NfcSupportedCardsPlugin saflok_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = saflok_verify,
     .read = saflok_read,
     .parse = saflok_parse,
+    .match = &saflok_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -156,11 +156,17 @@ static bool skylanders_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch skylanders_match = {
+    .key_a_sector = 0,
+    .key_a = &skylanders_key,
+};
+
 static const NfcSupportedCardsPlugin skylanders_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = skylanders_verify,
     .read = skylanders_read,
     .parse = skylanders_parse,
+    .match = &skylanders_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
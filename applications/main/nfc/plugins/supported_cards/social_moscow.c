@@ -1165,11 +1165,16 @@ static bool social_moscow_parse(const NfcDevice* device, FuriString* parsed_data
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch social_moscow_match = {
+    .type_mask = (1U << MfClassicType1k) | (1U << MfClassicType4k),
+};
+
 static const NfcSupportedCardsPlugin social_moscow_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = social_moscow_verify,
     .read = social_moscow_read,
     .parse = social_moscow_parse,
+    .match = &social_moscow_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
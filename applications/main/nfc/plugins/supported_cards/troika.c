@@ -243,11 +243,16 @@ static bool troika_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch troika_match = {
+    .type_mask = (1U << MfClassicType1k) | (1U << MfClassicType4k),
+};
+
 static const NfcSupportedCardsPlugin troika_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = troika_verify,
     .read = troika_read,
     .parse = troika_parse,
+    .match = &troika_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
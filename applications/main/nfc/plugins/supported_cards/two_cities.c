@@ -170,11 +170,17 @@ static bool two_cities_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch two_cities_match = {
+    .key_a_sector = 4,
+    .key_a = &two_cities_4k_keys[4].a,
+};
+
 static const NfcSupportedCardsPlugin two_cities_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = two_cities_verify,
     .read = two_cities_read,
     .parse = two_cities_parse,
+    .match = &two_cities_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
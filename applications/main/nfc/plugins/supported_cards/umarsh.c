@@ -136,11 +136,16 @@ static bool umarsh_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch umarsh_match = {
+    .type_mask = (1U << MfClassicType1k),
+};
+
 static const NfcSupportedCardsPlugin umarsh_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = umarsh_parse,
+    .match = &umarsh_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -175,11 +175,17 @@ static bool washcity_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch washcity_match = {
+    .key_a_sector = 1,
+    .key_a = &washcity_1k_keys[1].a,
+};
+
 static const NfcSupportedCardsPlugin washcity_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = washcity_verify,
     .read = washcity_read,
     .parse = washcity_parse,
+    .match = &washcity_match,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -19,10 +19,12 @@ void nfc_scene_mf_classic_keys_on_enter(void* context) {
     flipper_dict_keys_total = keys_dict_get_total_keys(dict);
     keys_dict_free(dict);
 
-    // Load user dict keys total
+    // Load user dict keys total, without duplicates like in the keys list
     uint32_t user_dict_keys_total = 0;
     dict = keys_dict_alloc(
-        NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH,
+        KeysDictModeOpenAlways | KeysDictModeInMemory,
+        sizeof(MfClassicKey));
     user_dict_keys_total = keys_dict_get_total_keys(dict);
     keys_dict_free(dict);
 
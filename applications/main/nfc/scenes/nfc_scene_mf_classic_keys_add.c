@@ -30,7 +30,9 @@ bool nfc_scene_mf_classic_keys_add_on_event(void* context, SceneManagerEvent eve
         if(event.event == NfcCustomEventByteInputDone) {
             // Add key to dict
             KeysDict* dict = keys_dict_alloc(
-                NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+                NFC_APP_MF_CLASSIC_DICT_USER_PATH,
+                KeysDictModeOpenAlways | KeysDictModeInMemory,
+                sizeof(MfClassicKey));
 
             MfClassicKey key = {};
             memcpy(key.data, instance->byte_input_store, sizeof(MfClassicKey));
@@ -16,6 +16,7 @@ SubGhzGPS* subghz_gps_plugin_init(uint32_t baudrate) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperApplication* plugin_app = flipper_application_alloc(storage, firmware_api_interface);
+    flipper_application_set_load_cache(plugin_app, true);
     do {
         FlipperApplicationPreloadStatus preload_res = flipper_application_preload(
             plugin_app, EXT_PATH("apps_data/subghz_gps/plugins/subghz_gps.fal"));
@@ -39,6 +39,8 @@ SubGhzTxRx* subghz_txrx_alloc(void) {
 
     instance->worker = subghz_worker_alloc();
     instance->fff_data = flipper_format_string_alloc();
+    // Protocols read key fields in arbitrary order with rewinds
+    flipper_format_set_key_index(instance->fff_data, true);
 
     instance->environment = subghz_environment_alloc();
     instance->is_database_loaded =
@@ -56,6 +58,8 @@ SubGhzTxRx* subghz_txrx_alloc(void) {
         instance->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
     subghz_worker_set_pair_callback(
         instance->worker, (SubGhzWorkerPairCallback)subghz_receiver_decode);
+    subghz_worker_set_pair_batch_callback(
+        instance->worker, (SubGhzWorkerPairBatchCallback)subghz_receiver_decode_batch);
     subghz_worker_set_context(instance->worker, instance->receiver);
 
     //set default device External
@@ -9,6 +9,7 @@
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_binary.h>
 #include <lib/subghz/protocols/protocol_items.h>
 #include <applications/drivers/subghz/cc1101_ext/cc1101_ext_interconnect.h>
 #include <lib/subghz/devices/cc1101_int/cc1101_int_interconnect.h>
@@ -843,6 +844,8 @@ static void subghz_cli_command_print_usage(void) {
     printf("\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Receive\r\n");
     printf("\trx_raw <frequency:in Hz>\t - Receive RAW\r\n");
     printf("\tdecode_raw <file_name: path_RAW_file>\t - Testing\r\n");
+    printf(
+        "\tconvert_raw <path_RAW_file> <path_binary_RAW_file> <compress: 0 - no, 1 - yes>\t - Convert RAW file to binary\r\n");
     printf(
         "\ttx_from_file <file_name: path_file> <repeat: count> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Transmitting from file\r\n");
 
@@ -934,6 +937,48 @@ static void subghz_cli_command_encrypt_raw(Cli* cli, FuriString* args) {
     furi_string_free(source);
 }
 
+static void subghz_cli_command_convert_raw(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    int compress = 0;
+
+    FuriString* source = furi_string_alloc();
+    FuriString* destination = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, source)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        if(!args_read_string_and_trim(args, destination)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        if(furi_string_size(args) && !args_read_int_and_trim(args, &compress)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        bool converted = subghz_raw_binary_convert(
+            storage,
+            furi_string_get_cstr(source),
+            furi_string_get_cstr(destination),
+            compress == 1);
+        furi_record_close(RECORD_STORAGE);
+
+        if(!converted) {
+            printf("Failed to convert RAW file\r\n");
+            break;
+        }
+        printf("Converted to %s\r\n", furi_string_get_cstr(destination));
+    } while(false);
+
+    furi_string_free(destination);
+    furi_string_free(source);
+}
+
 static void subghz_cli_command_chat(Cli* cli, FuriString* args) {
     uint32_t frequency = 433920000;
     uint32_t device_ind = 0; // 0 - CC1101_INT, 1 - CC1101_EXT
@@ -1164,6 +1209,11 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "convert_raw") == 0) {
+            subghz_cli_command_convert_raw(cli, args);
+            break;
+        }
+
         if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
             if(furi_string_cmp_str(cmd, "encrypt_keeloq") == 0) {
                 subghz_cli_command_encrypt_keeloq(cli, args);
@@ -24,6 +24,7 @@
 #define SUBGHZ_LAST_SETTING_FIELD_ENABLE_SOUND      "Sound"
 #define SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE          "Autosave"
 #define SUBGHZ_LAST_SETTING_FIELD_HOPPING_THRESHOLD "HoppingThreshold"
+#define SUBGHZ_LAST_SETTING_FIELD_RAW_FORMAT        "RawFormat"
 
 SubGhzLastSettings* subghz_last_settings_alloc(void) {
     SubGhzLastSettings* instance = malloc(sizeof(SubGhzLastSettings));
@@ -51,6 +52,8 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    // Every missing field rewinds
+    flipper_format_set_key_index(fff_data_file, true);
 
     FuriString* temp_str = furi_string_alloc();
     uint32_t config_version = 0;
@@ -162,6 +165,13 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
                    1)) {
                 flipper_format_rewind(fff_data_file);
             }
+            if(!flipper_format_read_uint32(
+                   fff_data_file,
+                   SUBGHZ_LAST_SETTING_FIELD_RAW_FORMAT,
+                   &instance->raw_format,
+                   1)) {
+                flipper_format_rewind(fff_data_file);
+            }
         } while(0);
     } else {
         FURI_LOG_E(TAG, "Error open file %s", SUBGHZ_LAST_SETTINGS_PATH);
@@ -180,6 +190,10 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
     if(instance->preset_index > (uint32_t)preset_count - 1) {
         instance->preset_index = SUBGHZ_LAST_SETTING_DEFAULT_PRESET;
     }
+
+    if(instance->raw_format > SubGhzProtocolRawFormatBinaryCompressed) {
+        instance->raw_format = SubGhzProtocolRawFormatText;
+    }
 }
 
 bool subghz_last_settings_save(SubGhzLastSettings* instance) {
@@ -281,6 +295,10 @@ bool subghz_last_settings_save(SubGhzLastSettings* instance) {
                1)) {
             break;
         }
+        if(!flipper_format_write_uint32(
+               file, SUBGHZ_LAST_SETTING_FIELD_RAW_FORMAT, &instance->raw_format, 1)) {
+            break;
+        }
         saved = true;
     } while(0);
 
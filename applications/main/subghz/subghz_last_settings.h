@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <storage/storage.h>
 #include <lib/subghz/types.h>
+#include <lib/subghz/protocols/raw.h>
 
 #define SUBGHZ_LAST_SETTING_FREQUENCY_ANALYZER_TRIGGER        (-93.0f)
 // 1 = "AM650"
@@ -31,6 +32,7 @@ typedef struct {
     bool enable_sound;
     bool autosave;
     float hopping_threshold;
+    uint32_t raw_format; // SubGhzProtocolRawFormat, set in settings file only
 } SubGhzLastSettings;
 
 SubGhzLastSettings* subghz_last_settings_alloc(void);
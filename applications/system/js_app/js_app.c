@@ -1,5 +1,6 @@
 #include <dialogs/dialogs.h>
 #include "js_thread.h"
+#include "js_modules.h"
 #include <storage/storage.h>
 #include "js_app_i.h"
 #include <toolbox/path.h>
@@ -96,18 +97,22 @@ static void js_app_free(JsApp* app) {
 
 int32_t js_app(void* arg) {
     JsApp* app = js_app_alloc();
+    // Keep module images loaded while the user picks and runs scripts
+    js_modules_cache_acquire();
 
+    bool from_browser = (arg == NULL) || (strlen(arg) == 0);
     FuriString* script_path = furi_string_alloc_set(EXT_PATH("apps/Scripts"));
     do {
-        if(arg != NULL && strlen(arg) > 0) {
+        if(!from_browser) {
             furi_string_set(script_path, (const char*)arg);
         } else {
             DialogsFileBrowserOptions browser_options;
             dialog_file_browser_set_basic_options(&browser_options, ".js", &I_js_script_10px);
             DialogsApp* dialogs = furi_record_open(RECORD_DIALOGS);
-            if(!dialog_file_browser_show(dialogs, script_path, script_path, &browser_options))
-                break;
+            bool selected =
+                dialog_file_browser_show(dialogs, script_path, script_path, &browser_options);
             furi_record_close(RECORD_DIALOGS);
+            if(!selected) break;
         }
         FuriString* name = furi_string_alloc();
         path_extract_filename(script_path, name, false);
@@ -118,14 +123,16 @@ int32_t js_app(void* arg) {
         furi_string_free(name);
         furi_string_free(start_text);
 
+        view_dispatcher_switch_to_view(app->view_dispatcher, JsAppViewConsole);
         app->js_thread = js_thread_run(furi_string_get_cstr(script_path), js_callback, app);
         view_dispatcher_run(app->view_dispatcher);
 
         js_thread_stop(app->js_thread);
-    } while(0);
+    } while(from_browser);
 
     furi_string_free(script_path);
 
+    js_modules_cache_release();
     js_app_free(app);
     return 0;
 } //-V773
@@ -0,0 +1,158 @@
+#include "js_bcode_cache.h"
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+
+#define TAG "JsBcodeCache"
+
+// Absolute path is used to share the cache with CLI
+#define JS_BCODE_CACHE_DIR       EXT_PATH("apps_data/js_app/cache")
+#define JS_BCODE_CACHE_EXTENSION ".jsc"
+#define JS_BCODE_CACHE_MAGIC     0x43534A4D // "MJSC"
+#define JS_BCODE_CACHE_VERSION   1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t bcode_version; /**< MJS_BCODE_VERSION */
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t path_size; /**< Script path follows the header */
+    uint32_t bcode_size; /**< Bytecode follows the path */
+    uint32_t bcode_crc;
+} JsBcodeCacheHeader;
+
+struct JsBcodeCache {
+    Storage* storage;
+};
+
+JsBcodeCache* js_bcode_cache_alloc(void) {
+    JsBcodeCache* cache = malloc(sizeof(JsBcodeCache));
+    cache->storage = furi_record_open(RECORD_STORAGE);
+    return cache;
+}
+
+void js_bcode_cache_free(JsBcodeCache* cache) {
+    furi_check(cache);
+    furi_record_close(RECORD_STORAGE);
+    free(cache);
+}
+
+static FuriString* js_bcode_cache_get_path(const char* path) {
+    return furi_string_alloc_printf(
+        "%s/%08lX%s",
+        JS_BCODE_CACHE_DIR,
+        crc32_calc_buffer(0, path, strlen(path)),
+        JS_BCODE_CACHE_EXTENSION);
+}
+
+static bool js_bcode_cache_get_source_info(
+    JsBcodeCache* cache,
+    const char* path,
+    uint32_t* size,
+    uint32_t* crc) {
+    File* file = storage_file_alloc(cache->storage);
+    bool success = false;
+
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        *size = storage_file_size(file);
+        *crc = crc32_calc_file(file, NULL, NULL);
+        success = true;
+    }
+
+    storage_file_free(file);
+    return success;
+}
+
+char* js_bcode_cache_load(void* context, const char* path, size_t* size) {
+    furi_check(context);
+    JsBcodeCache* cache = context;
+    JsBcodeCacheHeader header;
+    uint32_t source_size = 0;
+    uint32_t source_crc = 0;
+    const size_t path_size = strlen(path);
+    char* cached_path = NULL;
+    char* bcode = NULL;
+    bool success = false;
+
+    FuriString* cache_path = js_bcode_cache_get_path(path);
+    File* file = storage_file_alloc(cache->storage);
+
+    do {
+        if(!js_bcode_cache_get_source_info(cache, path, &source_size, &source_crc)) break;
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != JS_BCODE_CACHE_MAGIC || header.version != JS_BCODE_CACHE_VERSION ||
+           header.bcode_version != MJS_BCODE_VERSION ||
+           header.source_size != source_size || header.source_crc != source_crc ||
+           header.path_size != path_size)
+            break;
+
+        cached_path = malloc(path_size);
+        if(storage_file_read(file, cached_path, path_size) != path_size) break;
+        if(memcmp(cached_path, path, path_size) != 0) break;
+
+        if(header.bcode_size > storage_file_size(file)) break;
+        bcode = malloc(header.bcode_size);
+        if(storage_file_read(file, bcode, header.bcode_size) != header.bcode_size) break;
+        if(crc32_calc_buffer(0, bcode, header.bcode_size) != header.bcode_crc) break;
+
+        *size = header.bcode_size;
+        success = true;
+    } while(false);
+
+    if(!success) {
+        free(bcode);
+        bcode = NULL;
+    }
+
+    free(cached_path);
+    storage_file_free(file);
+    furi_string_free(cache_path);
+
+    FURI_LOG_D(TAG, "%s: %s", path, success ? "hit" : "miss");
+    return bcode;
+}
+
+void js_bcode_cache_save(void* context, const char* path, const char* bcode, size_t size) {
+    furi_check(context);
+    JsBcodeCache* cache = context;
+    JsBcodeCacheHeader header = {
+        .magic = JS_BCODE_CACHE_MAGIC,
+        .version = JS_BCODE_CACHE_VERSION,
+        .bcode_version = MJS_BCODE_VERSION,
+        .path_size = strlen(path),
+        .bcode_size = size,
+        .bcode_crc = crc32_calc_buffer(0, bcode, size),
+    };
+    bool success = false;
+
+    FuriString* cache_path = js_bcode_cache_get_path(path);
+    File* file = storage_file_alloc(cache->storage);
+
+    do {
+        if(!js_bcode_cache_get_source_info(cache, path, &header.source_size, &header.source_crc))
+            break;
+
+        storage_simply_mkdir(cache->storage, "/ext/apps_data/js_app");
+        storage_simply_mkdir(cache->storage, JS_BCODE_CACHE_DIR);
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(file, path, header.path_size) != header.path_size) break;
+        if(storage_file_write(file, bcode, size) != size) break;
+
+        success = true;
+    } while(false);
+
+    storage_file_free(file);
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save bytecode for %s", path);
+        storage_simply_remove(cache->storage, furi_string_get_cstr(cache_path));
+    }
+    furi_string_free(cache_path);
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "js_thread_i.h"
+
+typedef struct JsBcodeCache JsBcodeCache;
+
+/**
+ * Allocate bytecode cache, attach it with mjs_set_bcode_cache():
+ * `mjs_set_bcode_cache(mjs, js_bcode_cache_load, js_bcode_cache_save, cache)`
+ * @return JsBcodeCache*
+ */
+JsBcodeCache* js_bcode_cache_alloc(void);
+
+/**
+ * Free bytecode cache
+ * @param cache
+ */
+void js_bcode_cache_free(JsBcodeCache* cache);
+
+/** mjs_bcode_load_t implementation, context is JsBcodeCache */
+char* js_bcode_cache_load(void* context, const char* path, size_t* size);
+
+/** mjs_bcode_save_t implementation, context is JsBcodeCache */
+void js_bcode_cache_save(void* context, const char* path, const char* bcode, size_t size);
@@ -2,11 +2,16 @@
 #include "js_modules.h"
 #include <m-dict.h>
 #include "modules/js_flipper.h"
+#include "plugin_api/app_api_interface.h"
+#include <loader/firmware_api/firmware_api.h>
+#include <storage/storage.h>
 
 #define TAG "JS modules"
 
 // Absolute path is used to make possible plugin load from CLI
-#define MODULES_PATH "/ext/apps_data/js_app/plugins"
+#define MODULES_PATH  "/ext/apps_data/js_app/plugins"
+#define MODULE_PREFIX "js_"
+#define MODULE_SUFFIX ".fal"
 
 typedef struct {
     JsModeConstructor create;
@@ -20,19 +25,147 @@ static const JsModuleDescriptor modules_builtin[] = {
     {"flipper", js_flipper_create, NULL},
 };
 
+typedef enum {
+    JsModuleImageStateIndexed,
+    JsModuleImageStateLoaded,
+    JsModuleImageStateFailed,
+} JsModuleImageState;
+
+typedef struct {
+    JsModuleImageState state;
+    uint32_t plugin_index;
+} JsModuleImage;
+
+DICT_DEF2(JsModuleIndex, FuriString*, FURI_STRING_OPLIST, JsModuleImage, M_POD_OPLIST);
+
+/**
+ * Module images shared by every script run in a session
+ * The index of available modules is built from one scan of MODULES_PATH, loaded images
+ * (and failed loads) stay here until the last reference is released
+ */
+typedef struct {
+    CompositeApiResolver* resolver;
+    PluginManager* plugin_manager;
+    JsModuleIndex_t index;
+    bool index_ready;
+} JsModuleCache;
+
+static JsModuleCache* module_cache = NULL;
+static size_t module_cache_refs = 0;
+
 struct JsModules {
     struct mjs* mjs;
     JsModuleDict_t module_dict;
-    PluginManager* plugin_manager;
+    JsModuleCache* cache;
 };
 
-JsModules* js_modules_create(struct mjs* mjs, CompositeApiResolver* resolver) {
+void js_modules_cache_acquire(void) {
+    if(module_cache_refs++ > 0) {
+        return;
+    }
+
+    module_cache = malloc(sizeof(JsModuleCache));
+    module_cache->resolver = composite_api_resolver_alloc();
+    composite_api_resolver_add(module_cache->resolver, firmware_api_interface);
+    composite_api_resolver_add(module_cache->resolver, application_api_interface);
+
+    module_cache->plugin_manager = plugin_manager_alloc(
+        PLUGIN_APP_ID, PLUGIN_API_VERSION, composite_api_resolver_get(module_cache->resolver));
+    plugin_manager_set_load_cache(module_cache->plugin_manager, true);
+
+    JsModuleIndex_init(module_cache->index);
+    module_cache->index_ready = false;
+}
+
+void js_modules_cache_release(void) {
+    furi_check(module_cache_refs > 0);
+    if(--module_cache_refs > 0) {
+        return;
+    }
+
+    plugin_manager_free(module_cache->plugin_manager);
+    composite_api_resolver_free(module_cache->resolver);
+    JsModuleIndex_clear(module_cache->index);
+    free(module_cache);
+    module_cache = NULL;
+}
+
+static void js_modules_cache_build_index(JsModuleCache* cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* directory = storage_file_alloc(storage);
+    char file_name[64];
+    FuriString* module_name = furi_string_alloc();
+
+    if(storage_dir_open(directory, MODULES_PATH)) {
+        FileInfo file_info;
+        while(storage_dir_read(directory, &file_info, file_name, sizeof(file_name))) {
+            if(file_info_is_dir(&file_info)) continue;
+
+            furi_string_set(module_name, file_name);
+            if(!furi_string_start_with_str(module_name, MODULE_PREFIX) ||
+               !furi_string_end_with_str(module_name, MODULE_SUFFIX)) {
+                continue;
+            }
+            furi_string_mid(
+                module_name,
+                strlen(MODULE_PREFIX),
+                furi_string_size(module_name) - strlen(MODULE_PREFIX) - strlen(MODULE_SUFFIX));
+
+            JsModuleImage image = {.state = JsModuleImageStateIndexed};
+            JsModuleIndex_set_at(cache->index, module_name, image);
+        }
+    }
+    FURI_LOG_I(TAG, "Indexed %zu external modules", JsModuleIndex_size(cache->index));
+
+    furi_string_free(module_name);
+    storage_dir_close(directory);
+    storage_file_free(directory);
+    furi_record_close(RECORD_STORAGE);
+
+    cache->index_ready = true;
+}
+
+static const JsModuleDescriptor*
+    js_modules_cache_get(JsModuleCache* cache, FuriString* module_name) {
+    if(!cache->index_ready) {
+        js_modules_cache_build_index(cache);
+    }
+
+    JsModuleImage* image = JsModuleIndex_get(cache->index, module_name);
+    if(!image) {
+        FURI_LOG_E(TAG, "Module %s is not installed", furi_string_get_cstr(module_name));
+        return NULL;
+    }
+
+    if(image->state == JsModuleImageStateIndexed) {
+        FuriString* module_path = furi_string_alloc_printf(
+            "%s/" MODULE_PREFIX "%s" MODULE_SUFFIX,
+            MODULES_PATH,
+            furi_string_get_cstr(module_name));
+        FURI_LOG_I(TAG, "Loading external module %s", furi_string_get_cstr(module_path));
+
+        image->plugin_index = plugin_manager_get_count(cache->plugin_manager);
+        PluginManagerError load_error =
+            plugin_manager_load_single(cache->plugin_manager, furi_string_get_cstr(module_path));
+        image->state = (load_error == PluginManagerErrorNone) ? JsModuleImageStateLoaded :
+                                                                JsModuleImageStateFailed;
+        furi_string_free(module_path);
+    }
+
+    if(image->state != JsModuleImageStateLoaded) {
+        return NULL;
+    }
+
+    return plugin_manager_get_ep(cache->plugin_manager, image->plugin_index);
+}
+
+JsModules* js_modules_create(struct mjs* mjs) {
     JsModules* modules = malloc(sizeof(JsModules));
     modules->mjs = mjs;
     JsModuleDict_init(modules->module_dict);
 
-    modules->plugin_manager = plugin_manager_alloc(
-        PLUGIN_APP_ID, PLUGIN_API_VERSION, composite_api_resolver_get(resolver));
+    js_modules_cache_acquire();
+    modules->cache = module_cache;
 
     return modules;
 }
@@ -46,8 +179,8 @@ void js_modules_destroy(JsModules* modules) {
             module_itref->value.destroy(module_itref->value.context);
         }
     }
-    plugin_manager_free(modules->plugin_manager);
     JsModuleDict_clear(modules->module_dict);
+    js_modules_cache_release();
     free(modules);
 }
 
@@ -83,30 +216,16 @@ mjs_val_t js_module_require(JsModules* modules, const char* name, size_t name_le
 
     // External module load
     if(!module_found) {
-        FuriString* module_path = furi_string_alloc();
-        furi_string_printf(module_path, "%s/js_%s.fal", MODULES_PATH, name);
-        FURI_LOG_I(TAG, "Loading external module %s", furi_string_get_cstr(module_path));
-        do {
-            uint32_t plugin_cnt_last = plugin_manager_get_count(modules->plugin_manager);
-            PluginManagerError load_error = plugin_manager_load_single(
-                modules->plugin_manager, furi_string_get_cstr(module_path));
-            if(load_error != PluginManagerErrorNone) {
-                break;
-            }
-            const JsModuleDescriptor* plugin =
-                plugin_manager_get_ep(modules->plugin_manager, plugin_cnt_last);
-            furi_assert(plugin);
-
-            if(strncmp(name, plugin->name, name_len) != 0) {
+        const JsModuleDescriptor* plugin = js_modules_cache_get(modules->cache, module_name);
+        if(plugin) {
+            if(strncmp(name, plugin->name, name_len) == 0) {
+                JsModuleData module = {.create = plugin->create, .destroy = plugin->destroy};
+                JsModuleDict_set_at(modules->module_dict, module_name, module);
+                module_found = true;
+            } else {
                 FURI_LOG_E(TAG, "Module name missmatch %s", plugin->name);
-                break;
             }
-            JsModuleData module = {.create = plugin->create, .destroy = plugin->destroy};
-            JsModuleDict_set_at(modules->module_dict, module_name, module);
-
-            module_found = true;
-        } while(0);
-        furi_string_free(module_path);
+        }
     }
 
     // Run module constructor
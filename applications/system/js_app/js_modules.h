@@ -18,7 +18,20 @@ typedef struct {
 
 typedef struct JsModules JsModules;
 
-JsModules* js_modules_create(struct mjs* mjs, CompositeApiResolver* resolver);
+/**
+ * @brief Keeps loaded module images and the module index alive between script runs
+ * Every js_modules_create holds its own reference, take an extra one to share the
+ * images across several runs. Reference counting is not atomic: take the reference
+ * before starting a script thread and drop it after the thread has stopped
+ */
+void js_modules_cache_acquire(void);
+
+/**
+ * @brief Releases module cache reference, unloads module images when it was the last one
+ */
+void js_modules_cache_release(void);
+
+JsModules* js_modules_create(struct mjs* mjs);
 
 void js_modules_destroy(JsModules* modules);
 
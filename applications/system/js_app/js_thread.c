@@ -9,6 +9,7 @@
 #include "js_thread.h"
 #include "js_thread_i.h"
 #include "js_modules.h"
+#include "js_bcode_cache.h"
 
 #define TAG "JS"
 
@@ -154,10 +155,35 @@ static void js_delay(struct mjs* mjs) {
         mjs_return(mjs, MJS_UNDEFINED);
         return;
     }
-    js_delay_with_flags(mjs, ms);
+
+    // Collect while the script sleeps anyway, instead of in the middle of its next frame
+    uint32_t start = furi_get_tick();
+    mjs_gc_idle(mjs);
+    uint32_t elapsed = furi_get_tick() - start;
+
+    js_delay_with_flags(mjs, (uint32_t)ms > elapsed ? (uint32_t)ms - elapsed : 0);
     mjs_return(mjs, MJS_UNDEFINED);
 }
 
+static void js_gc_stats(struct mjs* mjs) {
+    struct mjs_gc_stats stats;
+    mjs_gc_get_stats(mjs, &stats);
+
+    double tick_ms = 1000.0 / furi_kernel_get_tick_frequency();
+    mjs_val_t stats_obj = mjs_mk_object(mjs);
+    mjs_set(mjs, stats_obj, "collections", ~0, mjs_mk_number(mjs, stats.collections));
+    mjs_set(mjs, stats_obj, "idleCollections", ~0, mjs_mk_number(mjs, stats.idle_collections));
+    mjs_set(mjs, stats_obj, "lastPauseMs", ~0, mjs_mk_number(mjs, stats.last_pause * tick_ms));
+    mjs_set(mjs, stats_obj, "maxPauseMs", ~0, mjs_mk_number(mjs, stats.max_pause * tick_ms));
+    mjs_set(mjs, stats_obj, "totalPauseMs", ~0, mjs_mk_number(mjs, stats.total_pause * tick_ms));
+    mjs_set(mjs, stats_obj, "objects", ~0, mjs_mk_number(mjs, stats.objects));
+    mjs_set(mjs, stats_obj, "objectCells", ~0, mjs_mk_number(mjs, stats.object_cells));
+    mjs_set(mjs, stats_obj, "properties", ~0, mjs_mk_number(mjs, stats.properties));
+    mjs_set(mjs, stats_obj, "propertyCells", ~0, mjs_mk_number(mjs, stats.property_cells));
+    mjs_set(mjs, stats_obj, "stringsSize", ~0, mjs_mk_number(mjs, stats.strings_size));
+    mjs_return(mjs, stats_obj);
+}
+
 static void* js_dlsym(void* handle, const char* name) {
     CompositeApiResolver* resolver = handle;
     Elf32_Addr addr = 0;
@@ -318,7 +344,7 @@ static int32_t js_thread(void* arg) {
     composite_api_resolver_add(worker->resolver, application_api_interface);
 
     struct mjs* mjs = mjs_create(worker);
-    worker->modules = js_modules_create(mjs, worker->resolver);
+    worker->modules = js_modules_create(mjs);
     mjs_val_t global = mjs_get_global(mjs);
     if(worker->path) {
         FuriString* dirpath = furi_string_alloc();
@@ -347,6 +373,7 @@ static int32_t js_thread(void* arg) {
     mjs_set(mjs, global, "parse_int", ~0, MJS_MK_FN(js_parse_int));
     mjs_set(mjs, global, "to_upper_case", ~0, MJS_MK_FN(js_to_upper_case));
     mjs_set(mjs, global, "to_lower_case", ~0, MJS_MK_FN(js_to_lower_case));
+    mjs_set(mjs, global, "gc_stats", ~0, MJS_MK_FN(js_gc_stats));
 
     mjs_val_t console_obj = mjs_mk_object(mjs);
     mjs_set(mjs, console_obj, "log", ~0, MJS_MK_FN(js_console_log));
@@ -359,6 +386,9 @@ static int32_t js_thread(void* arg) {
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
 
+    JsBcodeCache* bcode_cache = js_bcode_cache_alloc();
+    mjs_set_bcode_cache(mjs, js_bcode_cache_load, js_bcode_cache_save, bcode_cache);
+
     mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
 
 #ifdef JS_DEBUG
@@ -402,6 +432,7 @@ static int32_t js_thread(void* arg) {
 
     js_modules_destroy(worker->modules);
     mjs_destroy(mjs);
+    js_bcode_cache_free(bcode_cache);
 
     composite_api_resolver_free(worker->resolver);
 
@@ -62,10 +62,7 @@ static void js_blebeacon_set_config(struct mjs* mjs) {
     size_t mac_len = 0;
     mjs_val_t mac_arg = mjs_arg(mjs, 0);
     if(mjs_is_typed_array(mac_arg)) {
-        if(mjs_is_data_view(mac_arg)) {
-            mac_arg = mjs_dataview_get_buf(mjs, mac_arg);
-        }
-        mac = mjs_array_buf_get_ptr(mjs, mac_arg, &mac_len);
+        mac = mjs_typed_array_get_ptr(mjs, mac_arg, &mac_len);
     }
     if(!mac || mac_len != EXTRA_BEACON_MAC_ADDR_SIZE) {
         ret_bad_args(mjs, "Wrong MAC address");
@@ -128,10 +125,7 @@ static void js_blebeacon_set_data(struct mjs* mjs) {
     size_t data_len = 0;
     mjs_val_t data_arg = mjs_arg(mjs, 0);
     if(mjs_is_typed_array(data_arg)) {
-        if(mjs_is_data_view(data_arg)) {
-            data_arg = mjs_dataview_get_buf(mjs, data_arg);
-        }
-        data = mjs_array_buf_get_ptr(mjs, data_arg, &data_len);
+        data = mjs_typed_array_get_ptr(mjs, data_arg, &data_len);
     }
     if(!data) {
         ret_bad_args(mjs, "Data must be a Uint8Array");
@@ -126,11 +126,8 @@ static void js_keyboard_byte(struct mjs* mjs) {
 
     mjs_val_t default_data_arg = mjs_arg(mjs, 1);
     if(mjs_is_typed_array(default_data_arg)) {
-        if(mjs_is_data_view(default_data_arg)) {
-            default_data_arg = mjs_dataview_get_buf(mjs, default_data_arg);
-        }
         size_t default_data_len = 0;
-        char* default_data = mjs_array_buf_get_ptr(mjs, default_data_arg, &default_data_len);
+        char* default_data = mjs_typed_array_get_ptr(mjs, default_data_arg, &default_data_len);
         memcpy(buffer, (uint8_t*)default_data, MIN((size_t)input_length, default_data_len));
     }
 
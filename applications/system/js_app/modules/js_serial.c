@@ -184,12 +184,8 @@ static void js_serial_write(struct mjs* mjs) {
                 break;
             }
         } else if(mjs_is_typed_array(arg)) {
-            mjs_val_t array_buf = arg;
-            if(mjs_is_data_view(arg)) {
-                array_buf = mjs_dataview_get_buf(mjs, arg);
-            }
             size_t len = 0;
-            char* buf = mjs_array_buf_get_ptr(mjs, array_buf, &len);
+            char* buf = mjs_typed_array_get_ptr(mjs, arg, &len);
             furi_hal_serial_tx(serial->serial_handle, (uint8_t*)buf, len);
         } else {
             args_correct = false;
@@ -371,15 +367,61 @@ static void js_serial_read_bytes(struct mjs* mjs) {
         return;
     }
 
-    char* read_buf = malloc(read_len);
+    // Receive straight into the ArrayBuffer, without a temporary copy
+    mjs_val_t return_obj = mjs_mk_array_buf(mjs, NULL, read_len);
+    char* read_buf = mjs_array_buf_get_ptr(mjs, return_obj, NULL);
     size_t bytes_read = js_serial_receive(serial, read_buf, read_len, timeout);
 
-    mjs_val_t return_obj = MJS_UNDEFINED;
-    if(bytes_read > 0) {
-        return_obj = mjs_mk_array_buf(mjs, read_buf, bytes_read);
+    mjs_array_buf_truncate(mjs, return_obj, bytes_read);
+    if(bytes_read == 0) {
+        return_obj = MJS_UNDEFINED;
     }
     mjs_return(mjs, return_obj);
-    free(read_buf);
+}
+
+static void js_serial_read_into(struct mjs* mjs) {
+    mjs_val_t obj_inst = mjs_get(mjs, mjs_get_this(mjs), INST_PROP_NAME, ~0);
+    JsSerialInst* serial = mjs_get_ptr(mjs, obj_inst);
+    furi_assert(serial);
+    if(!serial->setup_done) {
+        mjs_prepend_errorf(mjs, MJS_INTERNAL_ERROR, "Serial is not configured");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    // Fills a buffer the script reuses, so streaming allocates nothing per read
+    char* read_buf = NULL;
+    size_t read_len = 0;
+    uint32_t timeout = FuriWaitForever;
+
+    do {
+        size_t num_args = mjs_nargs(mjs);
+        if(num_args < 1 || num_args > 2) {
+            break;
+        }
+        mjs_val_t buf_arg = mjs_arg(mjs, 0);
+        if(!mjs_is_typed_array(buf_arg)) {
+            break;
+        }
+        read_buf = mjs_typed_array_get_ptr(mjs, buf_arg, &read_len);
+        if(num_args == 2) {
+            mjs_val_t timeout_arg = mjs_arg(mjs, 1);
+            if(!mjs_is_number(timeout_arg)) {
+                read_buf = NULL;
+                break;
+            }
+            timeout = mjs_get_int32(mjs, timeout_arg);
+        }
+    } while(0);
+
+    if(read_buf == NULL || read_len == 0) {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    size_t bytes_read = js_serial_receive(serial, read_buf, read_len, timeout);
+    mjs_return(mjs, mjs_mk_number(mjs, bytes_read));
 }
 
 static char* js_serial_receive_any(JsSerialInst* serial, size_t* len, uint32_t timeout) {
@@ -669,6 +711,7 @@ static void* js_serial_create(struct mjs* mjs, mjs_val_t* object) {
     mjs_set(mjs, serial_obj, "read", ~0, MJS_MK_FN(js_serial_read));
     mjs_set(mjs, serial_obj, "readln", ~0, MJS_MK_FN(js_serial_readln));
     mjs_set(mjs, serial_obj, "readBytes", ~0, MJS_MK_FN(js_serial_read_bytes));
+    mjs_set(mjs, serial_obj, "readInto", ~0, MJS_MK_FN(js_serial_read_into));
     mjs_set(mjs, serial_obj, "readAny", ~0, MJS_MK_FN(js_serial_read_any));
     mjs_set(mjs, serial_obj, "expect", ~0, MJS_MK_FN(js_serial_expect));
     *object = serial_obj;
@@ -77,14 +77,16 @@ static void js_storage_read(struct mjs* mjs) {
             break;
         }
 
-        uint8_t* data = malloc(size);
+        // Read straight into the ArrayBuffer, without a temporary copy
+        mjs_val_t data_obj = mjs_mk_array_buf(mjs, NULL, size);
+        char* data = mjs_array_buf_get_ptr(mjs, data_obj, NULL);
         size_t read = storage_file_read(file, data, size);
         if(read == size) {
-            mjs_return(mjs, mjs_mk_array_buf(mjs, (char*)data, size));
+            mjs_return(mjs, data_obj);
         } else {
+            mjs_array_buf_truncate(mjs, data_obj, 0);
             ret_int_err(mjs, "File read failed");
         }
-        free(data);
     } while(0);
     storage_file_free(file);
 }
@@ -100,15 +102,12 @@ static void js_storage_write(struct mjs* mjs) {
         ret_bad_args(mjs, "Data must be string, arraybuf or dataview");
         return;
     }
-    if(mjs_is_data_view(data_arg)) {
-        data_arg = mjs_dataview_get_buf(mjs, data_arg);
-    }
     size_t data_len = 0;
     const char* data = NULL;
     if(mjs_is_string(data_arg)) {
         data = mjs_get_string(mjs, &data_arg, &data_len);
     } else if(mjs_is_typed_array(data_arg)) {
-        data = mjs_array_buf_get_ptr(mjs, data_arg, &data_len);
+        data = mjs_typed_array_get_ptr(mjs, data_arg, &data_len);
     }
 
     mjs_val_t seek_arg = mjs_arg(mjs, 2);
@@ -144,15 +143,12 @@ static void js_storage_append(struct mjs* mjs) {
         ret_bad_args(mjs, "Data must be string, arraybuf or dataview");
         return;
     }
-    if(mjs_is_data_view(data_arg)) {
-        data_arg = mjs_dataview_get_buf(mjs, data_arg);
-    }
     size_t data_len = 0;
     const char* data = NULL;
     if(mjs_is_string(data_arg)) {
         data = mjs_get_string(mjs, &data_arg, &data_len);
     } else if(mjs_is_typed_array(data_arg)) {
-        data = mjs_array_buf_get_ptr(mjs, data_arg, &data_len);
+        data = mjs_typed_array_get_ptr(mjs, data_arg, &data_len);
     }
 
     File* file = storage_file_alloc(storage->api);
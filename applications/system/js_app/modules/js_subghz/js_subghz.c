@@ -433,6 +433,114 @@ static void js_subghz_transmit_file(struct mjs* mjs) {
     }
 }
 
+typedef struct {
+    const char* pulses;
+    size_t count;
+    size_t index;
+} JsSubghzRawTx;
+
+static LevelDuration js_subghz_raw_tx_yield(void* context) {
+    JsSubghzRawTx* tx = context;
+
+    while(tx->index < tx->count) {
+        int32_t duration;
+        memcpy(&duration, tx->pulses + tx->index * sizeof(duration), sizeof(duration));
+        tx->index++;
+        if(duration != 0) {
+            return level_duration_make(duration > 0, duration > 0 ? duration : -duration);
+        }
+    }
+
+    return level_duration_reset();
+}
+
+static void js_subghz_transmit_raw(struct mjs* mjs) {
+    mjs_val_t obj_inst = mjs_get(mjs, mjs_get_this(mjs), INST_PROP_NAME, ~0);
+    JsSubghzInst* js_subghz = mjs_get_ptr(mjs, obj_inst);
+    furi_assert(js_subghz);
+
+    if(!js_subghz->radio_device) {
+        mjs_prepend_errorf(mjs, MJS_INTERNAL_ERROR, "Radio is not setup");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    // Pulses are sent straight from the array: positive durations are high, negative low
+    mjs_val_t pulses_arg = mjs_arg(mjs, 0);
+    if(!mjs_is_data_view(pulses_arg) ||
+       mjs_dataview_get_type(mjs, pulses_arg) != MJS_DATAVIEW_I32) {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "Pulses must be an Int32Array");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+    size_t pulses_len = 0;
+    JsSubghzRawTx tx = {
+        .pulses = mjs_typed_array_get_ptr(mjs, pulses_arg, &pulses_len),
+    };
+    tx.count = pulses_len / sizeof(int32_t);
+
+    FuriHalSubGhzPreset preset = FuriHalSubGhzPresetOok650Async;
+    mjs_val_t preset_arg = mjs_arg(mjs, 1);
+    if(mjs_is_string(preset_arg)) {
+        preset = js_subghz_get_preset_name(mjs_get_string(mjs, &preset_arg, NULL));
+        if(preset == FuriHalSubGhzPresetIDLE || preset == FuriHalSubGhzPresetCustom) {
+            mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "Unknown preset");
+            mjs_return(mjs, MJS_UNDEFINED);
+            return;
+        }
+    }
+
+    uint32_t repeat = 1;
+    mjs_val_t repeat_arg = mjs_arg(mjs, 2);
+    if(mjs_is_number(repeat_arg)) {
+        int32_t repeat_val = mjs_get_int32(mjs, repeat_arg);
+        repeat = MAX(repeat_val, 1);
+    }
+
+    if(subghz_devices_check_tx(js_subghz->radio_device, js_subghz->frequency) !=
+       SubGhzTxAllowed) {
+        mjs_prepend_errorf(mjs, MJS_INTERNAL_ERROR, "Unsupported frequency");
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
+    subghz_devices_reset(js_subghz->radio_device);
+    subghz_devices_idle(js_subghz->radio_device);
+    subghz_devices_load_preset(js_subghz->radio_device, preset, NULL);
+    js_subghz->frequency =
+        subghz_devices_set_frequency(js_subghz->radio_device, js_subghz->frequency);
+
+    if(!js_subghz->is_external) {
+        furi_hal_power_suppress_charge_enter();
+    }
+    subghz_devices_set_tx(js_subghz->radio_device);
+
+    bool is_sent = false;
+    while(repeat--) {
+        tx.index = 0;
+        if(!subghz_devices_start_async_tx(
+               js_subghz->radio_device, js_subghz_raw_tx_yield, &tx)) {
+            is_sent = false;
+            mjs_prepend_errorf(mjs, MJS_INTERNAL_ERROR, "Failed to start async tx");
+            break;
+        }
+        while(!subghz_devices_is_async_complete_tx(js_subghz->radio_device)) {
+            furi_delay_ms(10);
+        }
+        subghz_devices_stop_async_tx(js_subghz->radio_device);
+        is_sent = true;
+    }
+
+    if(!js_subghz->is_external) {
+        furi_hal_power_suppress_charge_exit();
+    }
+
+    subghz_devices_idle(js_subghz->radio_device);
+    js_subghz->state = JsSubghzRadioStateIDLE;
+
+    mjs_return(mjs, is_sent ? mjs_mk_boolean(mjs, true) : MJS_UNDEFINED);
+}
+
 static void js_subghz_setup(struct mjs* mjs) {
     mjs_val_t obj_inst = mjs_get(mjs, mjs_get_this(mjs), INST_PROP_NAME, ~0);
     JsSubghzInst* js_subghz = mjs_get_ptr(mjs, obj_inst);
@@ -501,6 +609,7 @@ static void* js_subghz_create(struct mjs* mjs, mjs_val_t* object) {
     mjs_set(mjs, subghz_obj, "setFrequency", ~0, MJS_MK_FN(js_subghz_set_frequency));
     mjs_set(mjs, subghz_obj, "isExternal", ~0, MJS_MK_FN(js_subghz_is_external));
     mjs_set(mjs, subghz_obj, "transmitFile", ~0, MJS_MK_FN(js_subghz_transmit_file));
+    mjs_set(mjs, subghz_obj, "transmitRaw", ~0, MJS_MK_FN(js_subghz_transmit_raw));
 
     *object = subghz_obj;
 
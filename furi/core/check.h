@@ -40,6 +40,17 @@ FURI_NORETURN void __furi_crash_implementation(void);
 /** Halt system */
 FURI_NORETURN void __furi_halt_implementation(void);
 
+#ifdef FURI_HOST
+/** Host build: crash system with message, message is passed as a regular argument */
+FURI_NORETURN void __furi_crash_host(const void* message);
+
+/** Host build: halt system with message, message is passed as a regular argument */
+FURI_NORETURN void __furi_halt_host(const void* message);
+
+#define __furi_crash(message) __furi_crash_host((const void*)(message))
+
+#define __furi_halt(message) __furi_halt_host((const void*)(message))
+#else
 /** Crash system with message. Show message after reboot. */
 #define __furi_crash(message)                                 \
     do {                                                      \
@@ -48,12 +59,6 @@ FURI_NORETURN void __furi_halt_implementation(void);
         __furi_crash_implementation();                        \
     } while(0)
 
-/** Crash system
- *
- * @param      ... optional  message (const char*)
- */
-#define furi_crash(...) M_APPLY(__furi_crash, M_IF_EMPTY(__VA_ARGS__)((NULL), (__VA_ARGS__)))
-
 /** Halt system with message. */
 #define __furi_halt(message)                                  \
     do {                                                      \
@@ -61,6 +66,13 @@ FURI_NORETURN void __furi_halt_implementation(void);
         asm volatile("sukima%=:" : : "r"(r12));               \
         __furi_halt_implementation();                         \
     } while(0)
+#endif
+
+/** Crash system
+ *
+ * @param      ... optional  message (const char*)
+ */
+#define furi_crash(...) M_APPLY(__furi_crash, M_IF_EMPTY(__VA_ARGS__)((NULL), (__VA_ARGS__)))
 
 /** Halt system
  *
@@ -108,12 +120,21 @@ FURI_NORETURN void __furi_halt_implementation(void);
 #define furi_assert(...) \
     M_APPLY(__furi_assert, M_DEFAULT_ARGS(2, (__FURI_ASSERT_MESSAGE_FLAG), __VA_ARGS__))
 
+#ifdef FURI_HOST
+#define furi_break(__e)       \
+    do {                      \
+        if(!(__e)) {          \
+            __builtin_trap(); \
+        }                     \
+    } while(0)
+#else
 #define furi_break(__e)             \
     do {                            \
         if(!(__e)) {                \
             asm volatile("bkpt 0"); \
         }                           \
     } while(0)
+#endif
 
 #ifdef __cplusplus
 }
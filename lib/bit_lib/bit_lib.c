@@ -1,16 +1,79 @@
 #include "bit_lib.h"
 #include <core/check.h>
+#include <core/common_defines.h>
 #include <stdio.h>
+#include <string.h>
+
+// Big endian word access, bit 0 of the array is the MSB of the first byte
+static inline uint32_t bit_lib_load_32(const uint8_t* data) {
+    return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+}
+
+static inline void bit_lib_store_32(uint8_t* data, uint32_t word) {
+    data[0] = word >> 24;
+    data[1] = word >> 16;
+    data[2] = word >> 8;
+    data[3] = word;
+}
 
 void bit_lib_push_bit(uint8_t* data, size_t data_size, bool bit) {
     size_t last_index = data_size - 1;
+    size_t i = 0;
 
-    for(size_t i = 0; i < last_index; ++i) {
+    // shift a whole word at once, carrying in the MSB of the byte that follows it
+    for(; i + sizeof(uint32_t) <= last_index; i += sizeof(uint32_t)) {
+        uint32_t word = bit_lib_load_32(&data[i]);
+        bit_lib_store_32(&data[i], (word << 1) | (data[i + sizeof(uint32_t)] >> 7));
+    }
+    for(; i < last_index; ++i) {
         data[i] = (data[i] << 1) | ((data[i + 1] >> 7) & 1);
     }
     data[last_index] = (data[last_index] << 1) | bit;
 }
 
+void bit_lib_ring_push_bit(uint8_t* data, size_t length, size_t* head, bool bit) {
+    // the slot of the oldest bit becomes the newest one, in both copies
+    bit_lib_set_bit(data, *head, bit);
+    bit_lib_set_bit(data, *head + length, bit);
+    if(++(*head) == length) {
+        *head = 0;
+    }
+}
+
+void bit_lib_ring_init(BitLibRing* ring, uint8_t* data, size_t length) {
+    memset(data, 0, BIT_LIB_RING_SIZE(length));
+    ring->data = data;
+    ring->length = length;
+    ring->head = 0;
+}
+
+void bit_lib_ring_push(BitLibRing* ring, bool bit) {
+    bit_lib_ring_push_bit(ring->data, ring->length, &ring->head, bit);
+}
+
+void bit_lib_ring_copy(const BitLibRing* ring, uint8_t* frame) {
+    bit_lib_copy_bits(frame, 0, ring->length, ring->data, ring->head);
+}
+
+bool bit_lib_ring_copy_if(
+    const BitLibRing* ring,
+    uint8_t* frame,
+    uint8_t prefix_bits,
+    uint64_t expected,
+    size_t second_offset) {
+    furi_check(prefix_bits <= 64);
+    furi_check(second_offset + prefix_bits <= ring->length);
+
+    if(bit_lib_get_bits_64(ring->data, ring->head, prefix_bits) != expected) return false;
+    if(second_offset &&
+       bit_lib_get_bits_64(ring->data, ring->head + second_offset, prefix_bits) != expected) {
+        return false;
+    }
+
+    bit_lib_ring_copy(ring, frame);
+    return true;
+}
+
 void bit_lib_set_bit(uint8_t* data, size_t position, bool bit) {
     if(bit) {
         data[position / 8] |= 1UL << (7 - (position % 8));
@@ -23,9 +86,15 @@ void bit_lib_set_bits(uint8_t* data, size_t position, uint8_t byte, uint8_t leng
     furi_check(length <= 8);
     furi_check(length > 0);
 
-    for(uint8_t i = 0; i < length; ++i) {
-        uint8_t shift = (length - 1) - i;
-        bit_lib_set_bit(data, position + i, (byte >> shift) & 1); //-V610
+    // place the bits into a 16 bit window starting at the first affected byte
+    const uint8_t shift = 16 - length - (position % 8);
+    const uint16_t mask = ((1U << length) - 1) << shift;
+    const uint16_t value = ((uint16_t)byte << shift) & mask;
+    uint8_t* bytes = &data[position / 8];
+
+    bytes[0] = (bytes[0] & ~(mask >> 8)) | (value >> 8);
+    if(mask & 0xFF) {
+        bytes[1] = (bytes[1] & ~mask) | value;
     }
 }
 
@@ -34,99 +103,43 @@ bool bit_lib_get_bit(const uint8_t* data, size_t position) {
 }
 
 uint8_t bit_lib_get_bits(const uint8_t* data, size_t position, uint8_t length) {
-    uint8_t shift = position % 8;
-    if(shift == 0) {
-        return data[position / 8] >> (8 - length);
-    } else {
-        // TODO FL-3534: fix read out of bounds
-        uint8_t value = (data[position / 8] << (shift));
-        value |= data[position / 8 + 1] >> (8 - shift);
-        value = value >> (8 - length);
-        return value;
+    const uint8_t shift = position % 8;
+    uint16_t value = data[position / 8] << 8;
+    // touch the next byte only when the bits actually cross into it
+    if(shift + length > 8) {
+        value |= data[position / 8 + 1];
     }
+    return (uint16_t)(value << shift) >> (16 - length);
 }
 
 uint16_t bit_lib_get_bits_16(const uint8_t* data, size_t position, uint8_t length) {
-    uint16_t value = 0;
-    if(length <= 8) {
-        value = bit_lib_get_bits(data, position, length);
-    } else {
-        value = bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= bit_lib_get_bits(data, position + 8, length - 8);
-    }
-    return value;
+    return bit_lib_get_bits_64(data, position, length);
 }
 
 uint32_t bit_lib_get_bits_32(const uint8_t* data, size_t position, uint8_t length) {
-    uint32_t value = 0;
-    if(length <= 8) {
-        value = bit_lib_get_bits(data, position, length);
-    } else if(length <= 16) {
-        value = bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= bit_lib_get_bits(data, position + 8, length - 8);
-    } else if(length <= 24) {
-        value = bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= bit_lib_get_bits(data, position + 16, length - 16);
-    } else {
-        value = (uint32_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint32_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint32_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= bit_lib_get_bits(data, position + 24, length - 24);
-    }
-
-    return value;
+    return bit_lib_get_bits_64(data, position, length);
 }
 
 uint64_t bit_lib_get_bits_64(const uint8_t* data, size_t position, uint8_t length) {
+    if(length == 0) return 0;
+
+    const uint8_t* bytes = &data[position / 8];
+    const uint8_t shift = position % 8;
+    const size_t byte_count = (shift + length + 7) / 8;
     uint64_t value = 0;
-    if(length <= 8) {
-        value = bit_lib_get_bits(data, position, length);
-    } else if(length <= 16) {
-        value = bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= bit_lib_get_bits(data, position + 8, length - 8);
-    } else if(length <= 24) {
-        value = bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= bit_lib_get_bits(data, position + 16, length - 16);
-    } else if(length <= 32) {
-        value = (uint64_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= bit_lib_get_bits(data, position + 24, length - 24);
-    } else if(length <= 40) {
-        value = (uint64_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 24, 8) << (length - 32);
-        value |= bit_lib_get_bits(data, position + 32, length - 32);
-    } else if(length <= 48) {
-        value = (uint64_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 24, 8) << (length - 32);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 32, 8) << (length - 40);
-        value |= bit_lib_get_bits(data, position + 40, length - 40);
-    } else if(length <= 56) {
-        value = (uint64_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 24, 8) << (length - 32);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 32, 8) << (length - 40);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 40, 8) << (length - 48);
-        value |= bit_lib_get_bits(data, position + 48, length - 48);
+
+    // load every byte the bits span in one go, MSB first
+    for(size_t i = 0; i < MIN(byte_count, sizeof(uint64_t)); ++i) {
+        value = (value << 8) | bytes[i];
+    }
+
+    if(byte_count > sizeof(uint64_t)) {
+        value = (value << shift) | (bytes[sizeof(uint64_t)] >> (8 - shift));
     } else {
-        value = (uint64_t)bit_lib_get_bits(data, position, 8) << (length - 8);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 8, 8) << (length - 16);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 16, 8) << (length - 24);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 24, 8) << (length - 32);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 32, 8) << (length - 40);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 40, 8) << (length - 48);
-        value |= (uint64_t)bit_lib_get_bits(data, position + 48, 8) << (length - 56);
-        value |= bit_lib_get_bits(data, position + 56, length - 56);
+        value <<= (sizeof(uint64_t) - byte_count) * 8 + shift;
     }
 
-    return value;
+    return value >> (64 - length);
 }
 
 bool bit_lib_test_parity_32(uint32_t bits, BitLibParity parity) {
@@ -253,8 +266,22 @@ void bit_lib_copy_bits(
     size_t length,
     const uint8_t* source,
     size_t source_position) {
-    for(size_t i = 0; i < length; ++i) {
-        bit_lib_set_bit(data, position + i, bit_lib_get_bit(source, source_position + i));
+    size_t i = 0;
+    // byte sized chunks, whole byte stores when the destination is aligned
+    if(position % 8 == 0) {
+        for(; i + 8 <= length; i += 8) {
+            data[(position + i) / 8] = bit_lib_get_bits(source, source_position + i, 8);
+        }
+    }
+    for(; i + 8 <= length; i += 8) {
+        bit_lib_set_bits(data, position + i, bit_lib_get_bits(source, source_position + i, 8), 8);
+    }
+    if(i < length) {
+        bit_lib_set_bits(
+            data,
+            position + i,
+            bit_lib_get_bits(source, source_position + i, length - i),
+            length - i);
     }
 }
 
@@ -41,6 +41,70 @@ typedef enum {
  */
 void bit_lib_push_bit(uint8_t* data, size_t data_size, bool bit);
 
+/** @brief Byte size of a bit ring holding the last `length` pushed bits.
+ *  @param length ring window length in bits
+ */
+#define BIT_LIB_RING_SIZE(length) (((length) * 2 + 7) / 8)
+
+/** @brief Push a bit into a bit ring in constant time.
+ *
+ * Every bit is stored twice, `length` bits apart, so the last `length` pushed bits
+ * are always available in order as a plain bit array starting at bit `*head`.
+ * Read them with bit_lib_get_bits*(data, *head + position, ...) or copy them out
+ * with bit_lib_copy_bits(). A zeroed ring with `*head` = 0 matches a zeroed
+ * bit_lib_push_bit() array of the same length.
+ *
+ *  @param data ring storage, BIT_LIB_RING_SIZE(length) bytes
+ *  @param length ring window length in bits
+ *  @param head position of the oldest bit, updated on push
+ *  @param bit bit to push
+ */
+void bit_lib_ring_push_bit(uint8_t* data, size_t length, size_t* head, bool bit);
+
+/** @brief Bit ring with its storage, see bit_lib_ring_push_bit(). */
+typedef struct {
+    uint8_t* data; /**< ring storage, BIT_LIB_RING_SIZE(length) bytes */
+    size_t length; /**< ring window length in bits */
+    size_t head; /**< position of the oldest bit */
+} BitLibRing;
+
+/** @brief Attach storage to a bit ring and clear it.
+ *  @param ring ring to initialize
+ *  @param data ring storage, BIT_LIB_RING_SIZE(length) bytes
+ *  @param length ring window length in bits
+ */
+void bit_lib_ring_init(BitLibRing* ring, uint8_t* data, size_t length);
+
+/** @brief Push a bit into a bit ring.
+ *  @param ring ring to push bit into
+ *  @param bit bit to push
+ */
+void bit_lib_ring_push(BitLibRing* ring, bool bit);
+
+/** @brief Copy the ring window out, oldest bit first.
+ *  @param ring ring to copy from
+ *  @param frame destination, at least `length` bits
+ */
+void bit_lib_ring_copy(const BitLibRing* ring, uint8_t* frame);
+
+/** @brief Copy the ring window out only if it starts with a preamble.
+ *
+ * The preamble is checked in place, so a frame is copied only on a match.
+ *
+ *  @param ring ring to copy from
+ *  @param frame destination, at least `length` bits
+ *  @param prefix_bits preamble length in bits, up to 64
+ *  @param expected preamble value
+ *  @param second_offset window position where the preamble repeats, 0 to check it once
+ *  @return true if the preamble matched and the window was copied
+ */
+bool bit_lib_ring_copy_if(
+    const BitLibRing* ring,
+    uint8_t* frame,
+    uint8_t prefix_bits,
+    uint64_t expected,
+    size_t second_offset);
+
 /** @brief Set a bit in a byte array.
  *  @param data array to set bit in
  *  @param position The position of the bit to set.
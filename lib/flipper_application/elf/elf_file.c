@@ -2,6 +2,7 @@
 #include "elf_file_i.h"
 
 #include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
 #include <elf.h>
 #include "elf_api_interface.h"
 #include "../api_hashtable/api_hashtable.h"
@@ -14,6 +15,14 @@
 #define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
 
+#define ELF_LOAD_CACHE_DIR        EXT_PATH(".tmp/elf_cache")
+#define ELF_LOAD_CACHE_EXTENSION  ".plan"
+#define ELF_LOAD_CACHE_MAGIC      0x43464C45 // "ELFC"
+#define ELF_LOAD_CACHE_VERSION    1
+#define ELF_LOAD_PLAN_MAX_SIZE    (16 * 1024)
+#define ELF_SYMBOL_ARENA_MAX_SIZE (32 * 1024)
+#define ELF_RELOCATION_READ_BATCH 16
+
 // #define ELF_DEBUG_LOG 1
 
 #ifndef ELF_DEBUG_LOG
@@ -37,6 +46,20 @@ typedef struct {
     uint32_t addr;
 } FURI_PACKED JMPTrampoline;
 
+/** Followed by source path, section header table and section names */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint32_t path_size;
+    uint32_t entry;
+    uint32_t sections_count;
+    uint32_t section_names_size;
+} ELFLoadCacheHeader;
+
 /**************************************************************************************************/
 /********************************************* Caches *********************************************/
 /**************************************************************************************************/
@@ -90,6 +113,21 @@ static ELFSection* elf_file_get_or_put_section(ELFFile* elf, const char* name) {
     return section_p;
 }
 
+static void elf_file_free_load_plan(ELFFile* elf) {
+    free(elf->section_headers);
+    elf->section_headers = NULL;
+    free(elf->section_names);
+    elf->section_names = NULL;
+    elf->section_names_size = 0;
+}
+
+static void elf_file_free_symbol_arena(ELFFile* elf) {
+    free(elf->symbols);
+    elf->symbols = NULL;
+    free(elf->symbol_names);
+    elf->symbol_names = NULL;
+}
+
 static bool elf_read_string_from_offset(ELFFile* elf, off_t offset, FuriString* name) {
     bool result = false;
 
@@ -119,6 +157,12 @@ static bool elf_read_string_from_offset(ELFFile* elf, off_t offset, FuriString*
 }
 
 static bool elf_read_section_name(ELFFile* elf, off_t offset, FuriString* name) {
+    if(elf->section_names) {
+        if((size_t)offset >= elf->section_names_size) return false;
+        furi_string_cat(name, &elf->section_names[offset]);
+        return true;
+    }
+
     return elf_read_string_from_offset(elf, elf->section_table_strings + offset, name);
 }
 
@@ -127,6 +171,12 @@ static bool elf_read_symbol_name(ELFFile* elf, off_t offset, FuriString* name) {
 }
 
 static bool elf_read_section_header(ELFFile* elf, size_t section_idx, Elf32_Shdr* section_header) {
+    if(elf->section_headers) {
+        if(section_idx >= elf->sections_count) return false;
+        *section_header = elf->section_headers[section_idx];
+        return true;
+    }
+
     off_t offset = SECTION_OFFSET(elf, section_idx);
     return storage_file_seek(elf->fd, offset, true) &&
            storage_file_read(elf->fd, section_header, sizeof(Elf32_Shdr)) == sizeof(Elf32_Shdr);
@@ -148,18 +198,24 @@ static bool elf_read_section(
     return true;
 }
 
+/* Section symbols are left without name, they are resolved by section index */
 static bool elf_read_symbol(ELFFile* elf, int n, Elf32_Sym* sym, FuriString* name) {
+    if(elf->symbols) {
+        if((size_t)n >= elf->symbol_count) return false;
+        *sym = elf->symbols[n];
+        if(sym->st_name) {
+            if(sym->st_name >= elf->symbol_table_strings_size) return false;
+            furi_string_cat(name, &elf->symbol_names[sym->st_name]);
+        }
+        return true;
+    }
+
     bool success = false;
     off_t old = storage_file_tell(elf->fd);
     off_t pos = elf->symbol_table + n * sizeof(Elf32_Sym);
     if(storage_file_seek(elf->fd, pos, true) &&
        storage_file_read(elf->fd, sym, sizeof(Elf32_Sym)) == sizeof(Elf32_Sym)) {
-        if(sym->st_name)
-            success = elf_read_symbol_name(elf, sym->st_name, name);
-        else {
-            Elf32_Shdr shdr;
-            success = elf_read_section(elf, sym->st_shndx, &shdr, name);
-        }
+        success = !sym->st_name || elf_read_symbol_name(elf, sym->st_name, name);
     }
     storage_file_seek(elf->fd, old, true);
     return success;
@@ -359,9 +415,11 @@ static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf3
 static bool elf_relocate(ELFFile* elf, ELFSection* s) {
     if(s->data) {
         Elf32_Rel rel;
+        Elf32_Rel rel_batch[ELF_RELOCATION_READ_BATCH];
+        size_t rel_batch_pos = 0;
+        size_t rel_batch_count = 0;
         size_t relEntries = s->rel_count;
         size_t relCount;
-        (void)storage_file_seek(elf->fd, s->rel_offset, true);
         FURI_LOG_D(TAG, " Offset   Info     Type             Name");
 
         int relocate_result = true;
@@ -374,11 +432,20 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                 furi_delay_tick(1);
             }
 
-            if(storage_file_read(elf->fd, &rel, sizeof(Elf32_Rel)) != sizeof(Elf32_Rel)) {
-                FURI_LOG_E(TAG, "  reloc read fail");
-                furi_string_free(symbol_name);
-                return false;
+            // Symbol reads may move fd, so every batch seeks to its own position
+            if(rel_batch_pos == rel_batch_count) {
+                rel_batch_pos = 0;
+                rel_batch_count = MIN(relEntries - relCount, (size_t)ELF_RELOCATION_READ_BATCH);
+                const size_t batch_size = rel_batch_count * sizeof(Elf32_Rel);
+                if(!storage_file_seek(
+                       elf->fd, s->rel_offset + relCount * sizeof(Elf32_Rel), true) ||
+                   storage_file_read(elf->fd, rel_batch, batch_size) != batch_size) {
+                    FURI_LOG_E(TAG, "  reloc read fail");
+                    furi_string_free(symbol_name);
+                    return false;
+                }
             }
+            rel = rel_batch[rel_batch_pos++];
 
             Elf32_Addr symAddr;
 
@@ -632,6 +699,7 @@ static SectionTypeInfo elf_preload_section(
     if(strcmp(name, ".strtab") == 0) {
         FURI_LOG_D(TAG, "Found .strtab section");
         elf->symbol_table_strings = section_header->sh_offset;
+        elf->symbol_table_strings_size = section_header->sh_size;
 
         info.type = SectionTypeStrTab;
         info.result = ELFLoadSectionResultSuccess;
@@ -771,6 +839,50 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
     return no_errors;
 }
 
+/** Read symbol table and its strings in two reads, if any section needs them for relocation */
+static void elf_load_symbol_arena(ELFFile* elf) {
+    bool needed = false;
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.rel_count && !itref->value.fast_rel) {
+            needed = true;
+            break;
+        }
+    }
+    if(!needed) return;
+
+    const size_t symbols_size = elf->symbol_count * sizeof(Elf32_Sym);
+    const size_t arena_size = symbols_size + elf->symbol_table_strings_size;
+    // Sections are in memory already, relocation cache still grows up to an entry per symbol
+    const size_t reserve_size = elf->symbol_count * (sizeof(int) + sizeof(Elf32_Addr)) * 2 + 1024;
+    bool success = false;
+
+    do {
+        if(arena_size > ELF_SYMBOL_ARENA_MAX_SIZE) break;
+        if(memmgr_heap_get_max_free_block() < arena_size + reserve_size) break;
+
+        elf->symbols = malloc(symbols_size);
+        if(!storage_file_seek(elf->fd, elf->symbol_table, true) ||
+           storage_file_read(elf->fd, elf->symbols, symbols_size) != symbols_size)
+            break;
+
+        elf->symbol_names = malloc(elf->symbol_table_strings_size + 1);
+        elf->symbol_names[elf->symbol_table_strings_size] = '\0';
+        if(!storage_file_seek(elf->fd, elf->symbol_table_strings, true) ||
+           storage_file_read(elf->fd, elf->symbol_names, elf->symbol_table_strings_size) !=
+               elf->symbol_table_strings_size)
+            break;
+
+        success = true;
+    } while(false);
+
+    if(!success) {
+        FURI_LOG_D(TAG, "Symbol arena not used, %zu bytes", arena_size);
+        elf_file_free_symbol_arena(elf);
+    }
+}
+
 static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     if(section->fast_rel) {
         FURI_LOG_D(TAG, "Fast relocating section");
@@ -803,12 +915,186 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
     }
 }
 
+/**************************************************************************************************/
+/******************************************* Load cache *******************************************/
+/**************************************************************************************************/
+
+static bool elf_load_cache_get_source_info(
+    ELFFile* elf,
+    const char* path,
+    uint32_t* size,
+    uint32_t* timestamp) {
+    FileInfo file_info;
+    if(storage_common_stat(elf->storage, path, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(elf->storage, path, timestamp) != FSE_OK) return false;
+    *size = file_info.size;
+    return true;
+}
+
+static FuriString* elf_load_cache_get_path(const char* path) {
+    return furi_string_alloc_printf(
+        "%s/%08lX%s",
+        ELF_LOAD_CACHE_DIR,
+        crc32_calc_buffer(0, path, strlen(path)),
+        ELF_LOAD_CACHE_EXTENSION);
+}
+
+/** Read section header table and section names from the ELF file in two reads */
+static bool elf_load_plan_read(ELFFile* elf, const Elf32_Shdr* names_header) {
+    const size_t headers_size = elf->sections_count * sizeof(Elf32_Shdr);
+    bool success = false;
+
+    do {
+        if(headers_size + names_header->sh_size > ELF_LOAD_PLAN_MAX_SIZE) break;
+
+        elf->section_headers = malloc(headers_size);
+        if(!storage_file_seek(elf->fd, elf->section_table, true) ||
+           storage_file_read(elf->fd, elf->section_headers, headers_size) != headers_size)
+            break;
+
+        elf->section_names_size = names_header->sh_size;
+        elf->section_names = malloc(elf->section_names_size + 1);
+        elf->section_names[elf->section_names_size] = '\0';
+        if(!storage_file_seek(elf->fd, names_header->sh_offset, true) ||
+           storage_file_read(elf->fd, elf->section_names, elf->section_names_size) !=
+               elf->section_names_size)
+            break;
+
+        success = true;
+    } while(false);
+
+    if(!success) {
+        elf_file_free_load_plan(elf);
+    }
+
+    return success;
+}
+
+static bool elf_load_cache_load(ELFFile* elf, const char* path) {
+    ELFLoadCacheHeader header;
+    uint32_t source_size = 0;
+    uint32_t source_timestamp = 0;
+    const size_t path_size = strlen(path);
+    char* cached_path = NULL;
+    bool success = false;
+
+    FuriString* cache_path = elf_load_cache_get_path(path);
+    File* file = storage_file_alloc(elf->storage);
+
+    do {
+        if(!elf_load_cache_get_source_info(elf, path, &source_size, &source_timestamp)) break;
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != ELF_LOAD_CACHE_MAGIC || header.version != ELF_LOAD_CACHE_VERSION ||
+           header.source_size != source_size || header.source_timestamp != source_timestamp ||
+           header.api_version_major != elf->api_interface->api_version_major ||
+           header.api_version_minor != elf->api_interface->api_version_minor ||
+           header.path_size != path_size)
+            break;
+
+        // Cache file is not trusted, check sizes against the plan limit before multiplying
+        if(header.sections_count > ELF_LOAD_PLAN_MAX_SIZE / sizeof(Elf32_Shdr) ||
+           header.section_names_size > ELF_LOAD_PLAN_MAX_SIZE)
+            break;
+        const size_t headers_size = header.sections_count * sizeof(Elf32_Shdr);
+        if(headers_size + header.section_names_size > ELF_LOAD_PLAN_MAX_SIZE) break;
+
+        // And against the ELF header itself
+        Elf32_Ehdr elf_header;
+        if(!storage_file_seek(elf->fd, 0, true) ||
+           storage_file_read(elf->fd, &elf_header, sizeof(elf_header)) != sizeof(elf_header))
+            break;
+        if(header.sections_count != elf_header.e_shnum || header.entry != elf_header.e_entry)
+            break;
+
+        cached_path = malloc(path_size);
+        if(storage_file_read(file, cached_path, path_size) != path_size) break;
+        if(memcmp(cached_path, path, path_size) != 0) break;
+
+        elf->section_headers = malloc(headers_size);
+        if(storage_file_read(file, elf->section_headers, headers_size) != headers_size) break;
+
+        elf->section_names_size = header.section_names_size;
+        elf->section_names = malloc(elf->section_names_size + 1);
+        elf->section_names[elf->section_names_size] = '\0';
+        if(storage_file_read(file, elf->section_names, elf->section_names_size) !=
+           elf->section_names_size)
+            break;
+
+        elf->entry = header.entry;
+        elf->sections_count = header.sections_count;
+        elf->section_table = 0;
+        elf->section_table_strings = 0;
+        success = true;
+    } while(false);
+
+    if(!success) {
+        elf_file_free_load_plan(elf);
+    }
+
+    free(cached_path);
+    storage_file_free(file);
+    furi_string_free(cache_path);
+
+    return success;
+}
+
+static void elf_load_cache_save(ELFFile* elf, const char* path) {
+    ELFLoadCacheHeader header = {
+        .magic = ELF_LOAD_CACHE_MAGIC,
+        .version = ELF_LOAD_CACHE_VERSION,
+        .api_version_major = elf->api_interface->api_version_major,
+        .api_version_minor = elf->api_interface->api_version_minor,
+        .path_size = strlen(path),
+        .entry = elf->entry,
+        .sections_count = elf->sections_count,
+        .section_names_size = elf->section_names_size,
+    };
+    const size_t headers_size = elf->sections_count * sizeof(Elf32_Shdr);
+    bool success = false;
+
+    FuriString* cache_path = elf_load_cache_get_path(path);
+    File* file = storage_file_alloc(elf->storage);
+
+    do {
+        if(!elf_load_cache_get_source_info(
+               elf, path, &header.source_size, &header.source_timestamp))
+            break;
+
+        storage_simply_mkdir(elf->storage, EXT_PATH(".tmp"));
+        storage_simply_mkdir(elf->storage, ELF_LOAD_CACHE_DIR);
+        if(!storage_file_open(
+               file, furi_string_get_cstr(cache_path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(file, path, header.path_size) != header.path_size) break;
+        if(storage_file_write(file, elf->section_headers, headers_size) != headers_size) break;
+        if(storage_file_write(file, elf->section_names, elf->section_names_size) !=
+           elf->section_names_size)
+            break;
+
+        success = true;
+    } while(false);
+
+    storage_file_free(file);
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save load cache for %s", path);
+        storage_simply_remove(elf->storage, furi_string_get_cstr(cache_path));
+    }
+    furi_string_free(cache_path);
+}
+
 /**************************************************************************************************/
 /********************************************* Public *********************************************/
 /**************************************************************************************************/
 
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
+    elf->storage = storage;
     elf->fd = storage_file_alloc(storage);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
@@ -859,16 +1145,30 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    elf_file_free_symbol_arena(elf);
+    elf_file_free_load_plan(elf);
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
 
+void elf_file_set_load_cache(ELFFile* elf, bool enable) {
+    elf->load_cache_enabled = enable;
+}
+
 bool elf_file_open(ELFFile* elf, const char* path) {
     Elf32_Ehdr h;
     Elf32_Shdr sH;
 
-    if(!storage_file_open(elf->fd, path, FSAM_READ, FSOM_OPEN_EXISTING) ||
-       !storage_file_seek(elf->fd, 0, true) ||
+    if(!storage_file_open(elf->fd, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        return false;
+    }
+
+    if(elf->load_cache_enabled && elf_load_cache_load(elf, path)) {
+        FURI_LOG_D(TAG, "Load plan cache hit for %s", path);
+        return true;
+    }
+
+    if(!storage_file_seek(elf->fd, 0, true) ||
        storage_file_read(elf->fd, &h, sizeof(h)) != sizeof(h) ||
        !storage_file_seek(elf->fd, h.e_shoff + h.e_shstrndx * sizeof(sH), true) ||
        storage_file_read(elf->fd, &sH, sizeof(Elf32_Shdr)) != sizeof(Elf32_Shdr)) {
@@ -879,6 +1179,12 @@ bool elf_file_open(ELFFile* elf, const char* path) {
     elf->sections_count = h.e_shnum;
     elf->section_table = h.e_shoff;
     elf->section_table_strings = sH.sh_offset;
+
+    // Section table is small and walked several times, keep it in memory even without cache
+    if(elf_load_plan_read(elf, &sH) && elf->load_cache_enabled) {
+        elf_load_cache_save(elf, path);
+    }
+
     return true;
 }
 
@@ -975,7 +1281,10 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
     ELFSectionDict_it_t it;
 
+    // Section table walks are done, relocation reads only symbols and relocations
+    elf_file_free_load_plan(elf);
     AddressCache_init(elf->relocation_cache);
+    elf_load_symbol_arena(elf);
 
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -1001,6 +1310,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
     AddressCache_clear(elf->relocation_cache);
+    elf_file_free_symbol_arena(elf);
 
     {
         size_t total_size = 0;
@@ -64,6 +64,14 @@ ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface);
  */
 void elf_file_free(ELFFile* elf_file);
 
+/**
+ * @brief Enable load plan cache, must be called before elf_file_open
+ * Section table of the file is kept on SD card and reused until the file changes.
+ * @param elf_file 
+ * @param enable 
+ */
+void elf_file_set_load_cache(ELFFile* elf_file, bool enable);
+
 /**
  * @brief Open ELF file
  * @param elf_file 
@@ -36,12 +36,14 @@ struct ELFFile {
     size_t symbol_count;
     off_t symbol_table;
     off_t symbol_table_strings;
+    size_t symbol_table_strings_size;
     off_t entry;
     ELFSectionDict_t sections;
 
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
 
+    Storage* storage;
     File* fd;
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
@@ -51,6 +53,16 @@ struct ELFFile {
     ELFSection* fini_array;
 
     bool init_array_called;
+
+    /** Load plan: section header table and section names, replaces their reads from fd */
+    bool load_cache_enabled;
+    Elf32_Shdr* section_headers;
+    char* section_names;
+    size_t section_names_size;
+
+    /** Symbol arena: symbol table and its strings, replaces per-symbol reads from fd */
+    Elf32_Sym* symbols;
+    char* symbol_names;
 };
 
 #ifdef __cplusplus
@@ -64,6 +64,11 @@ FlipperApplication*
     return app;
 }
 
+void flipper_application_set_load_cache(FlipperApplication* app, bool enable) {
+    furi_check(app);
+    elf_file_set_load_cache(app->elf, enable);
+}
+
 bool flipper_application_is_plugin(FlipperApplication* app) {
     furi_check(app);
     return app->manifest.stack_size == 0;
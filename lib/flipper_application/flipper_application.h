@@ -71,6 +71,16 @@ FlipperApplication*
  */
 void flipper_application_free(FlipperApplication* app);
 
+/** Enable load plan cache, must be called before preload
+ *
+ * Section table of the file is then cached on SD card and reused on next
+ * loads until the file changes. Worth it for files loaded over and over.
+ *
+ * @param app Application pointer
+ * @param enable true to enable
+ */
+void flipper_application_set_load_cache(FlipperApplication* app, bool enable);
+
 /** Validate elf file and load application metadata
  *
  * @param      app   Application pointer
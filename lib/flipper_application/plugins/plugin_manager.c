@@ -20,6 +20,7 @@ struct PluginManager {
     Storage* storage;
     FlipperApplicationList_t libs;
     const ElfApiInterface* api_interface;
+    bool load_cache;
 };
 
 PluginManager* plugin_manager_alloc(
@@ -47,9 +48,15 @@ void plugin_manager_free(PluginManager* manager) {
     free(manager);
 }
 
+void plugin_manager_set_load_cache(PluginManager* manager, bool enable) {
+    furi_check(manager);
+    manager->load_cache = enable;
+}
+
 PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path) {
     furi_check(manager);
     FlipperApplication* lib = flipper_application_alloc(manager->storage, manager->api_interface);
+    flipper_application_set_load_cache(lib, manager->load_cache);
 
     PluginManagerError error = PluginManagerErrorNone;
     do {
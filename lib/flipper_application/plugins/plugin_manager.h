@@ -38,6 +38,14 @@ PluginManager* plugin_manager_alloc(
  */
 void plugin_manager_free(PluginManager* manager);
 
+/**
+ * @brief Enables load plan cache for plugins loaded afterwards
+ * @see flipper_application_set_load_cache
+ * @param manager PluginManager instance
+ * @param enable true to enable
+ */
+void plugin_manager_set_load_cache(PluginManager* manager, bool enable);
+
 /**
  * @brief Loads single plugin by full path
  * @param manager PluginManager instance
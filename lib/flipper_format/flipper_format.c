@@ -7,11 +7,13 @@
 #include "flipper_format_i.h"
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
+#include "flipper_format_key_index.h"
 
 /********************************** Private **********************************/
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    FlipperFormatKeyIndex* key_index;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -21,12 +23,43 @@ Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
     return flipper_format->stream;
 }
 
+static bool flipper_format_read_value_line(
+    FlipperFormat* flipper_format,
+    const char* key,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size) {
+    Stream* stream = flipper_format->stream;
+
+    if(flipper_format->key_index && !flipper_format->strict_mode) {
+        size_t position = stream_tell(stream);
+        FlipperFormatKeyIndexResult index_result =
+            flipper_format_key_index_seek(flipper_format->key_index, stream, key);
+
+        if(index_result == FlipperFormatKeyIndexNotFound) {
+            // Same place the scan would stop at
+            stream_seek(stream, 0, StreamOffsetFromEnd);
+            return false;
+        } else if(index_result == FlipperFormatKeyIndexFound) {
+            // Strict read from the key line verifies the key, hash collision falls back to scan
+            if(flipper_format_stream_read_value_line(stream, key, type, data, data_size, true)) {
+                return true;
+            }
+            stream_seek(stream, position, StreamOffsetFromStart);
+        }
+    }
+
+    return flipper_format_stream_read_value_line(
+        stream, key, type, data, data_size, flipper_format->strict_mode);
+}
+
 /********************************** Public **********************************/
 
 FlipperFormat* flipper_format_string_alloc(void) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = string_stream_alloc();
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
@@ -34,6 +67,7 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
@@ -41,6 +75,7 @@ FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
@@ -114,6 +149,9 @@ bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    if(flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+    }
     stream_free(flipper_format->stream);
     free(flipper_format);
 }
@@ -122,6 +160,16 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable) {
+    furi_check(flipper_format);
+    if(enable && !flipper_format->key_index) {
+        flipper_format->key_index = flipper_format_key_index_alloc();
+    } else if(!enable && flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+        flipper_format->key_index = NULL;
+    }
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -135,7 +183,21 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
-    bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+
+    FlipperFormatKeyIndexResult index_result = FlipperFormatKeyIndexUnusable;
+    if(flipper_format->key_index) {
+        index_result =
+            flipper_format_key_index_seek(flipper_format->key_index, flipper_format->stream, key);
+    }
+
+    bool result = false;
+    if(index_result == FlipperFormatKeyIndexFound) {
+        result = flipper_format_stream_seek_to_key(flipper_format->stream, key, true);
+        if(!result) stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
+    }
+    if(!result && index_result != FlipperFormatKeyIndexNotFound) {
+        result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    }
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
     return result;
@@ -174,14 +236,28 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_check(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+    Stream* stream = flipper_format->stream;
+
+    if(flipper_format->key_index && !flipper_format->strict_mode) {
+        size_t position = stream_tell(stream);
+        FlipperFormatKeyIndexResult index_result =
+            flipper_format_key_index_seek(flipper_format->key_index, stream, key);
+
+        if(index_result == FlipperFormatKeyIndexNotFound) {
+            return false;
+        } else if(index_result == FlipperFormatKeyIndexFound) {
+            bool result = flipper_format_stream_get_value_count(stream, key, count, true);
+            stream_seek(stream, position, StreamOffsetFromStart);
+            if(result) return true;
+        }
+    }
+
+    return flipper_format_stream_get_value_count(stream, key, count, flipper_format->strict_mode);
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_read_value_line(flipper_format, key, FlipperStreamValueStr, data, 1);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -217,13 +293,8 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHexUint64,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHexUint64, data, data_size);
 }
 
 bool flipper_format_write_hex_uint64(
@@ -248,13 +319,8 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueUint32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueUint32, data, data_size);
 }
 
 bool flipper_format_write_uint32(
@@ -278,13 +344,8 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueInt32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueInt32, data, data_size);
 }
 
 bool flipper_format_write_int32(
@@ -308,13 +369,8 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueBool,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueBool, data, data_size);
 }
 
 bool flipper_format_write_bool(
@@ -338,13 +394,8 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueFloat,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueFloat, data, data_size);
 }
 
 bool flipper_format_write_float(
@@ -368,13 +419,8 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHex,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHex, data, data_size);
 }
 
 bool flipper_format_write_hex(
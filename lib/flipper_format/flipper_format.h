@@ -208,6 +208,18 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/** Enable key index.
+ *
+ * Index of all keys is built on the first read and rebuilt after the stream is
+ * modified, so reads in arbitrary order or after rewind do not rescan the file.
+ * Worth it for files that are read out of order, costs 8 bytes of RAM per key.
+ * Reads in strict mode and files with more than 1024 keys are not indexed.
+ *
+ * @param      flipper_format  Pointer to a FlipperFormat instance
+ * @param      enable          True to enable. False by default.
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable);
+
 /** Rewind the RW pointer.
  *
  * @param      flipper_format  Pointer to a FlipperFormat instance
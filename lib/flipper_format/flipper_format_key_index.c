@@ -0,0 +1,171 @@
+#include <furi.h>
+#include "flipper_format_key_index.h"
+#include "flipper_format_stream_i.h"
+
+typedef struct {
+    uint32_t hash;
+    uint32_t offset; /**< Key line beginning */
+} FlipperFormatKeyIndexEntry;
+
+typedef enum {
+    FlipperFormatKeyIndexStateEmpty,
+    FlipperFormatKeyIndexStateReady,
+    FlipperFormatKeyIndexStateOverflow,
+} FlipperFormatKeyIndexState;
+
+struct FlipperFormatKeyIndex {
+    FlipperFormatKeyIndexState state;
+    uint32_t modification_count; /**< Stream state index was built for */
+    /** Sorted by hash, then by offset */
+    FlipperFormatKeyIndexEntry* entries;
+    size_t count;
+};
+
+static uint32_t flipper_format_key_index_hash(const char* key, size_t size) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static int flipper_format_key_index_compare(const void* a, const void* b) {
+    const FlipperFormatKeyIndexEntry* entry_a = a;
+    const FlipperFormatKeyIndexEntry* entry_b = b;
+
+    if(entry_a->hash != entry_b->hash) return entry_a->hash < entry_b->hash ? -1 : 1;
+    if(entry_a->offset != entry_b->offset) return entry_a->offset < entry_b->offset ? -1 : 1;
+    return 0;
+}
+
+FlipperFormatKeyIndex* flipper_format_key_index_alloc(void) {
+    FlipperFormatKeyIndex* index = malloc(sizeof(FlipperFormatKeyIndex));
+    index->state = FlipperFormatKeyIndexStateEmpty;
+    return index;
+}
+
+void flipper_format_key_index_free(FlipperFormatKeyIndex* index) {
+    furi_check(index);
+    free(index->entries);
+    free(index);
+}
+
+static void flipper_format_key_index_reset(FlipperFormatKeyIndex* index) {
+    free(index->entries);
+    index->entries = NULL;
+    index->count = 0;
+    index->state = FlipperFormatKeyIndexStateEmpty;
+}
+
+static void flipper_format_key_index_build(FlipperFormatKeyIndex* index, Stream* stream) {
+    size_t position = stream_tell(stream);
+    size_t capacity = 0;
+    FuriString* key = furi_string_alloc();
+
+    // Same parser as key scan, so index sees exactly the keys scan would find
+    index->state = FlipperFormatKeyIndexStateReady;
+    index->modification_count = stream_get_modification_count(stream);
+    stream_rewind(stream);
+    while(flipper_format_stream_read_valid_key(stream, key)) {
+        if(index->count == FLIPPER_FORMAT_KEY_INDEX_MAX) {
+            index->state = FlipperFormatKeyIndexStateOverflow;
+            break;
+        }
+        if(index->count == capacity) {
+            capacity = MAX(capacity * 2, 32U);
+            index->entries = realloc( //-V701
+                index->entries,
+                capacity * sizeof(FlipperFormatKeyIndexEntry));
+        }
+
+        size_t key_size = furi_string_size(key);
+        FlipperFormatKeyIndexEntry* entry = &index->entries[index->count++];
+        entry->hash = flipper_format_key_index_hash(furi_string_get_cstr(key), key_size);
+        entry->offset = stream_tell(stream) - key_size;
+    }
+    furi_string_free(key);
+
+    if(index->state == FlipperFormatKeyIndexStateOverflow) {
+        free(index->entries);
+        index->entries = NULL;
+        index->count = 0;
+    } else if(index->count) {
+        qsort(
+            index->entries,
+            index->count,
+            sizeof(FlipperFormatKeyIndexEntry),
+            flipper_format_key_index_compare);
+    }
+
+    stream_seek(stream, position, StreamOffsetFromStart);
+}
+
+/** Scan from the middle of a line could match value text, index only answers from line bounds */
+static bool flipper_format_key_index_is_line_bound(Stream* stream, size_t position) {
+    if(position == 0) return true;
+
+    uint8_t buffer[2] = {0, 0};
+    bool result = false;
+    if(stream_seek(stream, position - 1, StreamOffsetFromStart)) {
+        size_t was_read = stream_read(stream, buffer, sizeof(buffer));
+        result = (was_read >= 1 && buffer[0] == flipper_format_eoln) ||
+                 (was_read == 2 && buffer[1] == flipper_format_eoln);
+    }
+    stream_seek(stream, position, StreamOffsetFromStart);
+
+    return result;
+}
+
+FlipperFormatKeyIndexResult
+    flipper_format_key_index_seek(FlipperFormatKeyIndex* index, Stream* stream, const char* key) {
+    furi_check(index);
+    furi_check(stream);
+    furi_check(key);
+
+    if(index->state != FlipperFormatKeyIndexStateEmpty &&
+       index->modification_count != stream_get_modification_count(stream)) {
+        flipper_format_key_index_reset(index);
+    }
+    if(index->state == FlipperFormatKeyIndexStateOverflow) return FlipperFormatKeyIndexUnusable;
+
+    size_t position = stream_tell(stream);
+    if(!flipper_format_key_index_is_line_bound(stream, position)) {
+        return FlipperFormatKeyIndexUnusable;
+    }
+
+    if(index->state == FlipperFormatKeyIndexStateEmpty) {
+        flipper_format_key_index_build(index, stream);
+        if(index->state == FlipperFormatKeyIndexStateOverflow) {
+            return FlipperFormatKeyIndexUnusable;
+        }
+    }
+
+    // Lower bound of (hash, position): first line with the key at or after position
+    const FlipperFormatKeyIndexEntry target = {
+        .hash = flipper_format_key_index_hash(key, strlen(key)),
+        .offset = position,
+    };
+    size_t low = 0;
+    size_t high = index->count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(flipper_format_key_index_compare(&index->entries[middle], &target) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if(low == index->count || index->entries[low].hash != target.hash) {
+        return FlipperFormatKeyIndexNotFound;
+    }
+
+    if(!stream_seek(stream, index->entries[low].offset, StreamOffsetFromStart)) {
+        stream_seek(stream, position, StreamOffsetFromStart);
+        return FlipperFormatKeyIndexUnusable;
+    }
+
+    return FlipperFormatKeyIndexFound;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Keys beyond this are not indexed, lookups fall back to linear scan */
+#define FLIPPER_FORMAT_KEY_INDEX_MAX 1024
+
+typedef struct FlipperFormatKeyIndex FlipperFormatKeyIndex;
+
+typedef enum {
+    FlipperFormatKeyIndexFound, /**< Stream is at the beginning of the key line */
+    FlipperFormatKeyIndexNotFound, /**< Key is not in the stream after the position */
+    FlipperFormatKeyIndexUnusable, /**< Index can't answer, stream position is unchanged */
+} FlipperFormatKeyIndexResult;
+
+/**
+ * Allocate key index, it is built on the first lookup and rebuilt once stream is modified
+ * @return FlipperFormatKeyIndex*
+ */
+FlipperFormatKeyIndex* flipper_format_key_index_alloc(void);
+
+/**
+ * Free key index
+ * @param index
+ */
+void flipper_format_key_index_free(FlipperFormatKeyIndex* index);
+
+/**
+ * Find the first line with the key, that the non-strict scan from the current position would find.
+ * Key is only matched by hash, caller must verify it by strict read from the line beginning.
+ * @param index
+ * @param stream
+ * @param key
+ * @return FlipperFormatKeyIndexResult
+ */
+FlipperFormatKeyIndexResult
+    flipper_format_key_index_seek(FlipperFormatKeyIndex* index, Stream* stream, const char* key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -30,10 +30,47 @@ bool flipper_format_stream_write_eol(Stream* stream) {
     return flipper_format_stream_write(stream, &flipper_format_eoln, 1);
 }
 
-static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key) {
-    furi_string_reset(key);
+/**
+ * Read data at the RW pointer, in place from the stream buffer if stream has one, otherwise
+ * to the local buffer. RW pointer is moved past the data like by stream_read.
+ */
+static size_t flipper_format_stream_read_view(
+    Stream* stream,
+    const uint8_t** view,
+    uint8_t* buffer,
+    size_t buffer_size) {
+    size_t was_read = stream_peek(stream, view);
+
+    if(was_read) {
+        if(!stream_seek(stream, was_read, StreamOffsetFromCurrent)) was_read = 0;
+    } else {
+        was_read = stream_read(stream, buffer, buffer_size);
+        *view = buffer;
+    }
+
+    return was_read;
+}
+
+/**
+ * Read next key, either collect it to the string or compare it in place with the expected one
+ * @param stream
+ * @param key string to collect the key to, or NULL
+ * @param expected key to compare with, used if key is NULL
+ * @param equal set to comparison result
+ * @return true if key is found
+ */
+static bool flipper_format_stream_scan_key(
+    Stream* stream,
+    FuriString* key,
+    const char* expected,
+    bool* equal) {
     const size_t buffer_size = 32;
     uint8_t buffer[buffer_size];
+    const size_t expected_size = key ? 0 : strlen(expected);
+    size_t matched = 0;
+    bool mismatch = false;
+
+    if(key) furi_string_reset(key);
 
     bool found = false;
     bool error = false;
@@ -41,14 +78,17 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
     bool new_line = true;
 
     while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
+        const uint8_t* view;
+        size_t was_read = flipper_format_stream_read_view(stream, &view, buffer, buffer_size);
         if(was_read == 0) break;
 
         for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
+            uint8_t data = view[i];
             if(data == flipper_format_eoln) {
                 // EOL found, clean data, start accumulating data and set the new_line flag
-                furi_string_reset(key);
+                if(key) furi_string_reset(key);
+                matched = 0;
+                mismatch = false;
                 accumulate = true;
                 new_line = true;
             } else if(data == flipper_format_eolr) {
@@ -64,7 +104,9 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
                     // this can only be if we have previously found some kind of key, so
                     // clear the data, set the flag that we no longer want to accumulate data
                     // and reset the new_line flag
-                    furi_string_reset(key);
+                    if(key) furi_string_reset(key);
+                    matched = 0;
+                    mismatch = false;
                     accumulate = false;
                     new_line = false;
                 } else {
@@ -86,7 +128,13 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
                 new_line = false;
                 if(accumulate) {
                     // and accumulate data if we want
-                    furi_string_push_back(key, data);
+                    if(key) {
+                        furi_string_push_back(key, data);
+                    } else if(matched < expected_size && (uint8_t)expected[matched] == data) {
+                        matched++;
+                    } else {
+                        mismatch = true;
+                    }
                 }
             }
         }
@@ -94,18 +142,23 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
         if(found || error) break;
     }
 
+    if(equal) *equal = found && !mismatch && matched == expected_size;
+
     return found;
 }
 
+bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key) {
+    return flipper_format_stream_scan_key(stream, key, NULL, NULL);
+}
+
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
     bool found = false;
-    FuriString* read_key;
-
-    read_key = furi_string_alloc();
+    bool equal = false;
 
+    // Keys are compared in place, nothing is copied while skipping lines
     while(!stream_eof(stream)) {
-        if(flipper_format_stream_read_valid_key(stream, read_key)) {
-            if(furi_string_cmp_str(read_key, key) == 0) {
+        if(flipper_format_stream_scan_key(stream, NULL, key, &equal)) {
+            if(equal) {
                 if(!stream_seek(stream, 2, StreamOffsetFromCurrent)) break;
 
                 found = true;
@@ -116,7 +169,6 @@ bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool str
             }
         }
     }
-    furi_string_free(read_key);
 
     return found;
 }
@@ -135,7 +187,8 @@ static bool flipper_format_stream_read_value(Stream* stream, FuriString* value,
     furi_string_reset(value);
 
     while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
+        const uint8_t* view;
+        size_t was_read = flipper_format_stream_read_view(stream, &view, buffer, buffer_size);
 
         if(was_read == 0) {
             if(state != LeadingSpace && stream_eof(stream)) {
@@ -146,8 +199,8 @@ static bool flipper_format_stream_read_value(Stream* stream, FuriString* value,
             }
         }
 
-        for(uint16_t i = 0; i < was_read; i++) {
-            const uint8_t data = buffer[i];
+        for(size_t i = 0; i < was_read; i++) {
+            const uint8_t data = view[i];
 
             if(state == LeadingSpace) {
                 if(flipper_format_stream_is_space(data)) {
@@ -199,14 +252,15 @@ static bool flipper_format_stream_read_line(Stream* stream, FuriString* str_resu
     uint8_t buffer[buffer_size];
 
     do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
+        const uint8_t* view;
+        size_t was_read = flipper_format_stream_read_view(stream, &view, buffer, buffer_size);
         if(was_read == 0) break;
 
         bool result = false;
         bool error = false;
 
         for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
+            uint8_t data = view[i];
             if(data == flipper_format_eoln) {
                 if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
                     error = true;
@@ -237,7 +291,8 @@ static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
     bool error = false;
 
     do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
+        const uint8_t* view;
+        size_t was_read = flipper_format_stream_read_view(stream, &view, buffer, buffer_size);
         if(was_read == 0) {
             if(stream_eof(stream)) {
                 result = true;
@@ -246,7 +301,7 @@ static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
         }
 
         for(size_t i = 0; i < was_read; i++) {
-            if(buffer[i] == flipper_format_eoln) {
+            if(view[i] == flipper_format_eoln) {
                 if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
                     error = true;
                     break;
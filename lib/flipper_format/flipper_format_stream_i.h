@@ -18,6 +18,16 @@ extern "C" {
  */
 bool flipper_format_stream_write_eol(Stream* stream);
 
+/**
+ * Read next key from the current position of the stream.
+ * Position will be at the delimiter after the key, if the key is found, or at the end.
+ * @param stream 
+ * @param key 
+ * @return true key is found
+ * @return false key is not found
+ */
+bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key);
+
 /**
  * Seek to the key from the current position of the stream.
  * Position will be at the beginning of the value corresponding to the key, if the key is found,, or at the end of the stream.
@@ -217,6 +217,23 @@ InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* deco
     return message;
 }
 
+/**
+ * Decoder waiting for a preamble with no timings buffered drops every timing except
+ * a mark matching the preamble mark: a space is consumed on alignment, and any other
+ * mark makes the (mark, space) pair mismatch. So the caller can skip feeding it
+ * everything else without changing decoding results.
+ */
+const InfraredTimings* infrared_common_decoder_idle_preamble(InfraredCommonDecoder* decoder) {
+    furi_assert(decoder);
+
+    if((decoder->state == InfraredCommonDecoderStateWaitPreamble) && !decoder->timings_cnt &&
+       decoder->protocol->timings.preamble_mark) {
+        return &decoder->protocol->timings;
+    }
+
+    return NULL;
+}
+
 InfraredMessage*
     infrared_common_decode(InfraredCommonDecoder* decoder, bool level, uint32_t duration) {
     furi_assert(decoder);
@@ -74,6 +74,7 @@ void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol);
 void infrared_common_decoder_free(InfraredCommonDecoder* decoder);
 void infrared_common_decoder_reset(InfraredCommonDecoder* decoder);
 InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* decoder);
+const InfraredTimings* infrared_common_decoder_idle_preamble(InfraredCommonDecoder* decoder);
 
 InfraredStatus
     infrared_common_encode(InfraredCommonEncoder* encoder, uint32_t* duration, bool* polarity);
@@ -13,6 +13,14 @@
 #include "kaseikyo/infrared_protocol_kaseikyo.h"
 #include "rca/infrared_protocol_rca.h"
 #include "pioneer/infrared_protocol_pioneer.h"
+#include "common/infrared_common_i.h"
+
+// RAW timings are compared in units of this many carrier periods
+#define INFRARED_RAW_UNIT_PERIODS      (8U)
+#define INFRARED_RAW_TOLERANCE_PERCENT (25U)
+#define INFRARED_RAW_FRAME_GAP_US      (6000U)
+// Toggle-bit encoders (RC5, RC6) flip the toggle on every reset, so try both states
+#define INFRARED_RAW_ENCODE_ATTEMPTS (2U)
 
 typedef struct {
     InfraredAlloc alloc;
@@ -20,6 +28,7 @@ typedef struct {
     InfraredDecoderReset reset;
     InfraredFree free;
     InfraredDecoderCheckReady check_ready;
+    InfraredDecoderIdlePreamble idle_preamble;
 } InfraredDecoders;
 
 typedef struct {
@@ -31,6 +40,8 @@ typedef struct {
 
 struct InfraredDecoderHandler {
     void** ctx;
+    const InfraredTimings** preamble;
+    uint32_t idle; /* decoders that only need a matching preamble mark */
 };
 
 struct InfraredEncoderHandler {
@@ -51,6 +62,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_nec_decode,
              .reset = infrared_decoder_nec_reset,
              .check_ready = infrared_decoder_nec_check_ready,
+             .idle_preamble = infrared_decoder_nec_idle_preamble,
              .free = infrared_decoder_nec_free},
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
@@ -65,6 +77,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_samsung32_decode,
              .reset = infrared_decoder_samsung32_reset,
              .check_ready = infrared_decoder_samsung32_check_ready,
+             .idle_preamble = infrared_decoder_samsung32_idle_preamble,
              .free = infrared_decoder_samsung32_free},
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
@@ -93,6 +106,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc6_decode,
              .reset = infrared_decoder_rc6_reset,
              .check_ready = infrared_decoder_rc6_check_ready,
+             .idle_preamble = infrared_decoder_rc6_idle_preamble,
              .free = infrared_decoder_rc6_free},
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
@@ -107,6 +121,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_sirc_decode,
              .reset = infrared_decoder_sirc_reset,
              .check_ready = infrared_decoder_sirc_check_ready,
+             .idle_preamble = infrared_decoder_sirc_idle_preamble,
              .free = infrared_decoder_sirc_free},
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
@@ -121,6 +136,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_pioneer_decode,
              .reset = infrared_decoder_pioneer_reset,
              .check_ready = infrared_decoder_pioneer_check_ready,
+             .idle_preamble = infrared_decoder_pioneer_idle_preamble,
              .free = infrared_decoder_pioneer_free},
         .encoder =
             {.alloc = infrared_encoder_pioneer_alloc,
@@ -135,6 +151,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_kaseikyo_decode,
              .reset = infrared_decoder_kaseikyo_reset,
              .check_ready = infrared_decoder_kaseikyo_check_ready,
+             .idle_preamble = infrared_decoder_kaseikyo_idle_preamble,
              .free = infrared_decoder_kaseikyo_free},
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
@@ -149,6 +166,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rca_decode,
              .reset = infrared_decoder_rca_reset,
              .check_ready = infrared_decoder_rca_check_ready,
+             .idle_preamble = infrared_decoder_rca_idle_preamble,
              .free = infrared_decoder_rca_free},
         .encoder =
             {.alloc = infrared_encoder_rca_alloc,
@@ -162,6 +180,15 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
 static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolVariant* infrared_get_variant_by_protocol(InfraredProtocol protocol);
 
+static inline void infrared_update_idle(InfraredDecoderHandler* handler, size_t index) {
+    const InfraredDecoders* decoder = &infrared_encoder_decoder[index].decoder;
+    if(decoder->idle_preamble && decoder->idle_preamble(handler->ctx[index])) {
+        handler->idle |= (1UL << index);
+    } else {
+        handler->idle &= ~(1UL << index);
+    }
+}
+
 const InfraredMessage*
     infrared_decode(InfraredDecoderHandler* handler, bool level, uint32_t duration) {
     furi_check(handler);
@@ -169,12 +196,26 @@ const InfraredMessage*
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
+    /* Busy decoders get every timing, idle ones only a mark matching their preamble */
+    uint32_t active = ~handler->idle;
+    if(level) {
+        for(uint32_t idle = handler->idle; idle; idle &= idle - 1) {
+            size_t i = __builtin_ctz(idle);
+            float preamble_tolerance = handler->preamble[i]->preamble_tolerance;
+            if(MATCH_TIMING(duration, handler->preamble[i]->preamble_mark, preamble_tolerance)) {
+                active |= (1UL << i);
+            }
+        }
+    }
+
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        if(!(active & (1UL << i))) continue;
         if(infrared_encoder_decoder[i].decoder.decode) {
             message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
             if(!result && message) {
                 result = message;
             }
+            infrared_update_idle(handler, i);
         }
     }
 
@@ -184,6 +225,8 @@ const InfraredMessage*
 InfraredDecoderHandler* infrared_alloc_decoder(void) {
     InfraredDecoderHandler* handler = malloc(sizeof(InfraredDecoderHandler));
     handler->ctx = malloc(sizeof(void*) * COUNT_OF(infrared_encoder_decoder));
+    handler->preamble = malloc(sizeof(InfraredTimings*) * COUNT_OF(infrared_encoder_decoder));
+    handler->idle = 0;
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         handler->ctx[i] = 0;
@@ -192,6 +235,15 @@ InfraredDecoderHandler* infrared_alloc_decoder(void) {
     }
 
     infrared_reset_decoder(handler);
+
+    /* Right after reset every decoder with a preamble is idle */
+    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        handler->preamble[i] = NULL;
+        if(infrared_encoder_decoder[i].decoder.idle_preamble)
+            handler->preamble[i] =
+                infrared_encoder_decoder[i].decoder.idle_preamble(handler->ctx[i]);
+    }
+
     return handler;
 }
 
@@ -204,6 +256,7 @@ void infrared_free_decoder(InfraredDecoderHandler* handler) {
             infrared_encoder_decoder[i].decoder.free(handler->ctx[i]);
     }
 
+    free(handler->preamble);
     free(handler->ctx);
     free(handler);
 }
@@ -214,6 +267,7 @@ void infrared_reset_decoder(InfraredDecoderHandler* handler) {
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         if(infrared_encoder_decoder[i].decoder.reset)
             infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+        infrared_update_idle(handler, i);
     }
 }
 
@@ -229,6 +283,7 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
             if(!result && message) {
                 result = message;
             }
+            infrared_update_idle(handler, i);
         }
     }
 
@@ -353,3 +408,129 @@ float infrared_get_protocol_duty_cycle(InfraredProtocol protocol) {
 size_t infrared_get_protocol_min_repeat_count(InfraredProtocol protocol) {
     return infrared_get_variant_by_protocol(protocol)->repeat_count;
 }
+
+static void infrared_raw_add_message(
+    const InfraredMessage* message,
+    InfraredMessage* result,
+    bool* is_decoded,
+    bool* is_ambiguous) {
+    if(!message || message->repeat) return;
+
+    if(!*is_decoded) {
+        *result = *message;
+        *is_decoded = true;
+    } else if(
+        (message->protocol != result->protocol) || (message->address != result->address) ||
+        (message->command != result->command)) {
+        *is_ambiguous = true;
+    }
+}
+
+static uint32_t infrared_raw_get_unit(uint32_t frequency) {
+    return MAX(INFRARED_RAW_UNIT_PERIODS * 1000000UL / MAX(frequency, 1UL), 1UL);
+}
+
+static bool
+    infrared_raw_timing_is_similar(uint32_t unit, uint32_t a, uint32_t b, bool is_space) {
+    if(is_space && a > INFRARED_RAW_FRAME_GAP_US && b > INFRARED_RAW_FRAME_GAP_US) return true;
+
+    const uint32_t tolerance = MAX(unit / 2, MAX(a, b) * INFRARED_RAW_TOLERANCE_PERCENT / 100);
+    return (a > b ? a - b : b - a) <= tolerance;
+}
+
+/* Encoder output is merged into alternating runs and compared one run per RAW timing.
+ * The capture has to stop at a frame gap, not inside a frame. */
+static bool infrared_raw_is_encoded_message(
+    InfraredEncoderHandler* encoder,
+    const InfraredMessage* message,
+    uint32_t unit,
+    const uint32_t* timings,
+    size_t timings_size) {
+    infrared_reset_encoder(encoder, message);
+
+    // Runs up to and including the space that follows the capture
+    const size_t run_count = timings_size + (timings_size % 2);
+    size_t index = 0;
+    uint32_t run = 0, last_run = 0;
+    bool run_level = true;
+
+    while(index < run_count) {
+        uint32_t duration;
+        bool level;
+        infrared_encode(encoder, &duration, &level);
+
+        if(!duration || (!run && !level)) continue;
+
+        if(run && (level != run_level)) {
+            if((index < timings_size) &&
+               !infrared_raw_timing_is_similar(unit, run, timings[index], !run_level)) {
+                return false;
+            }
+            ++index;
+            last_run = run;
+            run = 0;
+        }
+
+        run += duration;
+        run_level = level;
+    }
+
+    return last_run > INFRARED_RAW_FRAME_GAP_US;
+}
+
+bool infrared_raw_to_message(
+    InfraredDecoderHandler* decoder,
+    InfraredEncoderHandler* encoder,
+    uint32_t frequency,
+    const uint32_t* timings,
+    size_t timings_size,
+    InfraredMessage* message) {
+    furi_check(decoder);
+    furi_check(encoder);
+    furi_check(timings);
+    furi_check(message);
+
+    bool level = true, is_decoded = false, is_ambiguous = false;
+
+    infrared_reset_decoder(decoder);
+    for(size_t i = 0; i < timings_size && !is_ambiguous; ++i) {
+        if(timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+            infrared_raw_add_message(
+                infrared_check_decoder_ready(decoder), message, &is_decoded, &is_ambiguous);
+        }
+        infrared_raw_add_message(
+            infrared_decode(decoder, level, timings[i]), message, &is_decoded, &is_ambiguous);
+        level = !level;
+    }
+    infrared_raw_add_message(
+        infrared_check_decoder_ready(decoder), message, &is_decoded, &is_ambiguous);
+
+    if(!is_decoded || is_ambiguous) return false;
+
+    const uint32_t unit = infrared_raw_get_unit(frequency);
+    for(size_t i = 0; i < INFRARED_RAW_ENCODE_ATTEMPTS; ++i) {
+        if(infrared_raw_is_encoded_message(encoder, message, unit, timings, timings_size)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool infrared_raw_is_similar(
+    uint32_t frequency,
+    const uint32_t* timings_a,
+    const uint32_t* timings_b,
+    size_t timings_size) {
+    furi_check(timings_a);
+    furi_check(timings_b);
+
+    const uint32_t unit = infrared_raw_get_unit(frequency);
+    for(size_t i = 0; i < timings_size; ++i) {
+        if(!infrared_raw_timing_is_similar(unit, timings_a[i], timings_b[i], i % 2)) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -214,6 +214,47 @@ float infrared_get_protocol_duty_cycle(InfraredProtocol protocol);
  */
 size_t infrared_get_protocol_min_repeat_count(InfraredProtocol protocol);
 
+/**
+ * Convert RAW timings to a message.
+ * Succeeds only if every decoded frame carries the same message and that message, encoded
+ * back, reproduces every RAW timing within tolerance (see \c infrared_raw_is_similar()) and
+ * the RAW timings end on a frame boundary.
+ *
+ * \param[in]   decoder     - handler to INFRARED decoder. Should be acquired with \c infrared_alloc_decoder().
+ * \param[in]   encoder     - handler to INFRARED encoder. Should be acquired with \c infrared_alloc_encoder().
+ * \param[in]   frequency   - carrier frequency of the RAW signal.
+ * \param[in]   timings     - RAW timings, starting with a mark.
+ * \param[in]   timings_size - count of RAW timings.
+ * \param[out]  message     - decoded message.
+ *
+ * \return      true if the message fully explains the RAW timings.
+ */
+bool infrared_raw_to_message(
+    InfraredDecoderHandler* decoder,
+    InfraredEncoderHandler* encoder,
+    uint32_t frequency,
+    const uint32_t* timings,
+    size_t timings_size,
+    InfraredMessage* message);
+
+/**
+ * Compare two RAW timing sequences of the same length.
+ * Each pair of timings may differ by half a unit of 8 carrier periods or by 25%, whichever is
+ * larger. Spaces longer than 6 ms are frame gaps and match each other regardless of length.
+ *
+ * \param[in]   frequency   - carrier frequency of both RAW signals.
+ * \param[in]   timings_a   - first RAW timings.
+ * \param[in]   timings_b   - second RAW timings.
+ * \param[in]   timings_size - count of timings in each sequence.
+ *
+ * \return      true if the sequences are the same signal up to capture jitter.
+ */
+bool infrared_raw_is_similar(
+    uint32_t frequency,
+    const uint32_t* timings_a,
+    const uint32_t* timings_b,
+    size_t timings_size);
+
 #ifdef __cplusplus
 }
 #endif
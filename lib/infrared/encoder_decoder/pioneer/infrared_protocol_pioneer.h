@@ -24,6 +24,7 @@
 void* infrared_decoder_pioneer_alloc(void);
 void infrared_decoder_pioneer_reset(void* decoder);
 InfraredMessage* infrared_decoder_pioneer_check_ready(void* decoder);
+const InfraredTimings* infrared_decoder_pioneer_idle_preamble(void* decoder);
 void infrared_decoder_pioneer_free(void* decoder);
 InfraredMessage* infrared_decoder_pioneer_decode(void* decoder, bool level, uint32_t duration);
 
@@ -27,6 +27,7 @@ void* infrared_decoder_rc6_alloc(void);
 void infrared_decoder_rc6_reset(void* decoder);
 void infrared_decoder_rc6_free(void* decoder);
 InfraredMessage* infrared_decoder_rc6_check_ready(void* ctx);
+const InfraredTimings* infrared_decoder_rc6_idle_preamble(void* ctx);
 InfraredMessage* infrared_decoder_rc6_decode(void* decoder, bool level, uint32_t duration);
 
 void* infrared_encoder_rc6_alloc(void);
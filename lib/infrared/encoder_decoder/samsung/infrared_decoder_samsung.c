@@ -5,6 +5,10 @@ InfraredMessage* infrared_decoder_samsung32_check_ready(void* ctx) {
     return infrared_common_decoder_check_ready(ctx);
 }
 
+const InfraredTimings* infrared_decoder_samsung32_idle_preamble(void* ctx) {
+    return infrared_common_decoder_idle_preamble(ctx);
+}
+
 bool infrared_decoder_samsung32_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
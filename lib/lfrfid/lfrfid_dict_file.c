@@ -146,14 +146,14 @@ ProtocolId lfrfid_dict_file_load(ProtocolDict* dict, const char* filename) {
     furi_check(filename);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    FlipperFormat* file = flipper_format_file_alloc(storage);
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
     ProtocolId result = PROTOCOL_NO;
     uint8_t* data = malloc(protocol_dict_get_max_data_size(dict));
     FuriString* str_result;
     str_result = furi_string_alloc();
 
     do {
-        if(!flipper_format_file_open_existing(file, filename)) break;
+        if(!flipper_format_buffered_file_open_existing(file, filename)) break;
 
         // header
         uint32_t version;
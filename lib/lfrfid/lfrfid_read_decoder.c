@@ -0,0 +1,189 @@
+#include "lfrfid_read_decoder.h"
+#include <furi.h>
+
+#define TAG "LfRfidReadDecoder"
+
+#define LFRFID_READ_DECODER_AVERAGE_COUNT 64
+
+struct LFRFIDReadDecoder {
+    ProtocolDict* dict;
+    uint32_t features;
+
+    LFRFIDWorkerReadCallback callback;
+    void* context;
+
+    size_t protocol_count;
+    size_t data_size;
+    uint8_t* protocol_data;
+    // last data and same data reads in a row of every protocol, 0 reads - no candidate
+    uint8_t* candidate_data;
+    size_t* candidate_reads;
+    ProtocolId last_protocol;
+
+    uint32_t average_duration;
+    uint32_t average_pulse;
+    size_t average_index;
+    bool card_detected;
+};
+
+LFRFIDReadDecoder* lfrfid_read_decoder_alloc(ProtocolDict* dict) {
+    furi_check(dict);
+
+    LFRFIDReadDecoder* decoder = malloc(sizeof(LFRFIDReadDecoder));
+    decoder->dict = dict;
+    decoder->protocol_count = protocol_dict_get_protocol_count(dict);
+    decoder->data_size = protocol_dict_get_max_data_size(dict);
+    decoder->protocol_data = malloc(decoder->data_size);
+    decoder->candidate_data = malloc(decoder->data_size * decoder->protocol_count);
+    decoder->candidate_reads = malloc(sizeof(size_t) * decoder->protocol_count);
+    decoder->last_protocol = PROTOCOL_NO;
+    return decoder;
+}
+
+void lfrfid_read_decoder_free(LFRFIDReadDecoder* decoder) {
+    furi_check(decoder);
+
+    free(decoder->candidate_reads);
+    free(decoder->candidate_data);
+    free(decoder->protocol_data);
+    free(decoder);
+}
+
+void lfrfid_read_decoder_set_callback(
+    LFRFIDReadDecoder* decoder,
+    LFRFIDWorkerReadCallback callback,
+    void* context) {
+    furi_check(decoder);
+
+    decoder->callback = callback;
+    decoder->context = context;
+}
+
+void lfrfid_read_decoder_start(LFRFIDReadDecoder* decoder, uint32_t features) {
+    furi_check(decoder);
+
+    decoder->features = features;
+    memset(decoder->candidate_reads, 0, sizeof(size_t) * decoder->protocol_count);
+    decoder->last_protocol = PROTOCOL_NO;
+
+    decoder->average_duration = 0;
+    decoder->average_pulse = 0;
+    decoder->average_index = 0;
+    decoder->card_detected = false;
+
+    protocol_dict_decoders_start(decoder->dict);
+}
+
+static void
+    lfrfid_read_decoder_sense(LFRFIDReadDecoder* decoder, uint32_t pulse, uint32_t duration) {
+    decoder->average_duration += duration;
+    decoder->average_pulse += pulse;
+    decoder->average_index++;
+    if(decoder->average_index < LFRFID_READ_DECODER_AVERAGE_COUNT) return;
+
+    float average = (float)decoder->average_pulse / (float)decoder->average_duration;
+    decoder->average_pulse = 0;
+    decoder->average_duration = 0;
+    decoder->average_index = 0;
+
+    bool card_detected = average > 0.2f && average < 0.8f;
+    if(card_detected != decoder->card_detected) {
+        decoder->card_detected = card_detected;
+        if(decoder->callback) {
+            decoder->callback(
+                card_detected ? LFRFIDWorkerReadSenseStart : LFRFIDWorkerReadSenseEnd,
+                PROTOCOL_NO,
+                decoder->context);
+        }
+    }
+}
+
+static void lfrfid_read_decoder_log(LFRFIDReadDecoder* decoder, ProtocolId protocol) {
+    if(furi_log_get_level() < FuriLogLevelDebug) return;
+
+    FuriString* string_info = furi_string_alloc();
+    size_t data_size = protocol_dict_get_data_size(decoder->dict, protocol);
+    for(size_t i = 0; i < data_size; i++) {
+        if(i != 0) {
+            furi_string_cat_printf(string_info, " ");
+        }
+
+        furi_string_cat_printf(string_info, "%02X", decoder->protocol_data[i]);
+    }
+
+    FURI_LOG_D(
+        TAG,
+        "%s, %zu, [%s]",
+        protocol_dict_get_name(decoder->dict, protocol),
+        decoder->candidate_reads[protocol] - 1,
+        furi_string_get_cstr(string_info));
+    furi_string_free(string_info);
+}
+
+LFRFIDReadDecoderResult lfrfid_read_decoder_feed(
+    LFRFIDReadDecoder* decoder,
+    uint32_t pulse,
+    uint32_t duration,
+    ProtocolId* protocol) {
+    furi_check(decoder);
+    furi_check(protocol);
+
+    lfrfid_read_decoder_sense(decoder, pulse, duration);
+
+    ProtocolId decoded =
+        protocol_dict_decoders_feed_by_feature(decoder->dict, decoder->features, true, pulse);
+    if(decoded == PROTOCOL_NO) {
+        decoded = protocol_dict_decoders_feed_by_feature(
+            decoder->dict, decoder->features, false, duration - pulse);
+    }
+
+    if(decoded == PROTOCOL_NO) return LFRFIDReadDecoderResultNone;
+    furi_check((size_t)decoded < decoder->protocol_count);
+
+    size_t data_size = protocol_dict_get_data_size(decoder->dict, decoded);
+    uint8_t* candidate_data = &decoder->candidate_data[decoded * decoder->data_size];
+    protocol_dict_get_data(decoder->dict, decoded, decoder->protocol_data, data_size);
+
+    // validate protocol against its own previous read only
+    if(decoder->candidate_reads[decoded] > 0 &&
+       memcmp(candidate_data, decoder->protocol_data, data_size) == 0) {
+        decoder->candidate_reads[decoded]++;
+    } else {
+        if(decoder->last_protocol == PROTOCOL_NO && decoder->callback) {
+            decoder->callback(LFRFIDWorkerReadSenseCardStart, decoded, decoder->context);
+        }
+
+        memcpy(candidate_data, decoder->protocol_data, data_size);
+        decoder->candidate_reads[decoded] = 1;
+    }
+    decoder->last_protocol = decoded;
+
+    lfrfid_read_decoder_log(decoder, decoded);
+
+    *protocol = decoded;
+    if(decoder->candidate_reads[decoded] >
+       protocol_dict_get_validate_count(decoder->dict, decoded)) {
+        // keep decoded data in the dictionary for the caller
+        return LFRFIDReadDecoderResultValid;
+    }
+
+    // restart only the decoder that fired, other modulations keep their partial frames
+    protocol_dict_decoders_start_by_id(decoder->dict, decoded);
+
+    return LFRFIDReadDecoderResultCandidate;
+}
+
+void lfrfid_read_decoder_stop(LFRFIDReadDecoder* decoder) {
+    furi_check(decoder);
+
+    if(decoder->last_protocol != PROTOCOL_NO && decoder->callback) {
+        decoder->callback(LFRFIDWorkerReadSenseCardEnd, decoder->last_protocol, decoder->context);
+    }
+
+    if(decoder->card_detected && decoder->callback) {
+        decoder->callback(LFRFIDWorkerReadSenseEnd, decoder->last_protocol, decoder->context);
+    }
+
+    decoder->last_protocol = PROTOCOL_NO;
+    decoder->card_detected = false;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file lfrfid_read_decoder.h
+ *
+ * LF-RFID read decoder
+ *
+ * Turns captured pulse/period pairs into validated protocol reads. Every decoder
+ * of the selected modulations is fed from the same capture, and each protocol
+ * collects its repeated reads on its own, so a false decode of one modulation
+ * never resets the validation of another one.
+ *
+ * Does not touch hardware: the read worker feeds it from the comparator capture,
+ * and it can be fed from a RAW file (see lfrfid_raw_file.h) to replay a capture.
+ */
+
+#pragma once
+#include <toolbox/protocols/protocol_dict.h>
+#include "lfrfid_worker.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    LFRFIDReadDecoderResultNone, /**< Nothing decoded */
+    LFRFIDReadDecoderResultCandidate, /**< Protocol decoded, but not validated yet */
+    LFRFIDReadDecoderResultValid, /**< Protocol decoded with the same data enough times */
+} LFRFIDReadDecoderResult;
+
+typedef struct LFRFIDReadDecoder LFRFIDReadDecoder;
+
+/**
+ * @brief Allocate a new LFRFIDReadDecoder instance
+ *
+ * @param dict LF-RFID protocol dictionary
+ * @return LFRFIDReadDecoder*
+ */
+LFRFIDReadDecoder* lfrfid_read_decoder_alloc(ProtocolDict* dict);
+
+/**
+ * @brief Free a LFRFIDReadDecoder instance
+ *
+ * @param decoder LFRFIDReadDecoder instance
+ */
+void lfrfid_read_decoder_free(LFRFIDReadDecoder* decoder);
+
+/**
+ * @brief Set callback for card sense events
+ *
+ * Called with LFRFIDWorkerReadSenseStart/End when a card-like signal appears or
+ * disappears, and LFRFIDWorkerReadSenseCardStart/End around the first decoded candidate.
+ *
+ * @param decoder LFRFIDReadDecoder instance
+ * @param callback callback, can be NULL
+ * @param context context for callback
+ */
+void lfrfid_read_decoder_set_callback(
+    LFRFIDReadDecoder* decoder,
+    LFRFIDWorkerReadCallback callback,
+    void* context);
+
+/**
+ * @brief Reset decoders and collected reads, start decoding
+ *
+ * @param decoder LFRFIDReadDecoder instance
+ * @param features LFRFIDFeature mask of modulations to decode concurrently
+ */
+void lfrfid_read_decoder_start(LFRFIDReadDecoder* decoder, uint32_t features);
+
+/**
+ * @brief Feed one captured pair
+ *
+ * @param decoder LFRFIDReadDecoder instance
+ * @param pulse high level time, us
+ * @param duration full period time, us
+ * @param protocol decoded protocol, set unless LFRFIDReadDecoderResultNone is returned
+ * @return LFRFIDReadDecoderResult
+ */
+LFRFIDReadDecoderResult lfrfid_read_decoder_feed(
+    LFRFIDReadDecoder* decoder,
+    uint32_t pulse,
+    uint32_t duration,
+    ProtocolId* protocol);
+
+/**
+ * @brief Stop decoding, report the end of sensed signal and card through the callback
+ *
+ * @param decoder LFRFIDReadDecoder instance
+ */
+void lfrfid_read_decoder_stop(LFRFIDReadDecoder* decoder);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,6 +2,7 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include "lfrfid_worker_i.h"
+#include "lfrfid_read_decoder.h"
 #include "tools/t5577.h"
 #include <toolbox/pulse_protocols/pulse_glue.h>
 #include <toolbox/buffer_stream.h>
@@ -22,8 +23,7 @@
 #define LFRFID_WORKER_READ_DEBUG_GPIO_LOAD  &gpio_ext_pa6
 #endif
 
-#define LFRFID_WORKER_READ_AVERAGE_COUNT 64
-#define LFRFID_WORKER_READ_MIN_TIME_US   16
+#define LFRFID_WORKER_READ_MIN_TIME_US 16
 
 #define LFRFID_WORKER_READ_DROP_TIME_MS      50
 #define LFRFID_WORKER_READ_STABILIZE_TIME_MS 450
@@ -129,7 +129,16 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     // stabilize detector
     lfrfid_worker_delay(worker, LFRFID_WORKER_READ_STABILIZE_TIME_MS);
 
-    protocol_dict_decoders_start(worker->protocols);
+    // in auto mode every capture goes through ASK, FSK and PSK decoders at once,
+    // the carrier setup only picks which front-end mode the capture is taken in
+    uint32_t decode_features = feature;
+    if(worker->read_type == LFRFIDWorkerReadTypeAuto) {
+        decode_features = LFRFIDFeatureASK | LFRFIDFeaturePSK;
+    }
+
+    LFRFIDReadDecoder* decoder = lfrfid_read_decoder_alloc(worker->protocols);
+    lfrfid_read_decoder_set_callback(decoder, worker->read_cb, worker->cb_ctx);
+    lfrfid_read_decoder_start(decoder, decode_features);
 
 #ifdef LFRFID_WORKER_READ_DEBUG_GPIO
     furi_hal_gpio_init_simple(LFRFID_WORKER_READ_DEBUG_GPIO_VALUE, GpioModeOutputPushPull);
@@ -146,19 +155,9 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     furi_hal_rfid_tim_read_capture_start(lfrfid_worker_read_capture, &ctx);
 
     *result_protocol = PROTOCOL_NO;
-    ProtocolId last_protocol = PROTOCOL_NO;
-    size_t last_size = protocol_dict_get_max_data_size(worker->protocols);
-    uint8_t* last_data = malloc(last_size);
-    uint8_t* protocol_data = malloc(last_size);
-    size_t last_read_count = 0;
 
     uint32_t switch_os_tick_last = furi_get_tick();
 
-    uint32_t average_duration = 0;
-    uint32_t average_pulse = 0;
-    size_t average_index = 0;
-    bool card_detected = false;
-
     FURI_LOG_D(TAG, "Read started");
     while(true) {
         if(lfrfid_worker_check_for_stop(worker)) {
@@ -203,95 +202,19 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
             } else {
                 index += tmp_size;
 
-                average_duration += duration;
-                average_pulse += pulse;
-                average_index++;
-                if(average_index >= LFRFID_WORKER_READ_AVERAGE_COUNT) {
-                    float average = (float)average_pulse / (float)average_duration;
-                    average_pulse = 0;
-                    average_duration = 0;
-                    average_index = 0;
-
-                    if(worker->read_cb) {
-                        if(average > 0.2f && average < 0.8f) {
-                            if(!card_detected) {
-                                card_detected = true;
-                                worker->read_cb(
-                                    LFRFIDWorkerReadSenseStart, PROTOCOL_NO, worker->cb_ctx);
-                            }
-                        } else {
-                            if(card_detected) {
-                                card_detected = false;
-                                worker->read_cb(
-                                    LFRFIDWorkerReadSenseEnd, PROTOCOL_NO, worker->cb_ctx);
-                            }
-                        }
-                    }
-                }
-
                 ProtocolId protocol = PROTOCOL_NO;
+                LFRFIDReadDecoderResult result =
+                    lfrfid_read_decoder_feed(decoder, pulse, duration, &protocol);
 
-                protocol = protocol_dict_decoders_feed_by_feature(
-                    worker->protocols, feature, true, pulse);
-                if(protocol == PROTOCOL_NO) {
-                    protocol = protocol_dict_decoders_feed_by_feature(
-                        worker->protocols, feature, false, duration - pulse);
-                }
-
-                if(protocol != PROTOCOL_NO) {
+                if(result != LFRFIDReadDecoderResultNone) {
                     // reset switch timer
                     switch_os_tick_last = furi_get_tick();
+                }
 
-                    size_t protocol_data_size =
-                        protocol_dict_get_data_size(worker->protocols, protocol);
-                    protocol_dict_get_data(
-                        worker->protocols, protocol, protocol_data, protocol_data_size);
-
-                    // validate protocol
-                    if(protocol == last_protocol &&
-                       memcmp(last_data, protocol_data, protocol_data_size) == 0) {
-                        last_read_count = last_read_count + 1;
-
-                        size_t validation_count =
-                            protocol_dict_get_validate_count(worker->protocols, protocol);
-
-                        if(last_read_count >= validation_count) {
-                            state = LFRFIDWorkerReadOK;
-                            *result_protocol = protocol;
-                            break;
-                        }
-                    } else {
-                        if(last_protocol == PROTOCOL_NO && worker->read_cb) {
-                            worker->read_cb(
-                                LFRFIDWorkerReadSenseCardStart, protocol, worker->cb_ctx);
-                        }
-
-                        last_protocol = protocol;
-                        memcpy(last_data, protocol_data, protocol_data_size);
-                        last_read_count = 0;
-                    }
-
-                    if(furi_log_get_level() >= FuriLogLevelDebug) {
-                        FuriString* string_info;
-                        string_info = furi_string_alloc();
-                        for(uint8_t i = 0; i < protocol_data_size; i++) {
-                            if(i != 0) {
-                                furi_string_cat_printf(string_info, " ");
-                            }
-
-                            furi_string_cat_printf(string_info, "%02X", protocol_data[i]);
-                        }
-
-                        FURI_LOG_D(
-                            TAG,
-                            "%s, %zu, [%s]",
-                            protocol_dict_get_name(worker->protocols, protocol),
-                            last_read_count,
-                            furi_string_get_cstr(string_info));
-                        furi_string_free(string_info);
-                    }
-
-                    protocol_dict_decoders_start(worker->protocols);
+                if(result == LFRFIDReadDecoderResultValid) {
+                    state = LFRFIDWorkerReadOK;
+                    *result_protocol = protocol;
+                    break;
                 }
             }
         }
@@ -314,13 +237,7 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
 
     FURI_LOG_D(TAG, "Read stopped");
 
-    if(last_protocol != PROTOCOL_NO && worker->read_cb) {
-        worker->read_cb(LFRFIDWorkerReadSenseCardEnd, last_protocol, worker->cb_ctx);
-    }
-
-    if(card_detected && worker->read_cb) {
-        worker->read_cb(LFRFIDWorkerReadSenseEnd, last_protocol, worker->cb_ctx);
-    }
+    lfrfid_read_decoder_stop(decoder);
 
     furi_hal_rfid_tim_read_capture_stop();
     furi_hal_rfid_tim_read_stop();
@@ -329,8 +246,7 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     varint_pair_free(ctx.pair);
     buffer_stream_free(ctx.stream);
 
-    free(protocol_data);
-    free(last_data);
+    lfrfid_read_decoder_free(decoder);
 
 #ifdef LFRFID_WORKER_READ_DEBUG_GPIO
     furi_hal_gpio_write(LFRFID_WORKER_READ_DEBUG_GPIO_VALUE, false);
@@ -14,9 +14,12 @@
 #define AWID_ENCODED_BIT_SIZE  (96)
 #define AWID_ENCODED_DATA_SIZE (((AWID_ENCODED_BIT_SIZE) / 8) + 1)
 #define AWID_ENCODED_DATA_LAST (AWID_ENCODED_DATA_SIZE - 1)
+#define AWID_ENCODED_RING_BITS (AWID_ENCODED_DATA_SIZE * 8)
 
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(AWID_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolAwidDecoder;
 
 typedef struct {
@@ -51,6 +54,17 @@ uint8_t* protocol_awid_get_data(ProtocolAwid* protocol) {
 
 void protocol_awid_decoder_start(ProtocolAwid* protocol) {
     memset(protocol->encoded_data, 0, AWID_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->decoder.encoded_ring,
+        protocol->decoder.encoded_ring_data,
+        AWID_ENCODED_RING_BITS);
+}
+
+static bool protocol_awid_decoder_push_bit(ProtocolAwid* protocol, bool bit) {
+    ProtocolAwidDecoder* decoder = &protocol->decoder;
+    bit_lib_ring_push(&decoder->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &decoder->encoded_ring, protocol->encoded_data, 8, 0b00000001, AWID_ENCODED_DATA_LAST * 8);
 }
 
 static bool protocol_awid_can_be_decoded(uint8_t* data) {
@@ -101,8 +115,8 @@ bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t dur
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, AWID_ENCODED_DATA_SIZE, value);
-            if(protocol_awid_can_be_decoded(protocol->encoded_data)) {
+            if(protocol_awid_decoder_push_bit(protocol, value) &&
+               protocol_awid_can_be_decoded(protocol->encoded_data)) {
                 protocol_awid_decode(protocol->encoded_data, protocol->data);
 
                 result = true;
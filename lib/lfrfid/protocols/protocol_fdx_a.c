@@ -16,12 +16,16 @@
 #define FDXA_ENCODED_BIT_SIZE  ((FDXA_PREAMBLE_SIZE + FDXA_DATA_SIZE) * 8)
 #define FDXA_DECODED_DATA_SIZE (5)
 #define FDXA_DECODED_BIT_SIZE  ((FDXA_ENCODED_BIT_SIZE - FDXA_PREAMBLE_SIZE * 8) / 2)
+#define FDXA_ENCODED_RING_BITS (FDXA_ENCODED_DATA_SIZE * 8)
 
 #define FDXA_PREAMBLE_0 0x55
 #define FDXA_PREAMBLE_1 0x1D
+#define FDXA_PREAMBLE   ((FDXA_PREAMBLE_0 << 8) | FDXA_PREAMBLE_1)
 
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(FDXA_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolFDXADecoder;
 
 typedef struct {
@@ -58,6 +62,10 @@ uint8_t* protocol_fdx_a_get_data(ProtocolFDXA* protocol) {
 
 void protocol_fdx_a_decoder_start(ProtocolFDXA* protocol) {
     memset(protocol->encoded_data, 0, FDXA_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->decoder.encoded_ring,
+        protocol->decoder.encoded_ring_data,
+        FDXA_ENCODED_RING_BITS);
 }
 
 static bool protocol_fdx_a_decode(const uint8_t* from, uint8_t* to) {
@@ -107,6 +115,13 @@ static bool protocol_fdx_a_can_be_decoded(const uint8_t* data) {
     return parity_sum == 0;
 }
 
+static bool protocol_fdx_a_decoder_push_bit(ProtocolFDXA* protocol, bool bit) {
+    ProtocolFDXADecoder* decoder = &protocol->decoder;
+    bit_lib_ring_push(&decoder->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &decoder->encoded_ring, protocol->encoded_data, 16, FDXA_PREAMBLE, FDXA_ENCODED_BIT_SIZE);
+}
+
 bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
     bool value;
     uint32_t count;
@@ -115,8 +130,8 @@ bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t du
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, FDXA_ENCODED_DATA_SIZE, value);
-            if(protocol_fdx_a_can_be_decoded(protocol->encoded_data)) {
+            if(protocol_fdx_a_decoder_push_bit(protocol, value) &&
+               protocol_fdx_a_can_be_decoded(protocol->encoded_data)) {
                 protocol_fdx_a_decode(protocol->encoded_data, protocol->data);
                 result = true;
             }
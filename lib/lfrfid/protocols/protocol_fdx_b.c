@@ -11,6 +11,7 @@
 #define FDX_B_PREAMBLE_BIT_SIZE      (11)
 #define FDX_B_PREAMBLE_BYTE_SIZE     (2)
 #define FDX_B_ENCODED_BYTE_FULL_SIZE (FDX_B_ENCODED_BYTE_SIZE + FDX_B_PREAMBLE_BYTE_SIZE)
+#define FDX_B_ENCODED_RING_BITS      (FDX_B_ENCODED_BYTE_FULL_SIZE * 8)
 
 #define FDXB_DECODED_DATA_SIZE (11)
 
@@ -28,6 +29,8 @@ typedef struct {
     bool last_level;
     size_t encoded_index;
     uint8_t encoded_data[FDX_B_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(FDX_B_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
     uint8_t data[FDXB_DECODED_DATA_SIZE];
 } ProtocolFDXB;
 
@@ -47,6 +50,8 @@ uint8_t* protocol_fdx_b_get_data(ProtocolFDXB* proto) {
 void protocol_fdx_b_decoder_start(ProtocolFDXB* protocol) {
     memset(protocol->encoded_data, 0, FDX_B_ENCODED_BYTE_FULL_SIZE);
     protocol->last_short = false;
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, FDX_B_ENCODED_RING_BITS);
 }
 
 static bool protocol_fdx_b_can_be_decoded(ProtocolFDXB* protocol) {
@@ -145,25 +150,29 @@ void protocol_fdx_b_decode(ProtocolFDXB* protocol) {
     // bit_lib_print_regions(regions_decoded, 4, protocol->data, FDXB_DECODED_DATA_SIZE * 8);
 }
 
+static bool protocol_fdx_b_decoder_push_bit(ProtocolFDXB* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->encoded_data, 11, 0b10000000000, 128);
+}
+
 bool protocol_fdx_b_decoder_feed(ProtocolFDXB* protocol, bool level, uint32_t duration) {
     bool result = false;
     UNUSED(level);
 
-    bool pushed = false;
+    bool framed = false;
 
     // Bi-Phase Manchester decoding
     if(duration >= FDX_B_SHORT_TIME_LOW && duration <= FDX_B_SHORT_TIME_HIGH) {
         if(protocol->last_short == false) {
             protocol->last_short = true;
         } else {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, false);
+            framed = protocol_fdx_b_decoder_push_bit(protocol, false);
             protocol->last_short = false;
         }
     } else if(duration >= FDX_B_LONG_TIME_LOW && duration <= FDX_B_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, true);
+            framed = protocol_fdx_b_decoder_push_bit(protocol, true);
         } else {
             // reset
             protocol->last_short = false;
@@ -173,7 +182,7 @@ bool protocol_fdx_b_decoder_feed(ProtocolFDXB* protocol, bool level, uint32_t du
         protocol->last_short = false;
     }
 
-    if(pushed && protocol_fdx_b_can_be_decoded(protocol)) {
+    if(framed && protocol_fdx_b_can_be_decoded(protocol)) {
         protocol_fdx_b_decode(protocol);
         result = true;
     }
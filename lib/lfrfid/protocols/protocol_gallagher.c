@@ -12,6 +12,7 @@
 #define GALLAGHER_PREAMBLE_BYTE_SIZE ((GALLAGHER_PREAMBLE_BIT_SIZE) / 8)
 #define GALLAGHER_ENCODED_BYTE_FULL_SIZE \
     (GALLAGHER_ENCODED_BYTE_SIZE + GALLAGHER_PREAMBLE_BYTE_SIZE)
+#define GALLAGHER_ENCODED_RING_BITS (GALLAGHER_ENCODED_BYTE_FULL_SIZE * 8)
 #define GALLAGHER_DECODED_DATA_SIZE 8
 
 #define GALLAGHER_READ_SHORT_TIME  (128)
@@ -26,6 +27,8 @@
 typedef struct {
     uint8_t data[GALLAGHER_DECODED_DATA_SIZE];
     uint8_t encoded_data[GALLAGHER_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(GALLAGHER_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 
     uint8_t encoded_data_index;
     bool encoded_polarity;
@@ -147,6 +150,8 @@ static bool protocol_gallagher_can_be_decoded(ProtocolGallagher* protocol) {
 
 void protocol_gallagher_decoder_start(ProtocolGallagher* protocol) {
     memset(protocol->encoded_data, 0, GALLAGHER_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, GALLAGHER_ENCODED_RING_BITS);
     manchester_advance(
         protocol->decoder_manchester_state,
         ManchesterEventReset,
@@ -154,6 +159,12 @@ void protocol_gallagher_decoder_start(ProtocolGallagher* protocol) {
         NULL);
 }
 
+static bool protocol_gallagher_decoder_push_bit(ProtocolGallagher* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->encoded_data, 16, 0b0111111111101010, 96);
+}
+
 bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, uint32_t duration) {
     bool result = false;
 
@@ -179,9 +190,8 @@ bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, ui
             protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
 
         if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, GALLAGHER_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_gallagher_can_be_decoded(protocol)) {
+            if(protocol_gallagher_decoder_push_bit(protocol, data) &&
+               protocol_gallagher_can_be_decoded(protocol)) {
                 protocol_gallagher_decode(protocol);
                 result = true;
             }
@@ -10,6 +10,8 @@
 #define GPROXII_ENCODED_BYTE_FULL_SIZE \
     (((GPROXII_PREAMBLE_BIT_SIZE + GPROXII_ENCODED_BIT_SIZE) / 8))
 
+#define GPROXII_ENCODED_RING_BITS (GPROXII_ENCODED_BYTE_FULL_SIZE * 8)
+
 #define GPROXII_DATA_SIZE (12)
 
 #define GPROXII_SHORT_TIME  (256)
@@ -27,6 +29,8 @@ typedef struct {
     size_t encoded_index;
     uint8_t decoded_data[GPROXII_ENCODED_BYTE_FULL_SIZE];
     uint8_t data[GPROXII_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(GPROXII_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolGProxII;
 
 ProtocolGProxII* protocol_gproxii_alloc(void) {
@@ -44,9 +48,16 @@ uint8_t* protocol_gproxii_get_data(ProtocolGProxII* proto) {
 
 void protocol_gproxii_decoder_start(ProtocolGProxII* protocol) {
     memset(protocol->data, 0, GPROXII_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, GPROXII_ENCODED_RING_BITS);
     protocol->last_short = false;
 }
 
+static bool protocol_gproxii_decoder_push_bit(ProtocolGProxII* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(&protocol->encoded_ring, protocol->data, 6, 0b111110, 0);
+}
+
 static bool protocol_gproxii_can_be_decoded(ProtocolGProxII* protocol) {
     // 96 bit with 5 bit zero parity
     // 0           10            20            30            40            50            60            70            80            90
@@ -118,21 +129,19 @@ static bool protocol_gproxii_can_be_decoded(ProtocolGProxII* protocol) {
 
 bool protocol_gproxii_decoder_feed(ProtocolGProxII* protocol, bool level, uint32_t duration) {
     UNUSED(level);
-    bool pushed = false;
+    bool framed = false;
 
     // Bi-Phase Manchester decoding inverse. Short = 1, Long = 0
     if(duration >= GPROXII_SHORT_TIME_LOW && duration <= GPROXII_SHORT_TIME_HIGH) {
         if(protocol->last_short == false) {
             protocol->last_short = true;
         } else {
-            pushed = true;
-            bit_lib_push_bit(protocol->data, GPROXII_ENCODED_BYTE_FULL_SIZE, true);
+            framed = protocol_gproxii_decoder_push_bit(protocol, true);
             protocol->last_short = false;
         }
     } else if(duration >= GPROXII_LONG_TIME_LOW && duration <= GPROXII_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
-            pushed = true;
-            bit_lib_push_bit(protocol->data, GPROXII_ENCODED_BYTE_FULL_SIZE, false);
+            framed = protocol_gproxii_decoder_push_bit(protocol, false);
         } else {
             // reset
             protocol->last_short = false;
@@ -142,7 +151,7 @@ bool protocol_gproxii_decoder_feed(ProtocolGProxII* protocol, bool level, uint32
         protocol->last_short = false;
     }
 
-    if(pushed && protocol_gproxii_can_be_decoded(protocol)) {
+    if(framed && protocol_gproxii_can_be_decoded(protocol)) {
         return true;
     }
 
@@ -17,11 +17,14 @@
 #define HID_ENCODED_BIT_SIZE  ((HID_PREAMBLE_SIZE + HID_DATA_SIZE) * 8)
 #define HID_DECODED_DATA_SIZE (6)
 #define HID_DECODED_BIT_SIZE  ((HID_ENCODED_BIT_SIZE - HID_PREAMBLE_SIZE * 8) / 2)
+#define HID_ENCODED_RING_BITS (HID_ENCODED_DATA_SIZE * 8)
 
 #define HID_PREAMBLE 0x1D
 
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(HID_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolHIDDecoder;
 
 typedef struct {
@@ -57,6 +60,10 @@ uint8_t* protocol_hid_generic_get_data(ProtocolHID* protocol) {
 
 void protocol_hid_generic_decoder_start(ProtocolHID* protocol) {
     memset(protocol->encoded_data, 0, HID_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->decoder.encoded_ring,
+        protocol->decoder.encoded_ring_data,
+        HID_ENCODED_RING_BITS);
 }
 
 static bool protocol_hid_generic_can_be_decoded(const uint8_t* data) {
@@ -125,6 +132,13 @@ static uint8_t protocol_hid_generic_decode_protocol_size(ProtocolHID* protocol)
     return size < 26 ? HID_PROTOCOL_SIZE_UNKNOWN : size;
 }
 
+static bool protocol_hid_generic_decoder_push_bit(ProtocolHID* protocol, bool bit) {
+    ProtocolHIDDecoder* decoder = &protocol->decoder;
+    bit_lib_ring_push(&decoder->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &decoder->encoded_ring, protocol->encoded_data, 8, HID_PREAMBLE, HID_ENCODED_BIT_SIZE);
+}
+
 bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32_t duration) {
     bool value;
     uint32_t count;
@@ -133,8 +147,8 @@ bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
-            if(protocol_hid_generic_can_be_decoded(protocol->encoded_data)) {
+            if(protocol_hid_generic_decoder_push_bit(protocol, value) &&
+               protocol_hid_generic_can_be_decoded(protocol->encoded_data)) {
                 protocol_hid_generic_decode(protocol->encoded_data, protocol->data);
                 result = true;
             }
@@ -8,6 +8,7 @@
 // 4    9    4    4    5    4    4    B      3    5    1    F    B    E    4    B
 // 0100 1001 0100 0100 0101 0100 0100 1011   0011 0101 0001 1111 1011 1110 0100 1011
 
+#define IDTECK_PREAMBLE           (0x4944544BULL)
 #define IDTECK_PREAMBLE_BIT_SIZE  (32)
 #define IDTECK_PREAMBLE_DATA_SIZE (8)
 
@@ -15,6 +16,8 @@
 #define IDTECK_ENCODED_DATA_SIZE (((IDTECK_ENCODED_BIT_SIZE) / 8) + IDTECK_PREAMBLE_DATA_SIZE)
 #define IDTECK_ENCODED_DATA_LAST ((IDTECK_ENCODED_BIT_SIZE) / 8)
 
+#define IDTECK_ENCODED_RING_BITS (IDTECK_ENCODED_DATA_SIZE * 8)
+
 #define IDTECK_DECODED_BIT_SIZE  (64)
 #define IDTECK_DECODED_DATA_SIZE (8)
 
@@ -31,9 +34,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[IDTECK_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[IDTECK_ENCODED_DATA_SIZE];
+    uint8_t encoded_ring_data[4][BIT_LIB_RING_SIZE(IDTECK_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
+    BitLibRing negative_encoded_ring;
+    BitLibRing corrupted_encoded_ring;
+    BitLibRing corrupted_negative_encoded_ring;
 
     uint8_t data[IDTECK_DECODED_DATA_SIZE];
     ProtocolIdteckEncoder encoder;
@@ -54,15 +59,25 @@ uint8_t* protocol_idteck_get_data(ProtocolIdteck* protocol) {
 
 void protocol_idteck_decoder_start(ProtocolIdteck* protocol) {
     memset(protocol->encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data[0], IDTECK_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->negative_encoded_ring,
+        protocol->encoded_ring_data[1],
+        IDTECK_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_encoded_ring,
+        protocol->encoded_ring_data[2],
+        IDTECK_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_negative_encoded_ring,
+        protocol->encoded_ring_data[3],
+        IDTECK_ENCODED_RING_BITS);
 }
 
 static bool protocol_idteck_check_preamble(uint8_t* data, size_t bit_index) {
     // Preamble 01001001 01000100 01010100 01001011
-    if(*(uint32_t*)&data[bit_index / 8] != 0b01001011010101000100010001001001) return false;
-    return true;
+    return bit_lib_get_bits_64(data, bit_index, IDTECK_PREAMBLE_BIT_SIZE) == IDTECK_PREAMBLE;
 }
 
 static bool protocol_idteck_can_be_decoded(uint8_t* data) {
@@ -70,7 +85,11 @@ static bool protocol_idteck_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_idteck_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
+static bool protocol_idteck_decoder_feed_internal(
+    bool polarity,
+    uint32_t time,
+    BitLibRing* ring,
+    uint8_t* data) {
     time += (IDTECK_US_PER_BIT / 2);
 
     size_t bit_count = (time / IDTECK_US_PER_BIT);
@@ -78,7 +97,11 @@ static bool protocol_idteck_decoder_feed_internal(bool polarity, uint32_t time,
 
     if(bit_count < IDTECK_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, IDTECK_ENCODED_DATA_SIZE, polarity);
+            bit_lib_ring_push(ring, polarity);
+            if(!bit_lib_ring_copy_if(ring, data, IDTECK_PREAMBLE_BIT_SIZE, IDTECK_PREAMBLE, 0)) {
+                continue;
+            }
+
             if(protocol_idteck_can_be_decoded(data)) {
                 result = true;
                 break;
@@ -97,7 +120,8 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
     bool result = false;
 
     if(duration > (IDTECK_US_PER_BIT / 2)) {
-        if(protocol_idteck_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+        if(protocol_idteck_decoder_feed_internal(
+               level, duration, &protocol->encoded_ring, protocol->encoded_data)) {
             protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Positive");
             result = true;
@@ -105,8 +129,8 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_idteck_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level, duration, &protocol->negative_encoded_ring, protocol->encoded_data)) {
+            protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Negative");
             result = true;
             return result;
@@ -124,8 +148,8 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_idteck_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level, duration, &protocol->corrupted_encoded_ring, protocol->encoded_data)) {
+            protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Positive Corrupted");
 
             result = true;
@@ -133,9 +157,12 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level,
+               duration,
+               &protocol->corrupted_negative_encoded_ring,
+               protocol->encoded_data)) {
             protocol_idteck_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+                protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Negative Corrupted");
 
             result = true;
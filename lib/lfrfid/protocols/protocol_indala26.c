@@ -3,6 +3,7 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
+#define INDALA26_PREAMBLE           (0x140000001ULL)
 #define INDALA26_PREAMBLE_BIT_SIZE  (33)
 #define INDALA26_PREAMBLE_DATA_SIZE (5)
 
@@ -11,6 +12,8 @@
     (((INDALA26_ENCODED_BIT_SIZE) / 8) + INDALA26_PREAMBLE_DATA_SIZE)
 #define INDALA26_ENCODED_DATA_LAST ((INDALA26_ENCODED_BIT_SIZE) / 8)
 
+#define INDALA26_ENCODED_RING_BITS (INDALA26_ENCODED_DATA_SIZE * 8)
+
 #define INDALA26_DECODED_BIT_SIZE  (28)
 #define INDALA26_DECODED_DATA_SIZE (4)
 
@@ -27,9 +30,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
+    uint8_t encoded_ring_data[4][BIT_LIB_RING_SIZE(INDALA26_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
+    BitLibRing negative_encoded_ring;
+    BitLibRing corrupted_encoded_ring;
+    BitLibRing corrupted_negative_encoded_ring;
 
     uint8_t data[INDALA26_DECODED_DATA_SIZE];
     ProtocolIndalaEncoder encoder;
@@ -50,16 +55,25 @@ uint8_t* protocol_indala26_get_data(ProtocolIndala* protocol) {
 
 void protocol_indala26_decoder_start(ProtocolIndala* protocol) {
     memset(protocol->encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data[0], INDALA26_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->negative_encoded_ring,
+        protocol->encoded_ring_data[1],
+        INDALA26_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_encoded_ring,
+        protocol->encoded_ring_data[2],
+        INDALA26_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_negative_encoded_ring,
+        protocol->encoded_ring_data[3],
+        INDALA26_ENCODED_RING_BITS);
 }
 
 static bool protocol_indala26_check_preamble(uint8_t* data, size_t bit_index) {
     // Preamble 10100000 00000000 00000000 00000000 1
-    if(*(uint32_t*)&data[bit_index / 8] != 0b00000000000000000000000010100000) return false;
-    if(bit_lib_get_bit(data, bit_index + 32) != 1) return false;
-    return true;
+    return bit_lib_get_bits_64(data, bit_index, INDALA26_PREAMBLE_BIT_SIZE) == INDALA26_PREAMBLE;
 }
 
 static bool protocol_indala26_can_be_decoded(uint8_t* data) {
@@ -70,7 +84,11 @@ static bool protocol_indala26_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
+static bool protocol_indala26_decoder_feed_internal(
+    bool polarity,
+    uint32_t time,
+    BitLibRing* ring,
+    uint8_t* data) {
     time += (INDALA26_US_PER_BIT / 2);
 
     size_t bit_count = (time / INDALA26_US_PER_BIT);
@@ -78,7 +96,12 @@ static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time
 
     if(bit_count < INDALA26_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, INDALA26_ENCODED_DATA_SIZE, polarity);
+            bit_lib_ring_push(ring, polarity);
+            if(!bit_lib_ring_copy_if(
+                   ring, data, INDALA26_PREAMBLE_BIT_SIZE, INDALA26_PREAMBLE, 64)) {
+                continue;
+            }
+
             if(protocol_indala26_can_be_decoded(data)) {
                 result = true;
                 break;
@@ -99,7 +122,8 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
     bool result = false;
 
     if(duration > (INDALA26_US_PER_BIT / 2)) {
-        if(protocol_indala26_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+        if(protocol_indala26_decoder_feed_internal(
+               level, duration, &protocol->encoded_ring, protocol->encoded_data)) {
             protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Positive");
             result = true;
@@ -107,8 +131,8 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level, duration, &protocol->negative_encoded_ring, protocol->encoded_data)) {
+            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Negative");
             result = true;
             return result;
@@ -126,8 +150,8 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level, duration, &protocol->corrupted_encoded_ring, protocol->encoded_data)) {
+            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Positive Corrupted");
 
             result = true;
@@ -135,9 +159,12 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level,
+               duration,
+               &protocol->corrupted_negative_encoded_ring,
+               protocol->encoded_data)) {
             protocol_indala26_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+                protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Negative Corrupted");
 
             result = true;
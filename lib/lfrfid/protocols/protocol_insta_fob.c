@@ -17,6 +17,7 @@
 #define INSTAFOB_ENCODED_DATA_SIZE_BYTES ((4 * 7) + 1)
 #define INSTAFOB_ENCODED_DATA_SIZE_BITS  ((8 * 4 * 7) + 1)
 #define INSTAFOB_ENCODED_DATA_OFFSET     (7)
+#define INSTAFOB_ENCODED_RING_BITS       (INSTAFOB_ENCODED_DATA_SIZE_BYTES * 8)
 
 #define INSTAFOB_BLOCK1 (0x00107060)
 
@@ -44,6 +45,8 @@ typedef struct {
     uint8_t data[INSTAFOB_DECODED_DATA_SIZE_BYTES];
 
     uint8_t encoded_data[INSTAFOB_ENCODED_DATA_SIZE_BYTES];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(INSTAFOB_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
     uint8_t encoded_data_index;
     bool encoded_polarity;
     ProtocolInstaFobSeqTermState encoded_term_state;
@@ -68,9 +71,24 @@ uint8_t* protocol_insta_fob_get_data(ProtocolInstaFob* protocol) {
     return protocol->data;
 }
 
+static void protocol_insta_fob_decoder_clear(ProtocolInstaFob* protocol) {
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, INSTAFOB_ENCODED_RING_BITS);
+}
+
+static void protocol_insta_fob_decoder_push_bit(ProtocolInstaFob* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+}
+
+// Bits are pushed into a ring and only copied out once a sequence terminator is seen
+static void protocol_insta_fob_decoder_copy_bits(ProtocolInstaFob* protocol) {
+    bit_lib_ring_copy(&protocol->encoded_ring, protocol->encoded_data);
+}
+
 void protocol_insta_fob_decoder_start(ProtocolInstaFob* protocol) {
     memset(protocol->data, 0, INSTAFOB_DECODED_DATA_SIZE_BYTES);
     memset(protocol->encoded_data, 0, INSTAFOB_ENCODED_DATA_SIZE_BYTES);
+    protocol_insta_fob_decoder_clear(protocol);
     manchester_advance(
         protocol->decoder_manchester_state,
         ManchesterEventReset,
@@ -157,6 +175,7 @@ static bool protocol_insta_fob_decoder_seq_terminator(
         // We found the last part of sequence terminator!
 
         // Check if our data is valid.
+        protocol_insta_fob_decoder_copy_bits(protocol);
         if(protocol_insta_fob_can_be_decoded(protocol)) {
             protocol_insta_fob_decode(protocol);
             decoded_signal = true;
@@ -164,7 +183,7 @@ static bool protocol_insta_fob_decoder_seq_terminator(
             FURI_LOG_D(TAG, "Decoded %s", protocol_insta_fob_get_encoded_data(protocol));
 
             // Clear the encoded data, reset to the first bit.
-            memset(protocol->encoded_data, 0, INSTAFOB_ENCODED_DATA_SIZE_BYTES);
+            protocol_insta_fob_decoder_clear(protocol);
             protocol->encoded_polarity = false;
         } else {
             FURI_LOG_D(TAG, "Failed decoding %s", protocol_insta_fob_get_encoded_data(protocol));
@@ -196,14 +215,15 @@ bool protocol_insta_fob_decoder_feed(ProtocolInstaFob* protocol, bool level, uin
         // Mark that we read the second half of signal
         protocol->encoded_polarity = false;
 
-        bit_lib_push_bit(protocol->encoded_data, INSTAFOB_ENCODED_DATA_SIZE_BYTES, data);
+        protocol_insta_fob_decoder_push_bit(protocol, data);
 
 #ifdef INSTAFOB_CHECK_AS_WE_GO
+        protocol_insta_fob_decoder_copy_bits(protocol);
         if(protocol_insta_fob_can_be_decoded(protocol)) {
             protocol_insta_fob_decode(protocol);
             decoded_signal = true;
 
-            memset(protocol->encoded_data, 0, INSTAFOB_ENCODED_DATA_SIZE_BYTES);
+            protocol_insta_fob_decoder_clear(protocol);
             protocol->encoded_polarity = false;
         }
 #endif
@@ -212,8 +232,8 @@ bool protocol_insta_fob_decoder_feed(ProtocolInstaFob* protocol, bool level, uin
         // If it is true, then we are actually at the beginning of the first set bit.
 
         if(protocol->encoded_polarity) {
-            memset(protocol->encoded_data, 0, INSTAFOB_ENCODED_DATA_SIZE_BYTES);
-            bit_lib_push_bit(protocol->encoded_data, INSTAFOB_ENCODED_DATA_SIZE_BYTES, 1);
+            protocol_insta_fob_decoder_clear(protocol);
+            protocol_insta_fob_decoder_push_bit(protocol, 1);
         }
 
         // Mark that we read the first half of signal
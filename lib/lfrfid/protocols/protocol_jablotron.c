@@ -11,6 +11,7 @@
 #define JABLOTRON_PREAMBLE_BYTE_SIZE (2)
 #define JABLOTRON_ENCODED_BYTE_FULL_SIZE \
     (JABLOTRON_ENCODED_BYTE_SIZE + JABLOTRON_PREAMBLE_BYTE_SIZE)
+#define JABLOTRON_ENCODED_RING_BITS (JABLOTRON_ENCODED_BYTE_FULL_SIZE * 8)
 
 #define JABLOTRON_DECODED_DATA_SIZE (5)
 
@@ -28,6 +29,8 @@ typedef struct {
     bool last_level;
     size_t encoded_index;
     uint8_t encoded_data[JABLOTRON_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(JABLOTRON_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
     uint8_t data[JABLOTRON_DECODED_DATA_SIZE];
 } ProtocolJablotron;
 
@@ -47,6 +50,8 @@ uint8_t* protocol_jablotron_get_data(ProtocolJablotron* proto) {
 void protocol_jablotron_decoder_start(ProtocolJablotron* protocol) {
     memset(protocol->encoded_data, 0, JABLOTRON_ENCODED_BYTE_FULL_SIZE);
     protocol->last_short = false;
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, JABLOTRON_ENCODED_RING_BITS);
 }
 
 uint8_t protocol_jablotron_checksum(uint8_t* bits) {
@@ -83,23 +88,27 @@ void protocol_jablotron_decode(ProtocolJablotron* protocol) {
     bit_lib_copy_bits(protocol->data, 0, 40, protocol->encoded_data, 16);
 }
 
+static bool protocol_jablotron_decoder_push_bit(ProtocolJablotron* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->encoded_data, 16, 0b1111111111111111, 64);
+}
+
 bool protocol_jablotron_decoder_feed(ProtocolJablotron* protocol, bool level, uint32_t duration) {
     UNUSED(level);
-    bool pushed = false;
+    bool framed = false;
 
     // Bi-Phase Manchester decoding
     if(duration >= JABLOTRON_SHORT_TIME_LOW && duration <= JABLOTRON_SHORT_TIME_HIGH) {
         if(protocol->last_short == false) {
             protocol->last_short = true;
         } else {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, JABLOTRON_ENCODED_BYTE_FULL_SIZE, false);
+            framed = protocol_jablotron_decoder_push_bit(protocol, false);
             protocol->last_short = false;
         }
     } else if(duration >= JABLOTRON_LONG_TIME_LOW && duration <= JABLOTRON_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, JABLOTRON_ENCODED_BYTE_FULL_SIZE, true);
+            framed = protocol_jablotron_decoder_push_bit(protocol, true);
         } else {
             // reset
             protocol->last_short = false;
@@ -109,7 +118,7 @@ bool protocol_jablotron_decoder_feed(ProtocolJablotron* protocol, bool level, ui
         protocol->last_short = false;
     }
 
-    if(pushed && protocol_jablotron_can_be_decoded(protocol)) {
+    if(framed && protocol_jablotron_can_be_decoded(protocol)) {
         protocol_jablotron_decode(protocol);
         return true;
     }
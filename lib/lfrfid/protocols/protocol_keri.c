@@ -3,6 +3,7 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
+#define KERI_PREAMBLE           (0x1C0000001ULL)
 #define KERI_PREAMBLE_BIT_SIZE  (33)
 #define KERI_PREAMBLE_DATA_SIZE (5)
 
@@ -10,6 +11,8 @@
 #define KERI_ENCODED_DATA_SIZE (((KERI_ENCODED_BIT_SIZE) / 8) + KERI_PREAMBLE_DATA_SIZE)
 #define KERI_ENCODED_DATA_LAST ((KERI_ENCODED_BIT_SIZE) / 8)
 
+#define KERI_ENCODED_RING_BITS (KERI_ENCODED_DATA_SIZE * 8)
+
 #define KERI_DECODED_BIT_SIZE  (28)
 #define KERI_DECODED_DATA_SIZE (4)
 
@@ -26,9 +29,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[KERI_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[KERI_ENCODED_DATA_SIZE];
+    uint8_t encoded_ring_data[4][BIT_LIB_RING_SIZE(KERI_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
+    BitLibRing negative_encoded_ring;
+    BitLibRing corrupted_encoded_ring;
+    BitLibRing corrupted_negative_encoded_ring;
 
     uint8_t data[KERI_DECODED_DATA_SIZE];
     ProtocolKeriEncoder encoder;
@@ -49,16 +54,21 @@ uint8_t* protocol_keri_get_data(ProtocolKeri* protocol) {
 
 void protocol_keri_decoder_start(ProtocolKeri* protocol) {
     memset(protocol->encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, KERI_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data[0], KERI_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->negative_encoded_ring, protocol->encoded_ring_data[1], KERI_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_encoded_ring, protocol->encoded_ring_data[2], KERI_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_negative_encoded_ring,
+        protocol->encoded_ring_data[3],
+        KERI_ENCODED_RING_BITS);
 }
 
 static bool protocol_keri_check_preamble(uint8_t* data, size_t bit_index) {
     // Preamble 11100000 00000000 00000000 00000000 1
-    if(*(uint32_t*)&data[bit_index / 8] != 0b00000000000000000000000011100000) return false;
-    if(bit_lib_get_bit(data, bit_index + 32) != 1) return false;
-    return true;
+    return bit_lib_get_bits_64(data, bit_index, KERI_PREAMBLE_BIT_SIZE) == KERI_PREAMBLE;
 }
 
 static bool protocol_keri_can_be_decoded(uint8_t* data) {
@@ -69,7 +79,11 @@ static bool protocol_keri_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_keri_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
+static bool protocol_keri_decoder_feed_internal(
+    bool polarity,
+    uint32_t time,
+    BitLibRing* ring,
+    uint8_t* data) {
     time += (KERI_US_PER_BIT / 2);
 
     size_t bit_count = (time / KERI_US_PER_BIT);
@@ -77,7 +91,11 @@ static bool protocol_keri_decoder_feed_internal(bool polarity, uint32_t time, ui
 
     if(bit_count < KERI_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, KERI_ENCODED_DATA_SIZE, polarity);
+            bit_lib_ring_push(ring, polarity);
+            if(!bit_lib_ring_copy_if(ring, data, KERI_PREAMBLE_BIT_SIZE, KERI_PREAMBLE, 64)) {
+                continue;
+            }
+
             if(protocol_keri_can_be_decoded(data)) {
                 result = true;
                 break;
@@ -124,14 +142,16 @@ bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t dur
     bool result = false;
 
     if(duration > (KERI_US_PER_BIT / 2)) {
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+        if(protocol_keri_decoder_feed_internal(
+               level, duration, &protocol->encoded_ring, protocol->encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
-        if(protocol_keri_decoder_feed_internal(!level, duration, protocol->negative_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->negative_encoded_data);
+        if(protocol_keri_decoder_feed_internal(
+               !level, duration, &protocol->negative_encoded_ring, protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
@@ -147,16 +167,20 @@ bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t dur
             }
         }
 
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->corrupted_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+        if(protocol_keri_decoder_feed_internal(
+               level, duration, &protocol->corrupted_encoded_ring, protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
         }
 
         if(protocol_keri_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
-            protocol_keri_decoder_save(protocol->data, protocol->corrupted_negative_encoded_data);
+               !level,
+               duration,
+               &protocol->corrupted_negative_encoded_ring,
+               protocol->encoded_data)) {
+            protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
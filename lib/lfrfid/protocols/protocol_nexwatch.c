@@ -3,12 +3,15 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
+#define NEXWATCH_PREAMBLE           (0x56ULL)
 #define NEXWATCH_PREAMBLE_BIT_SIZE  (8)
 #define NEXWATCH_PREAMBLE_DATA_SIZE (1)
 
 #define NEXWATCH_ENCODED_BIT_SIZE  (96)
 #define NEXWATCH_ENCODED_DATA_SIZE ((NEXWATCH_ENCODED_BIT_SIZE) / 8)
 
+#define NEXWATCH_ENCODED_RING_BITS (NEXWATCH_ENCODED_DATA_SIZE * 8)
+
 #define NEXWATCH_DECODED_BIT_SIZE  (NEXWATCH_DECODED_DATA_SIZE * 8)
 #define NEXWATCH_DECODED_DATA_SIZE (8)
 
@@ -36,9 +39,11 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[NEXWATCH_ENCODED_DATA_SIZE];
+    uint8_t encoded_ring_data[4][BIT_LIB_RING_SIZE(NEXWATCH_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
+    BitLibRing negative_encoded_ring;
+    BitLibRing corrupted_encoded_ring;
+    BitLibRing corrupted_negative_encoded_ring;
 
     uint8_t data[NEXWATCH_DECODED_DATA_SIZE];
     ProtocolNexwatchEncoder encoder;
@@ -59,15 +64,25 @@ uint8_t* protocol_nexwatch_get_data(ProtocolNexwatch* protocol) {
 
 void protocol_nexwatch_decoder_start(ProtocolNexwatch* protocol) {
     memset(protocol->encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data[0], NEXWATCH_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->negative_encoded_ring,
+        protocol->encoded_ring_data[1],
+        NEXWATCH_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_encoded_ring,
+        protocol->encoded_ring_data[2],
+        NEXWATCH_ENCODED_RING_BITS);
+    bit_lib_ring_init(
+        &protocol->corrupted_negative_encoded_ring,
+        protocol->encoded_ring_data[3],
+        NEXWATCH_ENCODED_RING_BITS);
 }
 
 static bool protocol_nexwatch_check_preamble(uint8_t* data, size_t bit_index) {
     // 01010110
-    if(bit_lib_get_bits(data, bit_index, 8) != 0b01010110) return false;
-    return true;
+    return bit_lib_get_bits_64(data, bit_index, NEXWATCH_PREAMBLE_BIT_SIZE) == NEXWATCH_PREAMBLE;
 }
 
 static uint8_t protocol_nexwatch_parity_swap(uint8_t parity) {
@@ -124,7 +139,11 @@ static bool protocol_nexwatch_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_nexwatch_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
+static bool protocol_nexwatch_decoder_feed_internal(
+    bool polarity,
+    uint32_t time,
+    BitLibRing* ring,
+    uint8_t* data) {
     time += (NEXWATCH_US_PER_BIT / 2);
 
     size_t bit_count = (time / NEXWATCH_US_PER_BIT);
@@ -132,7 +151,12 @@ static bool protocol_nexwatch_decoder_feed_internal(bool polarity, uint32_t time
 
     if(bit_count < NEXWATCH_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, NEXWATCH_ENCODED_DATA_SIZE, polarity);
+            bit_lib_ring_push(ring, polarity);
+            if(!bit_lib_ring_copy_if(
+                   ring, data, NEXWATCH_PREAMBLE_BIT_SIZE, NEXWATCH_PREAMBLE, 0)) {
+                continue;
+            }
+
             if(protocol_nexwatch_can_be_decoded(data)) {
                 result = true;
                 break;
@@ -172,15 +196,16 @@ bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint
     bool result = false;
 
     if(duration > (NEXWATCH_US_PER_BIT / 2)) {
-        if(protocol_nexwatch_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+        if(protocol_nexwatch_decoder_feed_internal(
+               level, duration, &protocol->encoded_ring, protocol->encoded_data)) {
             protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_nexwatch_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level, duration, &protocol->negative_encoded_ring, protocol->encoded_data)) {
+            protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
@@ -197,17 +222,20 @@ bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_nexwatch_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level, duration, &protocol->corrupted_encoded_ring, protocol->encoded_data)) {
+            protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level,
+               duration,
+               &protocol->corrupted_negative_encoded_ring,
+               protocol->encoded_data)) {
             protocol_nexwatch_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+                protocol->data, protocol->encoded_data);
 
             result = true;
             return result;
@@ -11,8 +11,9 @@
 #define PAC_STANLEY_PREAMBLE_BYTE_SIZE (1)
 #define PAC_STANLEY_ENCODED_BYTE_FULL_SIZE \
     (PAC_STANLEY_ENCODED_BYTE_SIZE + PAC_STANLEY_PREAMBLE_BYTE_SIZE)
-#define PAC_STANLEY_BYTE_LENGTH      (10) // start bit, 7 data bits, parity bit, stop bit
-#define PAC_STANLEY_DATA_START_INDEX (8 + (3 * PAC_STANLEY_BYTE_LENGTH) + 1)
+#define PAC_STANLEY_ENCODED_RING_BITS (PAC_STANLEY_ENCODED_BYTE_FULL_SIZE * 8)
+#define PAC_STANLEY_BYTE_LENGTH       (10) // start bit, 7 data bits, parity bit, stop bit
+#define PAC_STANLEY_DATA_START_INDEX  (8 + (3 * PAC_STANLEY_BYTE_LENGTH) + 1)
 
 #define PAC_STANLEY_DECODED_DATA_SIZE (4)
 #define PAC_STANLEY_ENCODED_DATA_SIZE (sizeof(ProtocolPACStanley))
@@ -27,6 +28,8 @@ typedef struct {
     bool got_preamble;
     size_t encoded_index;
     uint8_t encoded_data[PAC_STANLEY_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(PAC_STANLEY_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
     uint8_t data[PAC_STANLEY_DECODED_DATA_SIZE];
 } ProtocolPACStanley;
 
@@ -89,10 +92,24 @@ void protocol_pac_stanley_decoder_start(ProtocolPACStanley* protocol) {
     memset(protocol->data, 0, PAC_STANLEY_DECODED_DATA_SIZE);
     protocol->inverted = false;
     protocol->got_preamble = false;
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, PAC_STANLEY_ENCODED_RING_BITS);
+}
+
+static bool protocol_pac_stanley_decoder_push_bits(
+    ProtocolPACStanley* protocol,
+    bool bit,
+    uint8_t count) {
+    for(uint8_t i = 0; i < count; i++) {
+        bit_lib_ring_push(&protocol->encoded_ring, bit);
+    }
+
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->encoded_data, 8, 0b11111111, 128);
 }
 
 bool protocol_pac_stanley_decoder_feed(ProtocolPACStanley* protocol, bool level, uint32_t duration) {
-    bool pushed = false;
+    bool framed = false;
 
     if(duration > PAC_STANLEY_MAX_TIME) return false;
 
@@ -110,16 +127,11 @@ bool protocol_pac_stanley_decoder_feed(ProtocolPACStanley* protocol, bool level,
     }
 
     if(pulses) {
-        for(uint8_t i = 0; i < pulses; i++) {
-            bit_lib_push_bit(
-                protocol->encoded_data,
-                PAC_STANLEY_ENCODED_BYTE_FULL_SIZE,
-                level ^ protocol->inverted);
-        }
-        pushed = true;
+        framed =
+            protocol_pac_stanley_decoder_push_bits(protocol, level ^ protocol->inverted, pulses);
     }
 
-    if(pushed && protocol_pac_stanley_can_be_decoded(protocol)) {
+    if(framed && protocol_pac_stanley_can_be_decoded(protocol)) {
         protocol_pac_stanley_decode(protocol);
         return true;
     }
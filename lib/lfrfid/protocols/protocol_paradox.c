@@ -15,9 +15,12 @@
 #define PARADOX_ENCODED_BIT_SIZE  (96)
 #define PARADOX_ENCODED_DATA_SIZE (((PARADOX_ENCODED_BIT_SIZE) / 8) + 1)
 #define PARADOX_ENCODED_DATA_LAST (PARADOX_ENCODED_DATA_SIZE - 1)
+#define PARADOX_ENCODED_RING_BITS (PARADOX_ENCODED_DATA_SIZE * 8)
 
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(PARADOX_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolParadoxDecoder;
 
 typedef struct {
@@ -52,6 +55,10 @@ uint8_t* protocol_paradox_get_data(ProtocolParadox* protocol) {
 
 void protocol_paradox_decoder_start(ProtocolParadox* protocol) {
     memset(protocol->encoded_data, 0, PARADOX_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->decoder.encoded_ring,
+        protocol->decoder.encoded_ring_data,
+        PARADOX_ENCODED_RING_BITS);
 }
 
 static bool protocol_paradox_can_be_decoded(ProtocolParadox* protocol) {
@@ -84,6 +91,17 @@ static void protocol_paradox_decode(uint8_t* encoded_data, uint8_t* decoded_data
     bit_lib_push_bit(decoded_data, PARADOX_DECODED_DATA_SIZE, 0);
 }
 
+static bool protocol_paradox_decoder_push_bit(ProtocolParadox* protocol, bool bit) {
+    ProtocolParadoxDecoder* decoder = &protocol->decoder;
+    bit_lib_ring_push(&decoder->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &decoder->encoded_ring,
+        protocol->encoded_data,
+        8,
+        0b00001111,
+        PARADOX_ENCODED_DATA_LAST * 8);
+}
+
 bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
     bool value;
     uint32_t count;
@@ -91,8 +109,8 @@ bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PARADOX_ENCODED_DATA_SIZE, value);
-            if(protocol_paradox_can_be_decoded(protocol)) {
+            if(protocol_paradox_decoder_push_bit(protocol, value) &&
+               protocol_paradox_can_be_decoded(protocol)) {
                 protocol_paradox_decode(protocol->encoded_data, protocol->data);
 
                 return true;
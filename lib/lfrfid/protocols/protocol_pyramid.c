@@ -17,9 +17,12 @@
 #define PYRAMID_ENCODED_BIT_SIZE  ((PYRAMID_PREAMBLE_SIZE + PYRAMID_DATA_SIZE) * 8)
 #define PYRAMID_DECODED_DATA_SIZE (4)
 #define PYRAMID_DECODED_BIT_SIZE  ((PYRAMID_ENCODED_BIT_SIZE - PYRAMID_PREAMBLE_SIZE * 8) / 2)
+#define PYRAMID_ENCODED_RING_BITS (PYRAMID_ENCODED_DATA_SIZE * 8)
 
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(PYRAMID_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 } ProtocolPyramidDecoder;
 
 typedef struct {
@@ -55,6 +58,10 @@ uint8_t* protocol_pyramid_get_data(ProtocolPyramid* protocol) {
 
 void protocol_pyramid_decoder_start(ProtocolPyramid* protocol) {
     memset(protocol->encoded_data, 0, PYRAMID_ENCODED_DATA_SIZE);
+    bit_lib_ring_init(
+        &protocol->decoder.encoded_ring,
+        protocol->decoder.encoded_ring_data,
+        PYRAMID_ENCODED_RING_BITS);
 }
 
 static bool protocol_pyramid_can_be_decoded(uint8_t* data) {
@@ -105,6 +112,13 @@ static void protocol_pyramid_decode(ProtocolPyramid* protocol) {
     bit_lib_copy_bits(protocol->data, 16, 16, protocol->encoded_data, 81 + 8);
 }
 
+static bool protocol_pyramid_decoder_push_bit(ProtocolPyramid* protocol, bool bit) {
+    ProtocolPyramidDecoder* decoder = &protocol->decoder;
+    bit_lib_ring_push(&decoder->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &decoder->encoded_ring, protocol->encoded_data, 24, 0b000000000000000100000001, 0);
+}
+
 bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
     bool value;
     uint32_t count;
@@ -113,8 +127,8 @@ bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PYRAMID_ENCODED_DATA_SIZE, value);
-            if(protocol_pyramid_can_be_decoded(protocol->encoded_data)) {
+            if(protocol_pyramid_decoder_push_bit(protocol, value) &&
+               protocol_pyramid_can_be_decoded(protocol->encoded_data)) {
                 protocol_pyramid_decode(protocol);
                 result = true;
             }
@@ -14,6 +14,7 @@
 
 #define SECURAKEY_RKKT_ENCODED_FULL_SIZE_BITS (96)
 #define SECURAKEY_RKKT_ENCODED_FULL_SIZE_BYTE (12)
+#define SECURAKEY_RKKT_ENCODED_RING_BITS      (SECURAKEY_RKKT_ENCODED_FULL_SIZE_BYTE * 8)
 
 #define SECURAKEY_RKKTH_ENCODED_FULL_SIZE_BITS (64)
 #define SECURAKEY_RKKTH_ENCODED_FULL_SIZE_BYTE (8)
@@ -39,6 +40,8 @@ typedef struct {
     uint8_t data[SECURAKEY_DECODED_DATA_SIZE_BYTES];
     uint8_t RKKT_encoded_data[SECURAKEY_RKKT_ENCODED_FULL_SIZE_BYTE];
     uint8_t RKKTH_encoded_data[SECURAKEY_RKKTH_ENCODED_FULL_SIZE_BYTE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(SECURAKEY_RKKT_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
     uint8_t encoded_data_index;
     bool encoded_polarity;
     ManchesterState decoder_manchester_state;
@@ -149,6 +152,8 @@ void protocol_securakey_decoder_start(ProtocolSecurakey* protocol) {
     // always takes in encoded data as RKKT for simplicity
     // this part is feeding decoder which will delineate the format anyway
     memset(protocol->RKKT_encoded_data, 0, SECURAKEY_RKKT_ENCODED_FULL_SIZE_BYTE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, SECURAKEY_RKKT_ENCODED_RING_BITS);
     manchester_advance(
         protocol->decoder_manchester_state,
         ManchesterEventReset,
@@ -156,6 +161,12 @@ void protocol_securakey_decoder_start(ProtocolSecurakey* protocol) {
         NULL);
 }
 
+static bool protocol_securakey_decoder_push_bit(ProtocolSecurakey* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->RKKT_encoded_data, 10, 0b0111111111, 0);
+}
+
 bool protocol_securakey_decoder_feed(ProtocolSecurakey* protocol, bool level, uint32_t duration) {
     bool result = false;
     // this is where we do manchester demodulation on already ASK-demoded data
@@ -179,9 +190,8 @@ bool protocol_securakey_decoder_feed(ProtocolSecurakey* protocol, bool level, ui
         bool data_ok = manchester_advance(
             protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
         if(data_ok) {
-            bit_lib_push_bit(
-                protocol->RKKT_encoded_data, SECURAKEY_RKKT_ENCODED_FULL_SIZE_BYTE, data);
-            if(protocol_securakey_can_be_decoded(protocol)) {
+            if(protocol_securakey_decoder_push_bit(protocol, data) &&
+               protocol_securakey_can_be_decoded(protocol)) {
                 protocol_securakey_decode(protocol);
                 result = true;
             }
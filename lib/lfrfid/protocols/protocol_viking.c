@@ -12,6 +12,7 @@
 #define VIKING_PREAMBLE_BYTE_SIZE     (3)
 #define VIKING_ENCODED_BYTE_FULL_SIZE (VIKING_ENCODED_BYTE_SIZE + VIKING_PREAMBLE_BYTE_SIZE)
 #define VIKING_DECODED_DATA_SIZE      4
+#define VIKING_ENCODED_RING_BITS      (VIKING_ENCODED_BYTE_FULL_SIZE * 8)
 
 #define VIKING_READ_SHORT_TIME  (128)
 #define VIKING_READ_LONG_TIME   (256)
@@ -25,6 +26,8 @@
 typedef struct {
     uint8_t data[VIKING_DECODED_DATA_SIZE];
     uint8_t encoded_data[VIKING_ENCODED_BYTE_FULL_SIZE];
+    uint8_t encoded_ring_data[BIT_LIB_RING_SIZE(VIKING_ENCODED_RING_BITS)];
+    BitLibRing encoded_ring;
 
     uint8_t encoded_data_index;
     bool encoded_polarity;
@@ -75,6 +78,8 @@ static bool protocol_viking_can_be_decoded(ProtocolViking* protocol) {
 
 void protocol_viking_decoder_start(ProtocolViking* protocol) {
     memset(protocol->encoded_data, 0, VIKING_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_ring_init(
+        &protocol->encoded_ring, protocol->encoded_ring_data, VIKING_ENCODED_RING_BITS);
     manchester_advance(
         protocol->decoder_manchester_state,
         ManchesterEventReset,
@@ -82,6 +87,12 @@ void protocol_viking_decoder_start(ProtocolViking* protocol) {
         NULL);
 }
 
+static bool protocol_viking_decoder_push_bit(ProtocolViking* protocol, bool bit) {
+    bit_lib_ring_push(&protocol->encoded_ring, bit);
+    return bit_lib_ring_copy_if(
+        &protocol->encoded_ring, protocol->encoded_data, 16, 0b1111001000000000, 64);
+}
+
 bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t duration) {
     bool result = false;
 
@@ -107,9 +118,8 @@ bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t
             protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
 
         if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_viking_can_be_decoded(protocol)) {
+            if(protocol_viking_decoder_push_bit(protocol, data) &&
+               protocol_viking_can_be_decoded(protocol)) {
                 protocol_viking_decode(protocol);
                 result = true;
             }
@@ -71,6 +71,7 @@ mjs_val_t mjs_array_get2(struct mjs* mjs, mjs_val_t arr, unsigned long index, in
 
 unsigned long mjs_array_length(struct mjs* mjs, mjs_val_t v) {
     struct mjs_property* p;
+    struct mjs_object* o;
     unsigned long len = 0;
 
     if(!mjs_is_object(v)) {
@@ -78,7 +79,14 @@ unsigned long mjs_array_length(struct mjs* mjs, mjs_val_t v) {
         goto clean;
     }
 
-    for(p = get_object_struct(v)->properties; p != NULL; p = p->next) {
+    /* Arrays keep their length up to date, unless an element was deleted */
+    o = get_object_struct(v);
+    if(mjs_is_array(v) && o->array_length != MJS_ARRAY_LENGTH_UNKNOWN) {
+        len = o->array_length;
+        goto clean;
+    }
+
+    for(p = o->properties; p != NULL; p = p->next) {
         int ok = 0;
         unsigned long n = 0;
         str_to_ulong(mjs, p->name, &ok, &n);
@@ -87,6 +95,10 @@ unsigned long mjs_array_length(struct mjs* mjs, mjs_val_t v) {
         }
     }
 
+    if(mjs_is_array(v)) {
+        o->array_length = len;
+    }
+
 clean:
     return len;
 }
@@ -119,34 +119,89 @@ static void set_value(char* buf, int64_t value, mjs_dataview_type_t type) {
     }
 }
 
+/*
+ * View properties: element type, the ArrayBuffer, and for views made by
+ * `subarray()` the byte offset and length within it.
+ */
+#define DATAVIEW_PROP_TYPE   "_t"
+#define DATAVIEW_PROP_BUF    "_b"
+#define DATAVIEW_PROP_OFFSET "_o"
+#define DATAVIEW_PROP_LEN    "_n"
+
+/*
+ * The names as inline string values, like `mjs_mk_string()` makes them, so
+ * that properties are compared without making the names on every access
+ */
+#define DATAVIEW_PROP_NAME(name) \
+    (MJS_TAG_STRING_I | ((mjs_val_t)(uint8_t)(name)[1] << 16) | \
+     ((mjs_val_t)(uint8_t)(name)[0] << 8) | 2)
+
+struct mjs_dataview_info {
+    mjs_dataview_type_t type;
+    mjs_val_t buf;
+    size_t offset; /* In bytes, within the buffer */
+    size_t byte_len;
+    char* data; /* First byte of the view */
+};
+
+/* Reads all view properties in one pass, element access does it on every index */
+static void
+    mjs_dataview_get_info(struct mjs* mjs, mjs_val_t obj, struct mjs_dataview_info* info) {
+    size_t byte_len = (size_t)-1;
+    size_t buf_len = 0;
+
+    info->type = MJS_DATAVIEW_U8;
+    info->buf = MJS_UNDEFINED;
+    info->offset = 0;
+
+    for(struct mjs_property* p = get_object_struct(obj)->properties; p != NULL; p = p->next) {
+        if(p->name == DATAVIEW_PROP_NAME(DATAVIEW_PROP_TYPE)) {
+            info->type = mjs_get_int(mjs, p->value);
+        } else if(p->name == DATAVIEW_PROP_NAME(DATAVIEW_PROP_BUF)) {
+            info->buf = p->value;
+        } else if(p->name == DATAVIEW_PROP_NAME(DATAVIEW_PROP_OFFSET)) {
+            info->offset = mjs_get_int(mjs, p->value);
+        } else if(p->name == DATAVIEW_PROP_NAME(DATAVIEW_PROP_LEN)) {
+            byte_len = mjs_get_int(mjs, p->value);
+        }
+    }
+
+    info->data = mjs_array_buf_get_ptr(mjs, info->buf, &buf_len);
+    if(info->data == NULL || info->offset > buf_len) {
+        info->data = NULL;
+        info->offset = 0;
+        info->byte_len = 0;
+        return;
+    }
+    info->data += info->offset;
+    info->byte_len = buf_len - info->offset;
+    if(byte_len < info->byte_len) {
+        info->byte_len = byte_len;
+    }
+}
+
 static mjs_val_t mjs_dataview_get(struct mjs* mjs, mjs_val_t obj, size_t index) {
-    mjs_val_t buf_obj = mjs_get(mjs, obj, "buffer", -1);
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
 
-    size_t byte_len = 0;
-    char* buf = mjs_array_buf_get_ptr(mjs, buf_obj, &byte_len);
-    mjs_dataview_type_t type = mjs_get_int(mjs, mjs_get(mjs, obj, "_t", -1));
-    if((mjs_dataview_get_element_len(type) * (index + 1)) > byte_len) {
+    size_t element_len = mjs_dataview_get_element_len(info.type);
+    if(index >= info.byte_len / element_len) {
         return MJS_UNDEFINED;
     }
 
-    buf += mjs_dataview_get_element_len(type) * index;
-    int64_t value = get_value(buf, type);
-
-    return mjs_mk_number(mjs, value);
+    return mjs_mk_number(mjs, get_value(info.data + element_len * index, info.type));
 }
 
 static mjs_err_t mjs_dataview_set(struct mjs* mjs, mjs_val_t obj, size_t index, int64_t value) {
-    mjs_val_t buf_obj = mjs_get(mjs, obj, "buffer", -1);
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
 
-    size_t byte_len = 0;
-    char* buf = mjs_array_buf_get_ptr(mjs, buf_obj, &byte_len);
-    mjs_dataview_type_t type = mjs_get_int(mjs, mjs_get(mjs, obj, "_t", -1));
-    if((mjs_dataview_get_element_len(type) * (index + 1)) > byte_len) {
+    size_t element_len = mjs_dataview_get_element_len(info.type);
+    if(index >= info.byte_len / element_len) {
         return MJS_TYPE_ERROR;
     }
 
-    buf += mjs_dataview_get_element_len(type) * index;
-    set_value(buf, value, type);
+    set_value(info.data + element_len * index, value, info.type);
 
     return MJS_OK;
 }
@@ -175,16 +230,50 @@ mjs_err_t mjs_dataview_set_prop(struct mjs* mjs, mjs_val_t obj, mjs_val_t key, m
 }
 
 mjs_val_t mjs_dataview_get_buf(struct mjs* mjs, mjs_val_t obj) {
-    return mjs_get(mjs, obj, "buffer", -1);
+    return mjs_get(mjs, obj, DATAVIEW_PROP_BUF, ~0);
+}
+
+mjs_dataview_type_t mjs_dataview_get_type(struct mjs* mjs, mjs_val_t obj) {
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
+
+    return info.type;
 }
 
 mjs_val_t mjs_dataview_get_len(struct mjs* mjs, mjs_val_t obj) {
-    size_t bytelen = 0;
-    mjs_array_buf_get_ptr(mjs, mjs_dataview_get_buf(mjs, obj), &bytelen);
-    mjs_dataview_type_t type = mjs_get_int(mjs, mjs_get(mjs, obj, "_t", -1));
-    size_t element_len = mjs_dataview_get_element_len(type);
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
+
+    return mjs_mk_number(mjs, info.byte_len / mjs_dataview_get_element_len(info.type));
+}
 
-    return mjs_mk_number(mjs, bytelen / element_len);
+mjs_val_t mjs_dataview_get_byte_len(struct mjs* mjs, mjs_val_t obj) {
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
+
+    return mjs_mk_number(mjs, info.byte_len);
+}
+
+mjs_val_t mjs_dataview_get_byte_offset(struct mjs* mjs, mjs_val_t obj) {
+    struct mjs_dataview_info info;
+    mjs_dataview_get_info(mjs, obj, &info);
+
+    return mjs_mk_number(mjs, info.offset);
+}
+
+char* mjs_typed_array_get_ptr(struct mjs* mjs, mjs_val_t v, size_t* bytelen) {
+    if(mjs_is_data_view(v)) {
+        struct mjs_dataview_info info;
+        mjs_dataview_get_info(mjs, v, &info);
+        if(bytelen) {
+            *bytelen = info.byte_len;
+        }
+        return info.data;
+    } else if(mjs_is_array_buf(v)) {
+        return mjs_array_buf_get_ptr(mjs, v, bytelen);
+    }
+
+    return NULL;
 }
 
 mjs_val_t mjs_mk_array_buf(struct mjs* mjs, char* data, size_t buf_len) {
@@ -219,6 +308,25 @@ mjs_val_t mjs_mk_array_buf(struct mjs* mjs, char* data, size_t buf_len) {
     return (offset & ~MJS_TAG_MASK) | MJS_TAG_ARRAY_BUF;
 }
 
+int mjs_array_buf_truncate(struct mjs* mjs, mjs_val_t buf, size_t buf_len) {
+    struct mbuf* m = &mjs->array_buffers;
+    size_t offset = buf & ~MJS_TAG_MASK;
+    size_t len = 0;
+    char* ptr = mjs_array_buf_get_ptr(mjs, buf, &len);
+
+    /* Only the last buffer can give its tail back */
+    if(ptr == NULL || ptr + len != m->buf + m->len || buf_len > len) {
+        return 0;
+    }
+
+    size_t header_len = cs_varint_llen(buf_len);
+    memmove(m->buf + offset + header_len, ptr, buf_len);
+    cs_varint_encode(buf_len, (unsigned char*)m->buf + offset, header_len);
+    m->len = offset + header_len + buf_len;
+
+    return 1;
+}
+
 void mjs_array_buf_slice(struct mjs* mjs) {
     size_t nargs = mjs_nargs(mjs);
     mjs_val_t src = mjs_get_this(mjs);
@@ -272,6 +380,29 @@ void mjs_array_buf_slice(struct mjs* mjs) {
     mjs_return(mjs, mjs_mk_array_buf(mjs, src_buf, end - start));
 }
 
+static mjs_val_t mjs_mk_dataview_range(
+    struct mjs* mjs,
+    mjs_val_t buf,
+    mjs_dataview_type_t type,
+    size_t offset,
+    size_t byte_len) {
+    size_t buf_len = 0;
+    mjs_array_buf_get_ptr(mjs, buf, &buf_len);
+
+    mjs_val_t view_obj = mjs_mk_object(mjs);
+    mjs_set(mjs, view_obj, DATAVIEW_PROP_TYPE, ~0, mjs_mk_number(mjs, (double)type));
+    mjs_set(mjs, view_obj, DATAVIEW_PROP_BUF, ~0, buf);
+    if(offset != 0 || byte_len != buf_len) {
+        mjs_set(mjs, view_obj, DATAVIEW_PROP_OFFSET, ~0, mjs_mk_number(mjs, offset));
+        mjs_set(mjs, view_obj, DATAVIEW_PROP_LEN, ~0, mjs_mk_number(mjs, byte_len));
+    }
+
+    view_obj &= ~MJS_TAG_MASK;
+    view_obj |= MJS_TAG_ARRAY_BUF_VIEW;
+
+    return view_obj;
+}
+
 static mjs_val_t
     mjs_mk_dataview_from_buf(struct mjs* mjs, mjs_val_t buf, mjs_dataview_type_t type) {
     size_t len = 0;
@@ -281,16 +412,7 @@ static mjs_val_t
             mjs, MJS_BAD_ARGS_ERROR, "Buffer len is not a multiple of element size");
         return MJS_UNDEFINED;
     }
-    mjs_val_t view_obj = mjs_mk_object(mjs);
-    mjs_set(mjs, view_obj, "_t", ~0, mjs_mk_number(mjs, (double)type));
-    mjs_set(mjs, view_obj, "buffer", ~0, buf);
-
-    view_obj &= ~MJS_TAG_MASK;
-    view_obj |= MJS_TAG_ARRAY_BUF_VIEW;
-
-    mjs_dataview_get(mjs, view_obj, 0);
-
-    return view_obj;
+    return mjs_mk_dataview_range(mjs, buf, type, 0, len);
 }
 
 static mjs_val_t
@@ -310,7 +432,7 @@ static mjs_val_t
 
     if(mjs_is_array(arr)) {
         char* buf_ptr = mjs_array_buf_get_ptr(mjs, buf_obj, NULL);
-        for(uint8_t i = 0; i < elements_nb; i++) {
+        for(size_t i = 0; i < elements_nb; i++) {
             int64_t value = mjs_get_double(mjs, mjs_array_get(mjs, arr, i));
             set_value(buf_ptr, value, type);
             buf_ptr += element_len;
@@ -320,6 +442,148 @@ static mjs_val_t
     return mjs_mk_dataview_from_buf(mjs, buf_obj, type);
 }
 
+/* Gets an optional index argument, normalized like `slice()` does */
+static bool mjs_dataview_get_idx_arg(struct mjs* mjs, int arg, size_t len, size_t* idx) {
+    mjs_val_t idx_v = mjs_arg(mjs, arg);
+    if(mjs_is_undefined(idx_v)) {
+        return true;
+    }
+    if(!mjs_is_number(idx_v)) {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "index must be a number");
+        return false;
+    }
+    *idx = mjs_normalize_idx(mjs_get_int(mjs, idx_v), len);
+    return true;
+}
+
+void mjs_dataview_set_items(struct mjs* mjs) {
+    mjs_val_t this_obj = mjs_get_this(mjs);
+    mjs_val_t src = mjs_arg(mjs, 0);
+    mjs_val_t offset_v = mjs_arg(mjs, 1);
+    struct mjs_dataview_info dst;
+    size_t offset = 0;
+    size_t count = 0;
+
+    mjs_dataview_get_info(mjs, this_obj, &dst);
+    size_t element_len = mjs_dataview_get_element_len(dst.type);
+    size_t len = dst.byte_len / element_len;
+
+    if(mjs_is_number(offset_v)) {
+        int offset_arg = mjs_get_int(mjs, offset_v);
+        offset = offset_arg < 0 ? len + 1 : (size_t)offset_arg;
+    } else if(!mjs_is_undefined(offset_v)) {
+        offset = len + 1;
+    }
+
+    if(mjs_is_array(src)) {
+        count = mjs_array_length(mjs, src);
+    } else if(mjs_is_data_view(src)) {
+        struct mjs_dataview_info info;
+        mjs_dataview_get_info(mjs, src, &info);
+        count = info.byte_len / mjs_dataview_get_element_len(info.type);
+    } else if(mjs_is_array_buf(src)) {
+        mjs_array_buf_get_ptr(mjs, src, &count);
+    } else {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "source must be an array or typed array");
+        goto clean;
+    }
+
+    if(offset > len || count > len - offset) {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "offset is out of bounds");
+        goto clean;
+    }
+
+    char* dst_ptr = dst.data + offset * element_len;
+    if(mjs_is_array(src)) {
+        for(size_t i = 0; i < count; i++) {
+            mjs_val_t item = mjs_array_get(mjs, src, i);
+            int64_t value = mjs_is_number(item) ? mjs_get_double(mjs, item) : 0;
+            set_value(dst_ptr + i * element_len, value, dst.type);
+        }
+    } else {
+        struct mjs_dataview_info info = {.type = MJS_DATAVIEW_U8};
+        if(mjs_is_data_view(src)) {
+            mjs_dataview_get_info(mjs, src, &info);
+        } else {
+            info.data = mjs_array_buf_get_ptr(mjs, src, &info.byte_len);
+        }
+
+        if(info.type == dst.type) {
+            memmove(dst_ptr, info.data, count * element_len);
+        } else {
+            /* Converting in place could overwrite source items before they are read */
+            size_t src_element_len = mjs_dataview_get_element_len(info.type);
+            char* src_ptr = malloc(count * src_element_len);
+            memcpy(src_ptr, info.data, count * src_element_len);
+            for(size_t i = 0; i < count; i++) {
+                int64_t value = get_value(src_ptr + i * src_element_len, info.type);
+                set_value(dst_ptr + i * element_len, value, dst.type);
+            }
+            free(src_ptr);
+        }
+    }
+
+clean:
+    mjs_return(mjs, MJS_UNDEFINED);
+}
+
+void mjs_dataview_subarray(struct mjs* mjs) {
+    mjs_val_t this_obj = mjs_get_this(mjs);
+    mjs_val_t ret = MJS_UNDEFINED;
+    struct mjs_dataview_info info;
+
+    mjs_dataview_get_info(mjs, this_obj, &info);
+    size_t element_len = mjs_dataview_get_element_len(info.type);
+    size_t len = info.byte_len / element_len;
+    size_t begin = 0;
+    size_t end = len;
+
+    if(mjs_dataview_get_idx_arg(mjs, 0, len, &begin) &&
+       mjs_dataview_get_idx_arg(mjs, 1, len, &end)) {
+        if(end < begin) {
+            end = begin;
+        }
+        ret = mjs_mk_dataview_range(
+            mjs,
+            info.buf,
+            info.type,
+            info.offset + begin * element_len,
+            (end - begin) * element_len);
+    }
+
+    mjs_return(mjs, ret);
+}
+
+void mjs_dataview_copy_within(struct mjs* mjs) {
+    mjs_val_t this_obj = mjs_get_this(mjs);
+    struct mjs_dataview_info info;
+
+    mjs_dataview_get_info(mjs, this_obj, &info);
+    size_t element_len = mjs_dataview_get_element_len(info.type);
+    size_t len = info.byte_len / element_len;
+    size_t target = 0;
+    size_t start = 0;
+    size_t end = len;
+
+    if(!mjs_is_number(mjs_arg(mjs, 0)) || !mjs_is_number(mjs_arg(mjs, 1))) {
+        mjs_prepend_errorf(mjs, MJS_BAD_ARGS_ERROR, "target and start must be numbers");
+    } else if(
+        mjs_dataview_get_idx_arg(mjs, 0, len, &target) &&
+        mjs_dataview_get_idx_arg(mjs, 1, len, &start) &&
+        mjs_dataview_get_idx_arg(mjs, 2, len, &end) && start < end) {
+        size_t count = end - start;
+        if(count > len - target) {
+            count = len - target;
+        }
+        memmove(
+            info.data + target * element_len,
+            info.data + start * element_len,
+            count * element_len);
+    }
+
+    mjs_return(mjs, this_obj);
+}
+
 static void mjs_array_buf_new(struct mjs* mjs) {
     mjs_val_t len_arg = mjs_arg(mjs, 0);
     mjs_val_t buf_obj = MJS_UNDEFINED;
@@ -20,8 +20,21 @@ void mjs_init_builtin_array_buf(struct mjs* mjs, mjs_val_t obj);
 
 mjs_val_t mjs_dataview_get_len(struct mjs* mjs, mjs_val_t obj);
 
+mjs_val_t mjs_dataview_get_byte_len(struct mjs* mjs, mjs_val_t obj);
+
+mjs_val_t mjs_dataview_get_byte_offset(struct mjs* mjs, mjs_val_t obj);
+
 void mjs_array_buf_slice(struct mjs* mjs);
 
+/* `set(source, offset)`: copies an array or a typed array into the view */
+void mjs_dataview_set_items(struct mjs* mjs);
+
+/* `subarray(begin, end)`: a view of the same buffer, without copying */
+void mjs_dataview_subarray(struct mjs* mjs);
+
+/* `copyWithin(target, start, end)`: moves items within the view */
+void mjs_dataview_copy_within(struct mjs* mjs);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
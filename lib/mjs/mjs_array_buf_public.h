@@ -30,8 +30,26 @@ mjs_val_t mjs_mk_array_buf(struct mjs* mjs, char* data, size_t buf_len);
 
 char* mjs_array_buf_get_ptr(struct mjs* mjs, mjs_val_t buf, size_t* bytelen);
 
+/*
+ * Shrinks the most recently made ArrayBuffer, e.g. when less data than
+ * expected was read into it. Returns 0 for other buffers, which keep their
+ * length.
+ */
+int mjs_array_buf_truncate(struct mjs* mjs, mjs_val_t buf, size_t buf_len);
+
 mjs_val_t mjs_dataview_get_buf(struct mjs* mjs, mjs_val_t obj);
 
+mjs_dataview_type_t mjs_dataview_get_type(struct mjs* mjs, mjs_val_t obj);
+
+/*
+ * Returns the data of an ArrayBuffer, or the part of its buffer a typed array
+ * views, and its length in bytes. NULL for other values.
+ *
+ * The data can be read and written in place, but is only valid until the
+ * next ArrayBuffer is made.
+ */
+char* mjs_typed_array_get_ptr(struct mjs* mjs, mjs_val_t v, size_t* bytelen);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -127,17 +127,26 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs) {
 }
 
 MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
-    struct mjs_bcode_part bp;
-    memset(&bp, 0, sizeof(bp));
+    const char* data;
+    size_t len;
 
     /* Make sure the bcode doesn't occupy any extra space */
     mbuf_trim(&mjs->bcode_gen);
 
     /* Transfer the ownership of the bcode data */
-    bp.data.p = mjs->bcode_gen.buf;
-    bp.data.len = mjs->bcode_gen.len;
+    data = mjs->bcode_gen.buf;
+    len = mjs->bcode_gen.len;
     mbuf_init(&mjs->bcode_gen, 0);
 
+    mjs_bcode_append(mjs, data, len);
+}
+
+MJS_PRIVATE void mjs_bcode_append(struct mjs* mjs, const char* data, size_t len) {
+    struct mjs_bcode_part bp;
+    memset(&bp, 0, sizeof(bp));
+
+    bp.data.p = data;
+    bp.data.len = len;
     bp.start_idx = mjs->bcode_len;
     bp.exec_res = MJS_ERRS_CNT;
 
@@ -145,3 +154,19 @@ MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
 
     mjs->bcode_len += bp.data.len;
 }
+
+MJS_PRIVATE int mjs_bcode_is_valid(const char* data, size_t len) {
+    mjs_header_item_t hdr[MJS_HDR_ITEMS_CNT];
+
+    if(len < 1 + sizeof(hdr) || (uint8_t)data[0] != OP_BCODE_HEADER) {
+        return 0;
+    }
+    memcpy(hdr, data + 1, sizeof(hdr));
+
+    /* Offsets are relative to the header, which follows the opcode byte */
+    return hdr[MJS_HDR_ITEM_TOTAL_SIZE] == len - 1 &&
+           hdr[MJS_HDR_ITEM_BCODE_OFFSET] > sizeof(hdr) &&
+           hdr[MJS_HDR_ITEM_BCODE_OFFSET] < hdr[MJS_HDR_ITEM_MAP_OFFSET] &&
+           hdr[MJS_HDR_ITEM_MAP_OFFSET] < hdr[MJS_HDR_ITEM_TOTAL_SIZE] &&
+           data[hdr[MJS_HDR_ITEM_BCODE_OFFSET]] == '\0';
+}
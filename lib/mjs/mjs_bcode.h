@@ -54,6 +54,8 @@ enum mjs_opcode {
     OP_BCODE_HEADER, /* ( -- ) */
     OP_ARGS, /* ( -- ) Mark the beginning of function call arguments */
     OP_FOR_IN_NEXT, /* ( name obj iter_ptr -- name obj iter_ptr_next ) */
+    OP_GET_VAR, /* ( -- a ) Fused OP_PUSH_STR, OP_FIND_SCOPE, OP_GET */
+    OP_GET_MEMBER, /* ( obj -- obj[key] ) Fused OP_PUSH_STR, OP_SWAP, OP_GET */
     OP_MAX
 };
 
@@ -98,6 +100,17 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs);
  */
 MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs);
 
+/*
+ * Adds complete bcode (as produced by `mjs_parse()`) as a next bcode part,
+ * takes ownership of `data`
+ */
+MJS_PRIVATE void mjs_bcode_append(struct mjs* mjs, const char* data, size_t len);
+
+/*
+ * Checks that the bcode of a single part is consistent with its header
+ */
+MJS_PRIVATE int mjs_bcode_is_valid(const char* data, size_t len);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
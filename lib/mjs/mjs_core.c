@@ -26,6 +26,9 @@
 #ifndef MJS_FUNC_FFI_ARENA_SIZE
 #define MJS_FUNC_FFI_ARENA_SIZE 20
 #endif
+#ifndef MJS_STRING_ARENA_SIZE
+#define MJS_STRING_ARENA_SIZE 10
+#endif
 
 #ifndef MJS_OBJECT_ARENA_INC_SIZE
 #define MJS_OBJECT_ARENA_INC_SIZE 10
@@ -36,6 +39,18 @@
 #ifndef MJS_FUNC_FFI_ARENA_INC_SIZE
 #define MJS_FUNC_FFI_ARENA_INC_SIZE 10
 #endif
+#ifndef MJS_STRING_ARENA_INC_SIZE
+#define MJS_STRING_ARENA_INC_SIZE 10
+#endif
+
+/*
+ * Every append to a builder string makes a new cell, while few of them stay
+ * alive. So the string arena keeps a fixed reserve instead of one relative to
+ * the live cells, not to collect after every few appends.
+ */
+#ifndef MJS_STRING_ARENA_RESERVE
+#define MJS_STRING_ARENA_RESERVE 120
+#endif
 
 void mjs_destroy(struct mjs* mjs) {
     {
@@ -67,6 +82,7 @@ void mjs_destroy(struct mjs* mjs) {
     gc_arena_destroy(mjs, &mjs->object_arena);
     gc_arena_destroy(mjs, &mjs->property_arena);
     gc_arena_destroy(mjs, &mjs->ffi_sig_arena);
+    gc_arena_destroy(mjs, &mjs->string_arena);
     free(mjs);
 }
 
@@ -113,7 +129,18 @@ struct mjs* mjs_create(void* context) {
         sizeof(struct mjs_ffi_sig),
         MJS_FUNC_FFI_ARENA_SIZE,
         MJS_FUNC_FFI_ARENA_INC_SIZE);
+    gc_arena_init(
+        &mjs->string_arena,
+        sizeof(struct mjs_string_cell),
+        MJS_STRING_ARENA_SIZE,
+        MJS_STRING_ARENA_INC_SIZE);
+    mjs->object_arena.destructor = mjs_object_destructor;
     mjs->ffi_sig_arena.destructor = mjs_ffi_sig_destructor;
+    mjs->string_arena.destructor = mjs_string_cell_destructor;
+    mjs->string_arena.reserve_min = MJS_STRING_ARENA_RESERVE;
+    for(size_t i = 0; i < MJS_STRING_INTERN_SIZE; i++) {
+        mjs->interned_strings[i] = MJS_UNDEFINED;
+    }
 
     global_object = mjs_mk_object(mjs);
     mjs_init_builtin(mjs, global_object);
@@ -256,6 +283,7 @@ MJS_PRIVATE enum mjs_type mjs_get_type(mjs_val_t v) {
     case MJS_TAG_STRING_F >> 48:
     case MJS_TAG_STRING_D >> 48:
     case MJS_TAG_STRING_5 >> 48:
+    case MJS_TAG_STRING_B >> 48:
         return MJS_TYPE_STRING;
     case MJS_TAG_BOOLEAN >> 48:
         return MJS_TYPE_BOOLEAN;
@@ -420,3 +448,13 @@ MJS_PRIVATE void mjs_push(struct mjs* mjs, mjs_val_t v) {
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc) {
     mjs->generate_jsc = generate_jsc;
 }
+
+void mjs_set_bcode_cache(
+    struct mjs* mjs,
+    mjs_bcode_load_t* load,
+    mjs_bcode_save_t* save,
+    void* context) {
+    mjs->bcode_load = load;
+    mjs->bcode_save = save;
+    mjs->bcode_cache_context = context;
+}
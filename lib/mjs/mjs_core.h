@@ -60,6 +60,26 @@ struct mjs_bcode_part {
     unsigned in_rom : 1;
 };
 
+/* Number of per-site property lookup caches, a power of 2 */
+#ifndef MJS_INLINE_CACHE_SIZE
+#define MJS_INLINE_CACHE_SIZE 32
+#endif
+
+/* Number of slots in the string intern table, a power of 2 */
+#ifndef MJS_STRING_INTERN_SIZE
+#define MJS_STRING_INTERN_SIZE 32
+#endif
+
+/*
+ * Inline cache entry: property found by the access at the given bcode
+ * offset last time. Dropped on GC and on property deletion.
+ */
+struct mjs_inline_cache {
+    size_t site; /* Global bcode offset of the access */
+    mjs_val_t obj; /* Object (or scope) the property is own for */
+    struct mjs_property* prop;
+};
+
 struct mjs {
     struct mbuf bcode_gen;
     struct mbuf bcode_parts;
@@ -83,11 +103,19 @@ struct mjs {
     ffi_cb_args_t* ffi_cb_args; /* List of FFI args descriptors */
     size_t cur_bcode_offset;
     mjs_flags_poller_t exec_flags_poller;
+    mjs_bcode_load_t* bcode_load;
+    mjs_bcode_save_t* bcode_save;
+    void* bcode_cache_context;
     void* context;
 
     struct gc_arena object_arena;
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
+    struct gc_arena string_arena;
+    struct mjs_gc_stats gc_stats;
+    struct mjs_inline_cache inline_cache[MJS_INLINE_CACHE_SIZE];
+    mjs_val_t interned_strings[MJS_STRING_INTERN_SIZE];
+    size_t string_buf_allocated; /* Builder buffer bytes since the last GC */
 
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
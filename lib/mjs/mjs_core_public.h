@@ -82,6 +82,7 @@ typedef uint64_t mjs_val_t;
 
 #define MJS_TAG_ARRAY_BUF MAKE_TAG(0, 1) /* ArrayBuffer */
 #define MJS_TAG_ARRAY_BUF_VIEW MAKE_TAG(0, 2) /* DataView */
+#define MJS_TAG_STRING_B MAKE_TAG(0, 3) /* Builder string */
 
 #define MJS_TAG_MASK MAKE_TAG(1, 15)
 
@@ -262,6 +263,34 @@ const char* mjs_get_stack_trace(struct mjs* mjs);
  */
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc);
 
+/*
+ * Bytecode format version. Changes whenever opcodes or bytecode layout
+ * change, bytecode cached with a different version must not be executed.
+ */
+#define MJS_BCODE_VERSION 2
+
+/*
+ * Bytecode cache callbacks, see `mjs_set_bcode_cache()`.
+ *
+ * `load` returns bytecode of the script at `path`, allocated with `malloc()`,
+ * or NULL if there is no valid cached bytecode. The ownership is transferred
+ * to mJS.
+ *
+ * `save` is called with bytecode of a script right after it was parsed.
+ */
+typedef char*(mjs_bcode_load_t)(void* context, const char* path, size_t* size);
+typedef void(mjs_bcode_save_t)(void* context, const char* path, const char* bcode, size_t size);
+
+/*
+ * Sets bytecode cache used by `mjs_exec_file()`: scripts found in the cache
+ * are executed without parsing, parsed ones are passed to the cache.
+ */
+void mjs_set_bcode_cache(
+    struct mjs* mjs,
+    mjs_bcode_load_t* load,
+    mjs_bcode_save_t* save,
+    void* context);
+
 /*
  * When invoked from a cfunction, returns number of arguments passed to the
  * current JS function call.
@@ -195,14 +195,72 @@ static mjs_val_t do_op(struct mjs* mjs, mjs_val_t a, mjs_val_t b, int op) {
     return ret;
 }
 
-static void op_assign(struct mjs* mjs, int op) {
+MJS_PRIVATE void mjs_inline_cache_reset(struct mjs* mjs) {
+    memset(mjs->inline_cache, 0, sizeof(mjs->inline_cache));
+}
+
+static struct mjs_inline_cache* inline_cache_get(struct mjs* mjs, size_t site) {
+    return &mjs->inline_cache[site & (MJS_INLINE_CACHE_SIZE - 1)];
+}
+
+static void
+    inline_cache_set(struct mjs* mjs, size_t site, mjs_val_t obj, struct mjs_property* prop) {
+    struct mjs_inline_cache* ic = inline_cache_get(mjs, site);
+    ic->site = site;
+    ic->obj = obj;
+    ic->prop = prop;
+}
+
+/*
+ * Own property `obj[key]` for the assignment at the given site, NULL if there
+ * is none yet. Key is checked on hit, since it is computed at runtime.
+ */
+static struct mjs_property*
+    exec_own_property(struct mjs* mjs, size_t site, mjs_val_t obj, mjs_val_t key) {
+    struct mjs_inline_cache* ic = inline_cache_get(mjs, site);
+    struct mjs_property* p;
+
+    if(ic->site == site && ic->obj == obj &&
+       (ic->prop->name == key || s_cmp(mjs, ic->prop->name, key) == 0)) {
+        return ic->prop;
+    }
+
+    p = mjs_get_own_property_v(mjs, obj, key);
+    if(p != NULL) {
+        inline_cache_set(mjs, site, obj, p);
+    }
+    return p;
+}
+
+/*
+ * Read-modify-write of `obj[key]` for the compound assignments, pushes either
+ * the old or the new value
+ */
+static void exec_update(
+    struct mjs* mjs,
+    size_t site,
+    mjs_val_t obj,
+    mjs_val_t key,
+    mjs_val_t operand,
+    int op,
+    bool push_old) {
+    struct mjs_property* p = exec_own_property(mjs, site, obj, key);
+    mjs_val_t v = p != NULL ? p->value : MJS_UNDEFINED;
+    mjs_val_t v1 = do_op(mjs, v, operand, op);
+    if(p != NULL) {
+        p->value = v1;
+    } else {
+        mjs_set_v(mjs, obj, key, v1);
+    }
+    mjs_push(mjs, push_old ? v : v1);
+}
+
+static void op_assign(struct mjs* mjs, int op, size_t site) {
     mjs_val_t val = mjs_pop(mjs);
     mjs_val_t obj = mjs_pop(mjs);
     mjs_val_t key = mjs_pop(mjs);
     if(mjs_is_object(obj) && mjs_is_string(key)) {
-        mjs_val_t v = mjs_get_v(mjs, obj, key);
-        mjs_set_v(mjs, obj, key, do_op(mjs, v, val, op));
-        mjs_push(mjs, v);
+        exec_update(mjs, site, obj, key, val, op, true);
     } else {
         mjs_set_errorf(mjs, MJS_TYPE_ERROR, "invalid operand");
     }
@@ -232,7 +290,66 @@ static int check_equal(struct mjs* mjs, mjs_val_t a, mjs_val_t b) {
     return ret;
 }
 
-static void exec_expr(struct mjs* mjs, int op) {
+/*
+ * Fast path for binary ops on two numbers, the usual case in loops: operands
+ * are replaced with the result in place. Returns false if the generic path
+ * has to be taken.
+ */
+static bool exec_expr_numbers(struct mjs* mjs, int op, mjs_val_t* res) {
+    mjs_val_t a, b;
+    double da, db;
+    bool resnan;
+
+    if(mjs_stack_size(&mjs->stack) < 2) return false;
+    a = *vptr(&mjs->stack, -2);
+    b = *vptr(&mjs->stack, -1);
+    if(!mjs_is_number(a) || !mjs_is_number(b)) return false;
+
+    da = mjs_get_double(mjs, a);
+    db = mjs_get_double(mjs, b);
+    switch(op) {
+    case TOK_MINUS:
+    case TOK_PLUS:
+    case TOK_MUL:
+    case TOK_DIV:
+    case TOK_REM:
+    case TOK_XOR:
+    case TOK_AND:
+    case TOK_OR:
+    case TOK_LSHIFT:
+    case TOK_RSHIFT:
+    case TOK_URSHIFT: {
+        double result = do_arith_op(da, db, op, &resnan);
+        *res = resnan ? MJS_TAG_NAN : mjs_mk_number(mjs, result);
+        break;
+    }
+    case TOK_EQ_EQ:
+        *res = mjs_mk_boolean(mjs, check_equal(mjs, a, b));
+        break;
+    case TOK_NE_NE:
+        *res = mjs_mk_boolean(mjs, !check_equal(mjs, a, b));
+        break;
+    case TOK_LT:
+        *res = mjs_mk_boolean(mjs, da < db);
+        break;
+    case TOK_GT:
+        *res = mjs_mk_boolean(mjs, da > db);
+        break;
+    case TOK_LE:
+        *res = mjs_mk_boolean(mjs, da <= db);
+        break;
+    case TOK_GE:
+        *res = mjs_mk_boolean(mjs, da >= db);
+        break;
+    default:
+        return false;
+    }
+
+    mjs->stack.len -= 2 * sizeof(mjs_val_t);
+    return true;
+}
+
+static void exec_expr(struct mjs* mjs, int op, size_t site) {
     switch(op) {
     case TOK_DOT:
         break;
@@ -316,7 +433,13 @@ static void exec_expr(struct mjs* mjs, int op) {
         mjs_val_t obj = mjs_pop(mjs);
         mjs_val_t key = mjs_pop(mjs);
         if(mjs_is_object(obj)) {
-            mjs_set_v(mjs, obj, key, val);
+            struct mjs_property* p =
+                mjs_is_string(key) ? exec_own_property(mjs, site, obj, key) : NULL;
+            if(p != NULL) {
+                p->value = val;
+            } else {
+                mjs_set_v(mjs, obj, key, val);
+            }
         } else if(mjs_is_data_view(obj)) {
             mjs_err_t err = mjs_dataview_set_prop(mjs, obj, key, val);
             if(err != MJS_OK) {
@@ -352,10 +475,7 @@ static void exec_expr(struct mjs* mjs, int op) {
         mjs_val_t obj = mjs_pop(mjs);
         mjs_val_t key = mjs_pop(mjs);
         if(mjs_is_object(obj) && mjs_is_string(key)) {
-            mjs_val_t v = mjs_get_v(mjs, obj, key);
-            mjs_val_t v1 = do_op(mjs, v, mjs_mk_number(mjs, 1), TOK_PLUS);
-            mjs_set_v(mjs, obj, key, v1);
-            mjs_push(mjs, v);
+            exec_update(mjs, site, obj, key, mjs_mk_number(mjs, 1), TOK_PLUS, true);
         } else {
             mjs_set_errorf(mjs, MJS_TYPE_ERROR, "invalid operand for ++");
         }
@@ -365,10 +485,7 @@ static void exec_expr(struct mjs* mjs, int op) {
         mjs_val_t obj = mjs_pop(mjs);
         mjs_val_t key = mjs_pop(mjs);
         if(mjs_is_object(obj) && mjs_is_string(key)) {
-            mjs_val_t v = mjs_get_v(mjs, obj, key);
-            mjs_val_t v1 = do_op(mjs, v, mjs_mk_number(mjs, 1), TOK_MINUS);
-            mjs_set_v(mjs, obj, key, v1);
-            mjs_push(mjs, v);
+            exec_update(mjs, site, obj, key, mjs_mk_number(mjs, 1), TOK_MINUS, true);
         } else {
             mjs_set_errorf(mjs, MJS_TYPE_ERROR, "invalid operand for --");
         }
@@ -378,10 +495,7 @@ static void exec_expr(struct mjs* mjs, int op) {
         mjs_val_t obj = mjs_pop(mjs);
         mjs_val_t key = mjs_pop(mjs);
         if(mjs_is_object(obj) && mjs_is_string(key)) {
-            mjs_val_t v = mjs_get_v(mjs, obj, key);
-            v = do_op(mjs, v, mjs_mk_number(mjs, 1), TOK_MINUS);
-            mjs_set_v(mjs, obj, key, v);
-            mjs_push(mjs, v);
+            exec_update(mjs, site, obj, key, mjs_mk_number(mjs, 1), TOK_MINUS, false);
         } else {
             mjs_set_errorf(mjs, MJS_TYPE_ERROR, "invalid operand for --");
         }
@@ -391,10 +505,7 @@ static void exec_expr(struct mjs* mjs, int op) {
         mjs_val_t obj = mjs_pop(mjs);
         mjs_val_t key = mjs_pop(mjs);
         if(mjs_is_object(obj) && mjs_is_string(key)) {
-            mjs_val_t v = mjs_get_v(mjs, obj, key);
-            v = do_op(mjs, v, mjs_mk_number(mjs, 1), TOK_PLUS);
-            mjs_set_v(mjs, obj, key, v);
-            mjs_push(mjs, v);
+            exec_update(mjs, site, obj, key, mjs_mk_number(mjs, 1), TOK_PLUS, false);
         } else {
             mjs_set_errorf(mjs, MJS_TYPE_ERROR, "invalid operand for ++");
         }
@@ -407,17 +518,17 @@ static void exec_expr(struct mjs* mjs, int op) {
      */
 
         /* clang-format off */
-    case TOK_MINUS_ASSIGN:    op_assign(mjs, TOK_MINUS);    break;
-    case TOK_PLUS_ASSIGN:     op_assign(mjs, TOK_PLUS);     break;
-    case TOK_MUL_ASSIGN:      op_assign(mjs, TOK_MUL);      break;
-    case TOK_DIV_ASSIGN:      op_assign(mjs, TOK_DIV);      break;
-    case TOK_REM_ASSIGN:      op_assign(mjs, TOK_REM);      break;
-    case TOK_AND_ASSIGN:      op_assign(mjs, TOK_AND);      break;
-    case TOK_OR_ASSIGN:       op_assign(mjs, TOK_OR);       break;
-    case TOK_XOR_ASSIGN:      op_assign(mjs, TOK_XOR);      break;
-    case TOK_LSHIFT_ASSIGN:   op_assign(mjs, TOK_LSHIFT);   break;
-    case TOK_RSHIFT_ASSIGN:   op_assign(mjs, TOK_RSHIFT);   break;
-    case TOK_URSHIFT_ASSIGN:  op_assign(mjs, TOK_URSHIFT);  break;
+    case TOK_MINUS_ASSIGN:    op_assign(mjs, TOK_MINUS, site);    break;
+    case TOK_PLUS_ASSIGN:     op_assign(mjs, TOK_PLUS, site);     break;
+    case TOK_MUL_ASSIGN:      op_assign(mjs, TOK_MUL, site);      break;
+    case TOK_DIV_ASSIGN:      op_assign(mjs, TOK_DIV, site);      break;
+    case TOK_REM_ASSIGN:      op_assign(mjs, TOK_REM, site);      break;
+    case TOK_AND_ASSIGN:      op_assign(mjs, TOK_AND, site);      break;
+    case TOK_OR_ASSIGN:       op_assign(mjs, TOK_OR, site);       break;
+    case TOK_XOR_ASSIGN:      op_assign(mjs, TOK_XOR, site);      break;
+    case TOK_LSHIFT_ASSIGN:   op_assign(mjs, TOK_LSHIFT, site);   break;
+    case TOK_RSHIFT_ASSIGN:   op_assign(mjs, TOK_RSHIFT, site);   break;
+    case TOK_URSHIFT_ASSIGN:  op_assign(mjs, TOK_URSHIFT, site);  break;
     case TOK_COMMA: break;
     /* clang-format on */
     case TOK_KEYWORD_TYPEOF:
@@ -539,9 +650,10 @@ static int getprop_builtin_data_view(
     size_t name_len,
     mjs_val_t* res) {
     if(strcmp(name, "byteLength") == 0) {
-        size_t len = 0;
-        mjs_array_buf_get_ptr(mjs, mjs_dataview_get_buf(mjs, val), &len);
-        *res = mjs_mk_number(mjs, len);
+        *res = mjs_dataview_get_byte_len(mjs, val);
+        return 1;
+    } else if(strcmp(name, "byteOffset") == 0) {
+        *res = mjs_dataview_get_byte_offset(mjs, val);
         return 1;
     } else if(strcmp(name, "length") == 0) {
         *res = mjs_dataview_get_len(mjs, val);
@@ -549,6 +661,15 @@ static int getprop_builtin_data_view(
     } else if(strcmp(name, "buffer") == 0) {
         *res = mjs_dataview_get_buf(mjs, val);
         return 1;
+    } else if(strcmp(name, "set") == 0) {
+        *res = mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_dataview_set_items);
+        return 1;
+    } else if(strcmp(name, "subarray") == 0) {
+        *res = mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_dataview_subarray);
+        return 1;
+    } else if(strcmp(name, "copyWithin") == 0) {
+        *res = mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_dataview_copy_within);
+        return 1;
     }
 
     (void)name_len;
@@ -602,6 +723,116 @@ static int getprop_builtin(struct mjs* mjs, mjs_val_t val, mjs_val_t name, mjs_v
     return handled;
 }
 
+static mjs_val_t exec_get(struct mjs* mjs, mjs_val_t obj, mjs_val_t key) {
+    mjs_val_t val = MJS_UNDEFINED;
+
+    /* Typed array items, without turning the index into a string first */
+    if(mjs_is_data_view(obj) && mjs_is_number(key)) {
+        return mjs_dataview_get_prop(mjs, obj, key);
+    }
+
+    if(!getprop_builtin(mjs, obj, key, &val)) {
+        if(mjs_is_object(obj)) {
+            val = mjs_get_v_proto(mjs, obj, key);
+        } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
+            val = mjs_dataview_get_prop(mjs, obj, key);
+        } else {
+            mjs_prepend_errorf(mjs, MJS_TYPE_ERROR, "type error");
+        }
+    }
+
+    return val;
+}
+
+/*
+ * OP_FIND_SCOPE, mostly for assignments: like OP_GET_VAR, caches only hits
+ * in the innermost scope.
+ */
+static mjs_val_t exec_find_scope(struct mjs* mjs, size_t site, mjs_val_t key) {
+    struct mjs_inline_cache* ic = inline_cache_get(mjs, site);
+    mjs_val_t top = vtop(&mjs->scopes);
+    struct mjs_property* p;
+
+    if(ic->site == site && ic->obj == top) {
+        return top;
+    }
+
+    p = mjs_get_own_property_v(mjs, top, key);
+    if(p != NULL) {
+        inline_cache_set(mjs, site, top, p);
+        return top;
+    }
+
+    return mjs_find_scope(mjs, key);
+}
+
+/* `apply` is a builtin property of everything, see getprop_builtin() */
+static bool exec_is_apply(const char* name, size_t len) {
+    return len == 5 && strncmp(name, "apply", len) == 0;
+}
+
+/*
+ * OP_GET_VAR: variable lookup through the scopes. Hits are cached only for
+ * the innermost scope, outer ones could be shadowed by the next call.
+ */
+static mjs_val_t exec_get_var(struct mjs* mjs, size_t site, const char* name, size_t len) {
+    struct mjs_inline_cache* ic = inline_cache_get(mjs, site);
+    mjs_val_t top = vtop(&mjs->scopes);
+    size_t num_scopes = mjs_stack_size(&mjs->scopes);
+
+    if(ic->site == site && ic->obj == top) {
+        return ic->prop->value;
+    }
+
+    if(exec_is_apply(name, len)) {
+        mjs_val_t key = mjs_mk_string_interned(mjs, name, len);
+        mjs_val_t scope = mjs_find_scope(mjs, key);
+        return mjs->error == MJS_OK ? exec_get(mjs, scope, key) : MJS_UNDEFINED;
+    }
+
+    while(num_scopes > 0) {
+        mjs_val_t scope = *vptr(&mjs->scopes, num_scopes - 1);
+        struct mjs_property* p = mjs_get_own_property(mjs, scope, name, len);
+        if(p != NULL) {
+            if(scope == top) {
+                inline_cache_set(mjs, site, scope, p);
+            }
+            return p->value;
+        }
+        num_scopes--;
+    }
+
+    mjs_set_errorf(mjs, MJS_REFERENCE_ERROR, "[%.*s] is not defined", (int)len, name);
+    return MJS_UNDEFINED;
+}
+
+/*
+ * OP_GET_MEMBER: `obj.name`. Only own properties of plain objects are cached,
+ * everything else has builtin properties or goes up the prototype chain.
+ */
+static mjs_val_t exec_get_member(
+    struct mjs* mjs,
+    size_t site,
+    mjs_val_t obj,
+    const char* name,
+    size_t len) {
+    struct mjs_inline_cache* ic = inline_cache_get(mjs, site);
+
+    if(ic->site == site && ic->obj == obj) {
+        return ic->prop->value;
+    }
+
+    if((obj & MJS_TAG_MASK) == MJS_TAG_OBJECT && !exec_is_apply(name, len)) {
+        struct mjs_property* p = mjs_get_own_property(mjs, obj, name, len);
+        if(p != NULL) {
+            inline_cache_set(mjs, site, obj, p);
+            return p->value;
+        }
+    }
+
+    return exec_get(mjs, obj, mjs_mk_string_interned(mjs, name, len));
+}
+
 MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
     size_t i;
     uint8_t prev_opcode = OP_MAX;
@@ -717,7 +948,7 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
         }
         case OP_FIND_SCOPE: {
             mjs_val_t key = vtop(&mjs->stack);
-            mjs_push(mjs, mjs_find_scope(mjs, key));
+            mjs_push(mjs, exec_find_scope(mjs, bp.start_idx + i, key));
             break;
         }
         case OP_CREATE: {
@@ -740,19 +971,8 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
         case OP_GET: {
             mjs_val_t obj = mjs_pop(mjs);
             mjs_val_t key = mjs_pop(mjs);
-            mjs_val_t val = MJS_UNDEFINED;
-
-            if(!getprop_builtin(mjs, obj, key, &val)) {
-                if(mjs_is_object(obj)) {
-                    val = mjs_get_v_proto(mjs, obj, key);
-                } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
-                    val = mjs_dataview_get_prop(mjs, obj, key);
-                } else {
-                    mjs_prepend_errorf(mjs, MJS_TYPE_ERROR, "type error");
-                }
-            }
 
-            mjs_push(mjs, val);
+            mjs_push(mjs, exec_get(mjs, obj, key));
             if(prev_opcode != OP_FIND_SCOPE) {
                 /*
            * Previous opcode was not OP_FIND_SCOPE, so it's some "custom"
@@ -768,6 +988,23 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             }
             break;
         }
+        case OP_GET_VAR: {
+            int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
+            const char* name = (const char*)code + i + 1 + llen;
+            mjs_push(mjs, exec_get_var(mjs, bp.start_idx + i, name, n));
+            mjs->vals.last_getprop_obj = MJS_UNDEFINED;
+            i += llen + n;
+            break;
+        }
+        case OP_GET_MEMBER: {
+            int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
+            const char* name = (const char*)code + i + 1 + llen;
+            mjs_val_t obj = mjs_pop(mjs);
+            mjs_push(mjs, exec_get_member(mjs, bp.start_idx + i, obj, name, n));
+            mjs->vals.last_getprop_obj = obj;
+            i += llen + n;
+            break;
+        }
         case OP_DEL_SCOPE:
             if(mjs->scopes.len <= 1) {
                 mjs_set_errorf(mjs, MJS_INTERNAL_ERROR, "scopes underflow");
@@ -784,7 +1021,7 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             break;
         case OP_PUSH_STR: {
             int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
-            mjs_push(mjs, mjs_mk_string(mjs, (char*)code + i + 1 + llen, n, 1));
+            mjs_push(mjs, mjs_mk_string_interned(mjs, (char*)code + i + 1 + llen, n));
             i += llen + n;
             break;
         }
@@ -842,11 +1079,11 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
         }
         case OP_ARGS: {
             /*
-         * If OP_ARGS follows OP_GET, then last_getprop_obj is set to `this`
-         * value; otherwise, last_getprop_obj is irrelevant and we have to
-         * reset it to `undefined`
+         * If OP_ARGS follows OP_GET or OP_GET_MEMBER, then last_getprop_obj
+         * is set to `this` value; otherwise, last_getprop_obj is irrelevant
+         * and we have to reset it to `undefined`
          */
-            if(prev_opcode != OP_GET) {
+            if(prev_opcode != OP_GET && prev_opcode != OP_GET_MEMBER) {
                 mjs->vals.last_getprop_obj = MJS_UNDEFINED;
             }
 
@@ -916,7 +1153,7 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             int llen1, llen2, n, arg_no = cs_varint_decode_unsafe(&code[i + 1], &llen1);
             mjs_val_t obj, key, v;
             n = cs_varint_decode_unsafe(&code[i + llen1 + 1], &llen2);
-            key = mjs_mk_string(mjs, (char*)code + i + 1 + llen1 + llen2, n, 1);
+            key = mjs_mk_string_interned(mjs, (char*)code + i + 1 + llen1 + llen2, n);
             obj = vtop(&mjs->scopes);
             v = mjs_arg(mjs, arg_no);
             mjs_set_v(mjs, obj, key, v);
@@ -937,8 +1174,25 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
         }
         case OP_EXPR: {
             int op = code[i + 1];
-            exec_expr(mjs, op);
+            mjs_val_t val;
+            if(!exec_expr_numbers(mjs, op, &val)) {
+                exec_expr(mjs, op, bp.start_idx + i);
+                i++;
+                break;
+            }
             i++;
+            if(i + 1 < bp.data.len && code[i + 1] == OP_JMP_FALSE && mjs_is_boolean(val)) {
+                /* Compare and branch, the condition does not go through the stack */
+                int llen, n = cs_varint_decode_unsafe(&code[i + 2], &llen);
+                opcode = OP_JMP_FALSE;
+                i += 1 + llen;
+                if(!mjs_get_bool(mjs, val)) {
+                    mjs_push(mjs, MJS_UNDEFINED);
+                    i += n;
+                }
+            } else {
+                mjs_push(mjs, val);
+            }
             break;
         }
         case OP_DROP: {
@@ -1071,6 +1325,11 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
 #if MJS_ENABLE_DEBUG
     if(cs_log_level >= LL_VERBOSE_DEBUG) mjs_dump(mjs, 1);
 #endif
+    if(mjs->error == MJS_OK && generate_jsc == -1 && mjs->bcode_save != NULL) {
+        /* Script comes from a file: let the cache store its bcode */
+        struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+        mjs->bcode_save(mjs->bcode_cache_context, path, bp->data.p, bp->data.len);
+    }
     if(generate_jsc == -1) generate_jsc = mjs->generate_jsc;
     if(mjs->error == MJS_OK) {
 #if MJS_GENERATE_JSC && defined(CS_MMAP)
@@ -1149,11 +1408,41 @@ mjs_err_t mjs_exec(struct mjs* mjs, const char* src, mjs_val_t* res) {
     return mjs_exec_internal(mjs, "<stdin>", src, 0 /* generate_jsc */, res);
 }
 
+/*
+ * Executes cached bcode of the script at `path`, if the cache has it.
+ * Returns 0 if the script has to be parsed.
+ */
+static int mjs_exec_cached(struct mjs* mjs, const char* path, mjs_err_t* error, mjs_val_t* res) {
+    size_t off = mjs->bcode_len;
+    size_t size = 0;
+    char* bcode;
+
+    if(mjs->bcode_load == NULL) return 0;
+    bcode = mjs->bcode_load(mjs->bcode_cache_context, path, &size);
+    if(bcode == NULL) return 0;
+
+    if(!mjs_bcode_is_valid(bcode, size)) {
+        LOG(LL_WARN, ("Invalid cached bcode for %s", path));
+        free(bcode);
+        return 0;
+    }
+
+    mjs_bcode_append(mjs, bcode, size);
+    *error = mjs_execute(mjs, off, res);
+    return 1;
+}
+
 mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     mjs_err_t error = MJS_FILE_READ_ERROR;
     mjs_val_t r = MJS_UNDEFINED;
     size_t size;
-    char* source_code = cs_read_file(path, &size);
+    char* source_code;
+
+    if(mjs_exec_cached(mjs, path, &error, &r)) {
+        goto clean;
+    }
+
+    source_code = cs_read_file(path, &size);
 
     if(source_code == NULL) {
         error = MJS_FILE_READ_ERROR;
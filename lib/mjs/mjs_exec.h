@@ -20,6 +20,12 @@ extern "C" {
 
 MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res);
 
+/*
+ * Drops cached property lookups, must be called whenever properties may be
+ * unlinked or freed.
+ */
+MJS_PRIVATE void mjs_inline_cache_reset(struct mjs* mjs);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -4,11 +4,13 @@
  */
 
 #include <stdio.h>
+#include <furi.h>
 
 #include "common/cs_varint.h"
 #include "common/mbuf.h"
 
 #include "mjs_core.h"
+#include "mjs_exec.h"
 #include "mjs_ffi.h"
 #include "mjs_gc.h"
 #include "mjs_internal.h"
@@ -37,8 +39,26 @@
  */
 #define GC_ARENA_CELLS_RESERVE 2
 
+/*
+ * After collection each arena keeps at least 1/GC_ARENA_FREE_RATIO of its live
+ * cells free (but no more than GC_ARENA_RESERVE_MAX), so the number of
+ * allocations between collections grows with the live set instead of being
+ * fixed by the arena increment.
+ */
+#define GC_ARENA_FREE_RATIO 2
+#define GC_ARENA_RESERVE_MAX 256
+
+/* Same for the owned strings buffer, in bytes */
+#define GC_STRINGS_RESERVE_MAX 2048
+
+/*
+ * `mjs_gc_idle()` collects early once less than 1/GC_IDLE_FREE_RATIO of the
+ * reserve is left.
+ */
+#define GC_IDLE_FREE_RATIO 4
+
 static struct gc_block* gc_new_block(struct gc_arena* a, size_t size);
-static void gc_free_block(struct gc_block* b);
+static void gc_free_block(struct gc_arena* a, struct gc_block* b);
 static void gc_mark_mbuf_pt(struct mjs* mjs, const struct mbuf* mbuf);
 
 MJS_PRIVATE struct mjs_object* new_object(struct mjs* mjs) {
@@ -53,6 +73,10 @@ MJS_PRIVATE struct mjs_ffi_sig* new_ffi_sig(struct mjs* mjs) {
     return (struct mjs_ffi_sig*)gc_alloc_cell(mjs, &mjs->ffi_sig_arena);
 }
 
+MJS_PRIVATE struct mjs_string_cell* new_string_cell(struct mjs* mjs) {
+    return (struct mjs_string_cell*)gc_alloc_cell(mjs, &mjs->string_arena);
+}
+
 /* Initializes a new arena. */
 MJS_PRIVATE void gc_arena_init(
     struct gc_arena* a,
@@ -76,12 +100,13 @@ MJS_PRIVATE void gc_arena_destroy(struct mjs* mjs, struct gc_arena* a) {
             struct gc_block* tmp;
             tmp = b;
             b = b->next;
-            gc_free_block(tmp);
+            gc_free_block(a, tmp);
         }
     }
 }
 
-static void gc_free_block(struct gc_block* b) {
+static void gc_free_block(struct gc_arena* a, struct gc_block* b) {
+    a->cells -= b->size;
     free(b->base);
     free(b);
 }
@@ -102,6 +127,8 @@ static struct gc_block* gc_new_block(struct gc_arena* a, size_t size) {
         cur->head.link = a->free;
         a->free = cur;
     }
+    a->cells += size;
+    a->free_cells += size;
 
     return b;
 }
@@ -111,16 +138,31 @@ static struct gc_block* gc_new_block(struct gc_arena* a, size_t size) {
  * cells
  */
 static int gc_arena_is_gc_needed(struct gc_arena* a) {
-    struct gc_cell* r = a->free;
-    int i;
+    return a->free_cells <= GC_ARENA_CELLS_RESERVE;
+}
 
-    for(i = 0; i <= GC_ARENA_CELLS_RESERVE; i++, r = r->head.link) {
-        if(r == NULL) {
-            return 1;
-        }
-    }
+/* Number of free cells the arena should have after collection */
+static size_t gc_arena_reserve_size(const struct gc_arena* a) {
+    size_t size = (a->cells - a->free_cells) / GC_ARENA_FREE_RATIO;
+    if(size < a->reserve_min) size = a->reserve_min;
+    return size < GC_ARENA_RESERVE_MAX ? size : GC_ARENA_RESERVE_MAX;
+}
 
-    return 0;
+/* Grows the arena after collection if too few cells are free */
+static void gc_arena_reserve(struct gc_arena* a) {
+    size_t wanted = gc_arena_reserve_size(a);
+    size_t size;
+    struct gc_block* b;
+
+    if(a->free_cells >= wanted) return;
+
+    /* Round up to the increment, so that blocks stay of a few common sizes */
+    size = wanted - a->free_cells;
+    size = (size + a->size_increment - 1) / a->size_increment * a->size_increment;
+
+    b = gc_new_block(a, size);
+    b->next = a->blocks;
+    a->blocks = b;
 }
 
 MJS_PRIVATE int gc_strings_is_gc_needed(struct mjs* mjs) {
@@ -128,6 +170,22 @@ MJS_PRIVATE int gc_strings_is_gc_needed(struct mjs* mjs) {
     return (double)m->len / (double)m->size > (double)0.9;
 }
 
+/*
+ * Grows the strings buffer after compaction, so that the next collection is
+ * not immediately scheduled by `gc_strings_is_gc_needed()`
+ */
+static void gc_strings_reserve(struct mjs* mjs) {
+    struct mbuf* m = &mjs->owned_strings;
+    size_t reserve = m->len / GC_ARENA_FREE_RATIO;
+    size_t size;
+
+    if(reserve > GC_STRINGS_RESERVE_MAX) reserve = GC_STRINGS_RESERVE_MAX;
+    size = (m->len + reserve) * 10 / 9 + 1;
+    if(size > m->size) {
+        mbuf_resize(m, size);
+    }
+}
+
 MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
     struct gc_cell* r;
 
@@ -141,6 +199,7 @@ MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
     UNMARK(r);
 
     a->free = r->head.link;
+    a->free_cells--;
 
 #if MJS_MEMORY_STATS
     a->allocations++;
@@ -166,10 +225,11 @@ MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
  * Empty blocks get deallocated. The head of the free list will contais cells
  * from the last (oldest) block. Cells will thus be allocated in block order.
  */
-void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
+size_t gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
     struct gc_block* b;
     struct gc_cell* cur;
     struct gc_block** prevp = &a->blocks;
+    size_t alive = 0;
 #if MJS_MEMORY_STATS
     a->alive = 0;
 #endif
@@ -190,6 +250,7 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
    * We'll rebuild the whole `free` list, so initially we just reset it
    */
     a->free = NULL;
+    a->free_cells = 0;
 
     for(b = a->blocks; b != NULL;) {
         size_t freed_in_block = 0;
@@ -205,6 +266,7 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
             if(MARKED(cur)) {
                 /* The cell is used and marked  */
                 UNMARK(cur);
+                alive++;
 #if MJS_MEMORY_STATS
                 a->alive++;
 #endif
@@ -246,14 +308,17 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
      * */
         if(b->next != NULL && freed_in_block == b->size) {
             *prevp = b->next;
-            gc_free_block(b);
+            gc_free_block(a, b);
             b = *prevp;
             a->free = prev_free;
         } else {
+            a->free_cells += freed_in_block;
             prevp = &b->next;
             b = b->next;
         }
     }
+
+    return alive;
 }
 
 /* Mark an FFI signature */
@@ -376,6 +441,12 @@ MJS_PRIVATE void gc_mark(struct mjs* mjs, mjs_val_t* v) {
     if((*v & MJS_TAG_MASK) == MJS_TAG_STRING_O) {
         gc_mark_string(mjs, v);
     }
+    if((*v & MJS_TAG_MASK) == MJS_TAG_STRING_B) {
+        if(!gc_check_val(mjs, *v)) {
+            abort();
+        }
+        MARK(get_ptr(*v));
+    }
 }
 
 MJS_PRIVATE uint64_t gc_string_mjs_val_to_offset(mjs_val_t v) {
@@ -485,6 +556,9 @@ static void gc_mark_ffi_cbargs_list(struct mjs* mjs, ffi_cb_args_t* cbargs) {
 
 /* Perform garbage collection */
 void mjs_gc(struct mjs* mjs, int full) {
+    struct mjs_gc_stats* stats = &mjs->gc_stats;
+    uint32_t start = furi_get_tick();
+
     gc_mark_val_array(mjs, (mjs_val_t*)&mjs->vals, sizeof(mjs->vals) / sizeof(mjs_val_t));
 
     gc_mark_mbuf_pt(mjs, &mjs->owned_values);
@@ -494,11 +568,34 @@ void mjs_gc(struct mjs* mjs, int full) {
 
     gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
 
+    /* Full GC drops the interned strings to give their memory back */
+    if(full) {
+        for(size_t i = 0; i < MJS_STRING_INTERN_SIZE; i++) {
+            mjs->interned_strings[i] = MJS_UNDEFINED;
+        }
+    } else {
+        gc_mark_val_array(mjs, mjs->interned_strings, MJS_STRING_INTERN_SIZE);
+    }
+
     gc_compact_strings(mjs);
 
-    gc_sweep(mjs, &mjs->object_arena, 0);
-    gc_sweep(mjs, &mjs->property_arena, 0);
+    stats->objects = gc_sweep(mjs, &mjs->object_arena, 0);
+    stats->properties = gc_sweep(mjs, &mjs->property_arena, 0);
     gc_sweep(mjs, &mjs->ffi_sig_arena, 0);
+    gc_sweep(mjs, &mjs->string_arena, 0);
+    mjs->string_buf_allocated = 0;
+
+    /* Swept cells are reused, cached lookups could point at them */
+    mjs_inline_cache_reset(mjs);
+
+    /* Full GC is a request to give memory back, don't grow on it */
+    if(!full) {
+        gc_arena_reserve(&mjs->object_arena);
+        gc_arena_reserve(&mjs->property_arena);
+        gc_arena_reserve(&mjs->ffi_sig_arena);
+        gc_arena_reserve(&mjs->string_arena);
+        gc_strings_reserve(mjs);
+    }
 
     if(full) {
         /*
@@ -511,6 +608,41 @@ void mjs_gc(struct mjs* mjs, int full) {
             mbuf_resize(&mjs->owned_strings, trimmed_size);
         }
     }
+
+    mjs->need_gc = 0;
+
+    stats->collections++;
+    stats->last_pause = furi_get_tick() - start;
+    stats->total_pause += stats->last_pause;
+    if(stats->last_pause > stats->max_pause) {
+        stats->max_pause = stats->last_pause;
+    }
+    stats->object_cells = mjs->object_arena.cells;
+    stats->property_cells = mjs->property_arena.cells;
+    stats->strings_size = mjs->owned_strings.len;
+}
+
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats) {
+    *stats = mjs->gc_stats;
+}
+
+static int gc_arena_is_idle_gc_needed(const struct gc_arena* a) {
+    return a->free_cells * GC_IDLE_FREE_RATIO < gc_arena_reserve_size(a);
+}
+
+int mjs_gc_idle(struct mjs* mjs) {
+    if(mjs->inhibit_gc) return 0;
+
+    if(mjs->need_gc || gc_strings_is_gc_needed(mjs) ||
+       gc_arena_is_idle_gc_needed(&mjs->object_arena) ||
+       gc_arena_is_idle_gc_needed(&mjs->property_arena) ||
+       gc_arena_is_idle_gc_needed(&mjs->string_arena)) {
+        mjs_gc(mjs, 0);
+        mjs->gc_stats.idle_collections++;
+        return 1;
+    }
+
+    return 0;
 }
 
 MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
@@ -520,6 +652,9 @@ MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
     if(mjs_is_ffi_sig(v)) {
         return gc_check_ptr(&mjs->ffi_sig_arena, mjs_get_ffi_sig_struct(v));
     }
+    if((v & MJS_TAG_MASK) == MJS_TAG_STRING_B) {
+        return gc_check_ptr(&mjs->string_arena, get_ptr(v));
+    }
     return 1;
 }
 
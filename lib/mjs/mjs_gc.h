@@ -37,12 +37,13 @@ MJS_PRIVATE int maybe_gc(struct mjs* mjs);
 MJS_PRIVATE struct mjs_object* new_object(struct mjs*);
 MJS_PRIVATE struct mjs_property* new_property(struct mjs*);
 MJS_PRIVATE struct mjs_ffi_sig* new_ffi_sig(struct mjs* mjs);
+MJS_PRIVATE struct mjs_string_cell* new_string_cell(struct mjs* mjs);
 
 MJS_PRIVATE void gc_mark(struct mjs* mjs, mjs_val_t* val);
 
 MJS_PRIVATE void gc_arena_init(struct gc_arena*, size_t, size_t, size_t);
 MJS_PRIVATE void gc_arena_destroy(struct mjs*, struct gc_arena* a);
-MJS_PRIVATE void gc_sweep(struct mjs*, struct gc_arena*, size_t);
+MJS_PRIVATE size_t gc_sweep(struct mjs*, struct gc_arena*, size_t);
 MJS_PRIVATE void* gc_alloc_cell(struct mjs*, struct gc_arena*);
 
 MJS_PRIVATE uint64_t gc_string_mjs_val_to_offset(mjs_val_t v);
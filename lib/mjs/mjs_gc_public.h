@@ -18,6 +18,33 @@ extern "C" {
  */
 void mjs_gc(struct mjs* mjs, int full);
 
+/*
+ * Garbage collector statistics, see `mjs_gc_get_stats()`.
+ * Pauses are in kernel ticks.
+ */
+struct mjs_gc_stats {
+    unsigned long collections; /* Total number of collections */
+    unsigned long idle_collections; /* Collections done by `mjs_gc_idle()` */
+    uint32_t last_pause;
+    uint32_t max_pause;
+    uint32_t total_pause;
+    size_t objects; /* Live objects after the last collection */
+    size_t object_cells; /* Object arena capacity */
+    size_t properties; /* Live properties after the last collection */
+    size_t property_cells; /* Property arena capacity */
+    size_t strings_size; /* Owned strings in use */
+};
+
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats);
+
+/*
+ * Collect garbage ahead of time if a collection is due soon.
+ * Meant to be called when the script is about to sleep, so that the pause
+ * does not happen later in the middle of the script work.
+ * Returns 1 if a collection was performed.
+ */
+int mjs_gc_idle(struct mjs* mjs);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -27,6 +27,9 @@ struct gc_arena {
     size_t size_increment;
     struct gc_cell* free; /* head of free list */
     size_t cell_size;
+    size_t cells; /* total number of cells in all blocks */
+    size_t free_cells; /* length of the free list */
+    size_t reserve_min; /* free cells to keep after collection at least */
 
 #if MJS_MEMORY_STATS
     unsigned long allocations; /* cumulative counter of allocations */
@@ -4,7 +4,9 @@
  */
 
 #include "mjs_object.h"
+#include "mjs_array.h"
 #include "mjs_core.h"
+#include "mjs_exec.h"
 #include "mjs_internal.h"
 #include "mjs_primitive.h"
 #include "mjs_string.h"
@@ -31,6 +33,118 @@ MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v) {
     return ret;
 }
 
+/*
+ * Open addressing hash table over property names. Properties themselves stay
+ * in the list (GC, enumeration order and `mjs_next()` rely on it), the index
+ * only points into it. Names are hashed by content, so string compaction
+ * which moves the name data does not invalidate it.
+ */
+struct mjs_property_index_slot {
+    uint32_t hash;
+    struct mjs_property* prop;
+};
+
+struct mjs_property_index {
+    uint32_t capacity; /* Power of 2 */
+    uint32_t count;
+    struct mjs_property_index_slot slots[];
+};
+
+/* Marks objects that are too big to be indexed */
+static struct mjs_property_index mjs_property_index_overflow;
+
+static void mjs_property_index_free(struct mjs_object* o) {
+    if(o->index != &mjs_property_index_overflow) {
+        free(o->index);
+    }
+    o->index = NULL;
+}
+
+static void mjs_property_index_insert(
+    struct mjs_property_index* index,
+    uint32_t hash,
+    struct mjs_property* prop) {
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = hash & mask;
+    while(index->slots[i].prop != NULL) {
+        i = (i + 1) & mask;
+    }
+    index->slots[i].hash = hash;
+    index->slots[i].prop = prop;
+    index->count++;
+}
+
+static void mjs_property_index_build(struct mjs* mjs, struct mjs_object* o, uint32_t count) {
+    struct mjs_property* p;
+    uint32_t capacity = 16;
+
+    mjs_property_index_free(o);
+    if(count > MJS_PROPERTY_INDEX_MAX) {
+        o->index = &mjs_property_index_overflow;
+        return;
+    }
+
+    /* Keep load factor at or below 1/2 */
+    while(capacity < count * 2) {
+        capacity <<= 1;
+    }
+    o->index = calloc(
+        1, sizeof(struct mjs_property_index) + capacity * sizeof(struct mjs_property_index_slot));
+    o->index->capacity = capacity;
+
+    /*
+   * List is newest first and names are unique, so insertion order does not
+   * matter for lookups.
+   */
+    for(p = o->properties; p != NULL; p = p->next) {
+        size_t n;
+        const char* s = mjs_get_string(mjs, &p->name, &n);
+        mjs_property_index_insert(o->index, mjs_string_hash(s, n), p);
+    }
+}
+
+static void
+    mjs_property_index_add(struct mjs* mjs, struct mjs_object* o, struct mjs_property* prop) {
+    size_t n;
+    const char* s;
+
+    if(o->index == NULL || o->index == &mjs_property_index_overflow) {
+        return;
+    }
+    if((o->index->count + 1) * 2 > o->index->capacity) {
+        /* Rebuild from the list, which already contains the new property */
+        mjs_property_index_build(mjs, o, o->index->count + 1);
+        return;
+    }
+
+    s = mjs_get_string(mjs, &prop->name, &n);
+    mjs_property_index_insert(o->index, mjs_string_hash(s, n), prop);
+}
+
+static struct mjs_property* mjs_property_index_find(
+    struct mjs* mjs,
+    struct mjs_property_index* index,
+    const char* name,
+    size_t len) {
+    uint32_t hash = mjs_string_hash(name, len);
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = hash & mask;
+
+    for(; index->slots[i].prop != NULL; i = (i + 1) & mask) {
+        struct mjs_property* p = index->slots[i].prop;
+        if(index->slots[i].hash == hash && mjs_strcmp(mjs, &p->name, name, len) == 0) {
+            return p;
+        }
+    }
+
+    return NULL;
+}
+
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell) {
+    (void)mjs;
+    mjs_property_index_free((struct mjs_object*)cell);
+}
+
 mjs_val_t mjs_mk_object(struct mjs* mjs) {
     struct mjs_object* o = new_object(mjs);
     if(o == NULL) {
@@ -38,6 +152,8 @@ mjs_val_t mjs_mk_object(struct mjs* mjs) {
     }
     (void)mjs;
     o->properties = NULL;
+    o->index = NULL;
+    o->array_length = 0;
     return mjs_object_to_value(o);
 }
 
@@ -54,26 +170,46 @@ MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     struct mjs_property* p;
     struct mjs_object* o;
+    uint32_t visited = 0;
 
     if(!mjs_is_object_based(obj)) {
         return NULL;
     }
 
     o = get_object_struct(obj);
+    if(len == (size_t)~0) {
+        len = strlen(name);
+    }
+
+    if(o->index != NULL && o->index != &mjs_property_index_overflow) {
+        return mjs_property_index_find(mjs, o->index, name, len);
+    }
 
     if(len <= 5) {
         mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(p->name == ss) return p;
+        for(p = o->properties; p != NULL; p = p->next, visited++) {
+            if(p->name == ss) break;
         }
     } else {
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
+        for(p = o->properties; p != NULL; p = p->next, visited++) {
+            if(mjs_strcmp(mjs, &p->name, name, len) == 0) break;
         }
-        return p;
     }
 
-    return NULL;
+    /*
+   * Long scan: index the object, so that following lookups (typically method
+   * calls on module objects) are O(1). Count the rest of the list only once.
+   */
+    if(visited >= MJS_PROPERTY_INDEX_THRESHOLD && o->index == NULL) {
+        struct mjs_property* rest;
+        uint32_t count = visited;
+        for(rest = p; rest != NULL && count <= MJS_PROPERTY_INDEX_MAX; rest = rest->next) {
+            count++;
+        }
+        mjs_property_index_build(mjs, o, count);
+    }
+
+    return p;
 }
 
 MJS_PRIVATE struct mjs_property*
@@ -163,6 +299,9 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
     struct mjs_property* p;
 
     int need_free = 0;
+    int is_index = 0;
+    unsigned long index = 0;
+    uint32_t array_length = MJS_ARRAY_LENGTH_UNKNOWN;
 
     if(name == NULL) {
         /* Pointer was not provided, so obtain one from the name_v. */
@@ -178,7 +317,18 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         name_v = MJS_UNDEFINED;
     }
 
-    p = mjs_get_own_property(mjs, obj, name, name_len);
+    if(mjs_is_array(obj)) {
+        array_length = get_object_struct(obj)->array_length;
+        index = cstr_to_ulong(name, name_len, &is_index);
+        is_index = is_index && index < 0xffffffff;
+    }
+
+    if(is_index && array_length != MJS_ARRAY_LENGTH_UNKNOWN && index >= array_length) {
+        /* Appending to an array, there is no such element yet */
+        p = NULL;
+    } else {
+        p = mjs_get_own_property(mjs, obj, name, name_len);
+    }
 
     if(p == NULL) {
         struct mjs_object* o;
@@ -188,10 +338,11 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
 
         /*
      * name_v might be not a string here. In this case, we need to create a new
-     * `name_v`, which will be a string.
+     * `name_v`, which will be a string. Builder strings are not kept as names
+     * either, so that their buffers can be released.
      */
-        if(!mjs_is_string(name_v)) {
-            name_v = mjs_mk_string(mjs, name, name_len, 1);
+        if(!mjs_is_string(name_v) || (name_v & MJS_TAG_MASK) == MJS_TAG_STRING_B) {
+            name_v = mjs_mk_string_interned(mjs, name, name_len);
         }
 
         p = mjs_mk_property(mjs, name_v, val);
@@ -199,6 +350,10 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         o = get_object_struct(obj);
         p->next = o->properties;
         o->properties = p;
+        mjs_property_index_add(mjs, o, p);
+        if(is_index && array_length != MJS_ARRAY_LENGTH_UNKNOWN && index >= array_length) {
+            o->array_length = index + 1;
+        }
     }
 
     p->value = val;
@@ -237,6 +392,10 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
             } else {
                 get_object_struct(obj)->properties = prop->next;
             }
+            /* Deletes are rare, drop the index and let lookups rebuild it */
+            mjs_property_index_free(get_object_struct(obj));
+            get_object_struct(obj)->array_length = MJS_ARRAY_LENGTH_UNKNOWN;
+            mjs_inline_cache_reset(mjs);
             mjs_destroy_property(&prop);
             return 0;
         }
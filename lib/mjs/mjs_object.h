@@ -21,8 +21,28 @@ struct mjs_property {
     mjs_val_t value; /* Property value */
 };
 
+/*
+ * Objects with at least this many properties get a hash index on the first
+ * long lookup, smaller ones are scanned linearly.
+ */
+#ifndef MJS_PROPERTY_INDEX_THRESHOLD
+#define MJS_PROPERTY_INDEX_THRESHOLD 8
+#endif
+
+/* Objects (mostly big arrays) beyond this many properties are not indexed */
+#ifndef MJS_PROPERTY_INDEX_MAX
+#define MJS_PROPERTY_INDEX_MAX 512
+#endif
+
+struct mjs_property_index;
+
+/* Array length is not known and has to be computed from the properties */
+#define MJS_ARRAY_LENGTH_UNKNOWN UINT32_MAX
+
 struct mjs_object {
     struct mjs_property* properties;
+    struct mjs_property_index* index; /* Name hash index, NULL if not built */
+    uint32_t array_length; /* Cached length, arrays only */
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
@@ -45,6 +65,11 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
     size_t name_len,
     mjs_val_t val);
 
+/*
+ * Object arena cell destructor: frees the property index
+ */
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell);
+
 /*
  * Implementation of `Object.create(proto)`
  */
@@ -306,13 +306,16 @@ static enum mjs_err parse_literal(struct pstate* p, const struct tok* t) {
     case TOK_IDENT: {
         int prev_tok = p->prev_tok;
         int next_tok = ptest(p);
-        emit_byte(p, OP_PUSH_STR);
-        emit_str(p, t->ptr, t->len);
-        emit_byte(p, (uint8_t)(prev_tok == TOK_DOT ? OP_SWAP : OP_FIND_SCOPE));
         if(!findtok(s_assign_ops, next_tok) && !findtok(s_postfix_ops, next_tok) &&
            /* TODO(dfrank): fix: it doesn't work for prefix ops */
            !findtok(s_postfix_ops, prev_tok)) {
-            emit_byte(p, OP_GET);
+            /* Plain reads are fused, so that the executor can cache them */
+            emit_byte(p, (uint8_t)(prev_tok == TOK_DOT ? OP_GET_MEMBER : OP_GET_VAR));
+            emit_str(p, t->ptr, t->len);
+        } else {
+            emit_byte(p, OP_PUSH_STR);
+            emit_str(p, t->ptr, t->len);
+            emit_byte(p, (uint8_t)(prev_tok == TOK_DOT ? OP_SWAP : OP_FIND_SCOPE));
         }
         break;
     }
@@ -7,6 +7,7 @@
 #include "common/cs_varint.h"
 #include "common/mg_str.h"
 #include "mjs_core.h"
+#include "mjs_gc.h"
 #include "mjs_internal.h"
 #include "mjs_primitive.h"
 #include "mjs_util.h"
@@ -26,6 +27,21 @@ static int runetochar(char* str, Rune* rune) {
 #define MJS_STRING_BUF_RESERVE 100
 #endif
 
+/* Concatenations at least this long make builder strings */
+#ifndef MJS_STRING_BUILDER_MIN
+#define MJS_STRING_BUILDER_MIN 32
+#endif
+
+/* Collect garbage after this many bytes of builder buffers were allocated */
+#ifndef MJS_STRING_BUILDER_GC_SIZE
+#define MJS_STRING_BUILDER_GC_SIZE 4096
+#endif
+
+/* Longer strings are not interned, so that the table holds little memory */
+#ifndef MJS_STRING_INTERN_MAX_LEN
+#define MJS_STRING_INTERN_MAX_LEN 64
+#endif
+
 MJS_PRIVATE size_t unescape(const char* s, size_t len, char* to);
 
 MJS_PRIVATE void embed_string(
@@ -41,7 +57,100 @@ MJS_PRIVATE void embed_string(
 int mjs_is_string(mjs_val_t v) {
     uint64_t t = v & MJS_TAG_MASK;
     return t == MJS_TAG_STRING_I || t == MJS_TAG_STRING_F || t == MJS_TAG_STRING_O ||
-           t == MJS_TAG_STRING_5 || t == MJS_TAG_STRING_D;
+           t == MJS_TAG_STRING_5 || t == MJS_TAG_STRING_D || t == MJS_TAG_STRING_B;
+}
+
+static void mjs_string_buf_account(struct mjs* mjs, size_t size) {
+    mjs->string_buf_allocated += size;
+    if(mjs->string_buf_allocated >= MJS_STRING_BUILDER_GC_SIZE) {
+        mjs->need_gc = 1;
+    }
+}
+
+static struct mjs_string_buf* mjs_string_buf_alloc(struct mjs* mjs, size_t size) {
+    struct mjs_string_buf* buf = malloc(sizeof(struct mjs_string_buf));
+    buf->data = malloc(size + 1);
+    buf->len = 0;
+    buf->size = size;
+    buf->refs = 0;
+    mjs_string_buf_account(mjs, size);
+    return buf;
+}
+
+static void mjs_string_buf_release(struct mjs_string_buf* buf) {
+    if(--buf->refs == 0) {
+        free(buf->data);
+        free(buf);
+    }
+}
+
+MJS_PRIVATE void mjs_string_cell_destructor(struct mjs* mjs, void* cell) {
+    (void)mjs;
+    mjs_string_buf_release(((struct mjs_string_cell*)cell)->buf);
+}
+
+/* Makes a builder string of the whole current buffer contents */
+static mjs_val_t mjs_mk_string_cell(struct mjs* mjs, struct mjs_string_buf* buf) {
+    struct mjs_string_cell* cell = new_string_cell(mjs);
+    cell->buf = buf;
+    cell->len = buf->len;
+    buf->refs++;
+    return mjs_legit_pointer_to_value(cell) | MJS_TAG_STRING_B;
+}
+
+/*
+ * Only the longest string of a buffer is NUL-terminated, shorter ones get
+ * their own copy once they are read.
+ */
+static void mjs_string_cell_detach(struct mjs* mjs, struct mjs_string_cell* cell) {
+    struct mjs_string_buf* buf = mjs_string_buf_alloc(mjs, cell->len);
+    memcpy(buf->data, cell->buf->data, cell->len);
+    buf->len = cell->len;
+    buf->data[buf->len] = '\0';
+    buf->refs++;
+    mjs_string_buf_release(cell->buf);
+    cell->buf = buf;
+}
+
+/* Like `mjs_get_string()`, but the data is not necessarily NUL-terminated */
+static const char* mjs_string_peek(struct mjs* mjs, mjs_val_t* v, size_t* sizep) {
+    if((*v & MJS_TAG_MASK) == MJS_TAG_STRING_B) {
+        struct mjs_string_cell* cell = (struct mjs_string_cell*)get_ptr(*v);
+        *sizep = cell->len;
+        return cell->buf->data;
+    }
+    return mjs_get_string(mjs, v, sizep);
+}
+
+MJS_PRIVATE uint32_t mjs_string_hash(const char* s, size_t len) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)s[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+MJS_PRIVATE mjs_val_t mjs_mk_string_interned(struct mjs* mjs, const char* p, size_t len) {
+    mjs_val_t* slot;
+
+    /* Short strings are inlined, so there is nothing to share */
+    if(len <= 5 || len > MJS_STRING_INTERN_MAX_LEN) {
+        return mjs_mk_string(mjs, p, len, 1);
+    }
+
+    slot = &mjs->interned_strings[mjs_string_hash(p, len) & (MJS_STRING_INTERN_SIZE - 1)];
+    if(mjs_is_string(*slot)) {
+        size_t n;
+        const char* s = mjs_get_string(mjs, slot, &n);
+        if(n == len && memcmp(s, p, len) == 0) {
+            return *slot;
+        }
+    }
+
+    *slot = mjs_mk_string(mjs, p, len, 1);
+    return *slot;
 }
 
 mjs_val_t mjs_mk_string(struct mjs* mjs, const char* p, size_t len, int copy) {
@@ -163,6 +272,13 @@ const char* mjs_get_string(struct mjs* mjs, mjs_val_t* v, size_t* sizep) {
         } else {
             goto clean;
         }
+    } else if(tag == MJS_TAG_STRING_B) {
+        struct mjs_string_cell* cell = (struct mjs_string_cell*)get_ptr(*v);
+        if(cell->len != cell->buf->len) {
+            mjs_string_cell_detach(mjs, cell);
+        }
+        p = cell->buf->data;
+        size = cell->len;
     } else if(tag == MJS_TAG_STRING_F) {
         /*
      * short foreign strings on <=32-bit machines can be encoded in a compact
@@ -247,8 +363,8 @@ MJS_PRIVATE int s_cmp(struct mjs* mjs, mjs_val_t a, mjs_val_t b) {
     size_t a_len, b_len;
     const char *a_ptr, *b_ptr;
 
-    a_ptr = mjs_get_string(mjs, &a, &a_len);
-    b_ptr = mjs_get_string(mjs, &b, &b_len);
+    a_ptr = mjs_string_peek(mjs, &a, &a_len);
+    b_ptr = mjs_string_peek(mjs, &b, &b_len);
 
     if(a_len == b_len) {
         return memcmp(a_ptr, b_ptr, a_len);
@@ -262,14 +378,58 @@ MJS_PRIVATE int s_cmp(struct mjs* mjs, mjs_val_t a, mjs_val_t b) {
     }
 }
 
+/*
+ * Appends `b` to the buffer of `a` in place, unless something was appended to
+ * `a` already. So `s = s + x` in a loop copies every byte only once, not on
+ * each iteration.
+ */
+static mjs_val_t s_concat_builder(struct mjs* mjs, mjs_val_t a, mjs_val_t b) {
+    struct mjs_string_buf* buf = NULL;
+    size_t a_len, b_len;
+    const char *a_ptr, *b_ptr;
+
+    if((a & MJS_TAG_MASK) == MJS_TAG_STRING_B) {
+        struct mjs_string_cell* cell = (struct mjs_string_cell*)get_ptr(a);
+        if(cell->len == cell->buf->len) {
+            buf = cell->buf;
+        }
+    }
+
+    a_ptr = mjs_string_peek(mjs, &a, &a_len);
+    mjs_string_peek(mjs, &b, &b_len);
+
+    if(buf == NULL) {
+        buf = mjs_string_buf_alloc(mjs, (a_len + b_len) * 3 / 2);
+        memcpy(buf->data, a_ptr, a_len);
+        buf->len = a_len;
+    } else if(buf->len + b_len > buf->size) {
+        size_t size = (buf->len + b_len) * 3 / 2;
+        buf->data = realloc(buf->data, size + 1); //-V701
+        mjs_string_buf_account(mjs, size - buf->size);
+        buf->size = size;
+    }
+
+    /* Buffer may have moved, and `b` may be a part of it */
+    b_ptr = mjs_string_peek(mjs, &b, &b_len);
+    memcpy(buf->data + buf->len, b_ptr, b_len);
+    buf->len += b_len;
+    buf->data[buf->len] = '\0';
+
+    return mjs_mk_string_cell(mjs, buf);
+}
+
 MJS_PRIVATE mjs_val_t s_concat(struct mjs* mjs, mjs_val_t a, mjs_val_t b) {
     size_t a_len, b_len, res_len;
     const char *a_ptr, *b_ptr, *res_ptr;
     mjs_val_t res;
 
     /* Find out lengths of both srtings */
-    a_ptr = mjs_get_string(mjs, &a, &a_len);
-    b_ptr = mjs_get_string(mjs, &b, &b_len);
+    a_ptr = mjs_string_peek(mjs, &a, &a_len);
+    b_ptr = mjs_string_peek(mjs, &b, &b_len);
+
+    if(a_len + b_len >= MJS_STRING_BUILDER_MIN) {
+        return s_concat_builder(mjs, a, b);
+    }
 
     /* Create a placeholder string */
     res = mjs_mk_string(mjs, NULL, a_len + b_len, 1);
@@ -19,11 +19,43 @@ extern "C" {
  */
 #define _MJS_STRING_BUF_RESERVE 100
 
+/*
+ * Text of builder strings (MJS_TAG_STRING_B). Strings made by appending to
+ * each other share a single buffer, each of them is a prefix of it.
+ */
+struct mjs_string_buf {
+    char* data; /* NUL-terminated at `len` */
+    size_t len;
+    size_t size; /* Capacity, not counting NUL */
+    size_t refs; /* Number of cells pointing here */
+};
+
+/* Builder string, lives in the string arena */
+struct mjs_string_cell {
+    struct mjs_string_buf* buf;
+    size_t len;
+};
+
 MJS_PRIVATE unsigned long cstr_to_ulong(const char* s, size_t len, int* ok);
 MJS_PRIVATE mjs_err_t str_to_ulong(struct mjs* mjs, mjs_val_t v, int* ok, unsigned long* res);
 MJS_PRIVATE int s_cmp(struct mjs* mjs, mjs_val_t a, mjs_val_t b);
 MJS_PRIVATE mjs_val_t s_concat(struct mjs* mjs, mjs_val_t a, mjs_val_t b);
 
+/* FNV-1a hash of string contents */
+MJS_PRIVATE uint32_t mjs_string_hash(const char* s, size_t len);
+
+/*
+ * Like `mjs_mk_string()` with copy, but recently made strings of the same
+ * contents are reused instead of copied again. For property names and string
+ * literals, which are made on every execution.
+ */
+MJS_PRIVATE mjs_val_t mjs_mk_string_interned(struct mjs* mjs, const char* p, size_t len);
+
+/*
+ * String arena cell destructor: drops the reference to the text buffer
+ */
+MJS_PRIVATE void mjs_string_cell_destructor(struct mjs* mjs, void* cell);
+
 MJS_PRIVATE void embed_string(
     struct mbuf* m,
     size_t offset,
@@ -140,6 +140,8 @@ MJS_PRIVATE const char* opcodetostr(uint8_t opcode) {
         "BCODE_HDR",
         "ARGS",
         "FOR_IN_NEXT",
+        "GET_VAR",
+        "GET_MEMBER",
     };
     const char* name = "???";
     assert(ARRAY_SIZE(names) == OP_MAX);
@@ -182,7 +184,9 @@ MJS_PRIVATE size_t
         break;
     }
     case OP_PUSH_STR:
-    case OP_PUSH_DBL: {
+    case OP_PUSH_DBL:
+    case OP_GET_VAR:
+    case OP_GET_MEMBER: {
         cs_varint_decode(&code[i + 1], ~0, &n, &llen);
         print_cb(print_ctx, "%s\t[%.*s]", buf, (int)n, code + i + 1 + llen);
         i += llen + n;
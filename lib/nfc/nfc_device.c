@@ -323,6 +323,8 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
     bool loaded = false;
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    // Protocol loaders read optional fields with rewinds
+    flipper_format_set_key_index(ff, true);
 
     FuriString* temp_str;
     temp_str = furi_string_alloc();
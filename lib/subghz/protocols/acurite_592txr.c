@@ -60,6 +60,14 @@ typedef enum {
     Acurite_592TXRDecoderStepCheckDuration,
 } Acurite_592TXRDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_592txr_start = {
+    .timing = &ws_protocol_acurite_592txr_const,
+    .step_offset = offsetof(WSProtocolDecoderAcurite_592TXR, decoder.parser_step),
+    .level = true,
+    .te_mul = 3,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_acurite_592txr_decoder = {
     .alloc = ws_protocol_decoder_acurite_592txr_alloc,
     .free = ws_protocol_decoder_acurite_592txr_free,
@@ -73,6 +81,7 @@ const SubGhzProtocolDecoder ws_protocol_acurite_592txr_decoder = {
     .deserialize = ws_protocol_decoder_acurite_592txr_deserialize,
     .get_string = ws_protocol_decoder_acurite_592txr_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_acurite_592txr_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_592txr_encoder = {
@@ -57,6 +57,14 @@ typedef enum {
     Acurite_5n1DecoderStepCheckDuration,
 } Acurite_5n1DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_5n1_start = {
+    .timing = &ws_protocol_acurite_5n1_const,
+    .step_offset = offsetof(WSProtocolDecoderAcurite_5n1, decoder.parser_step),
+    .level = true,
+    .te_mul = 3,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_acurite_5n1_decoder = {
     .alloc = ws_protocol_decoder_acurite_5n1_alloc,
     .free = ws_protocol_decoder_acurite_5n1_free,
@@ -70,6 +78,7 @@ const SubGhzProtocolDecoder ws_protocol_acurite_5n1_decoder = {
     .deserialize = ws_protocol_decoder_acurite_5n1_deserialize,
     .get_string = ws_protocol_decoder_acurite_5n1_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_acurite_5n1_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_5n1_encoder = {
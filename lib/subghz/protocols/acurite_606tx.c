@@ -43,6 +43,14 @@ typedef enum {
     Acurite_606TXDecoderStepCheckDuration,
 } Acurite_606TXDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_606tx_start = {
+    .timing = &ws_protocol_acurite_606tx_const,
+    .step_offset = offsetof(WSProtocolDecoderAcurite_606TX, decoder.parser_step),
+    .level = false,
+    .te_mul = 17,
+    .delta_mul = 8,
+};
+
 const SubGhzProtocolDecoder ws_protocol_acurite_606tx_decoder = {
     .alloc = ws_protocol_decoder_acurite_606tx_alloc,
     .free = ws_protocol_decoder_acurite_606tx_free,
@@ -56,6 +64,7 @@ const SubGhzProtocolDecoder ws_protocol_acurite_606tx_decoder = {
     .deserialize = ws_protocol_decoder_acurite_606tx_deserialize,
     .get_string = ws_protocol_decoder_acurite_606tx_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_acurite_606tx_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_606tx_encoder = {
@@ -44,6 +44,14 @@ typedef enum {
     Acurite_609TXCDecoderStepCheckDuration,
 } Acurite_609TXCDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_609txc_start = {
+    .timing = &ws_protocol_acurite_609txc_const,
+    .step_offset = offsetof(WSProtocolDecoderAcurite_609TXC, decoder.parser_step),
+    .level = false,
+    .te_mul = 17,
+    .delta_mul = 8,
+};
+
 const SubGhzProtocolDecoder ws_protocol_acurite_609txc_decoder = {
     .alloc = ws_protocol_decoder_acurite_609txc_alloc,
     .free = ws_protocol_decoder_acurite_609txc_free,
@@ -57,6 +65,7 @@ const SubGhzProtocolDecoder ws_protocol_acurite_609txc_decoder = {
     .deserialize = ws_protocol_decoder_acurite_609txc_deserialize,
     .get_string = ws_protocol_decoder_acurite_609txc_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_acurite_609txc_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_609txc_encoder = {
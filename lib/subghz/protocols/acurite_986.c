@@ -50,6 +50,15 @@ typedef enum {
     Acurite_986DecoderStepCheckDuration,
 } Acurite_986DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_986_start = {
+    .timing = &ws_protocol_acurite_986_const,
+    .step_offset = offsetof(WSProtocolDecoderAcurite_986, decoder.parser_step),
+    .level = false,
+    .te_long = true,
+    .te_mul = 1,
+    .delta_mul = 15,
+};
+
 const SubGhzProtocolDecoder ws_protocol_acurite_986_decoder = {
     .alloc = ws_protocol_decoder_acurite_986_alloc,
     .free = ws_protocol_decoder_acurite_986_free,
@@ -63,6 +72,7 @@ const SubGhzProtocolDecoder ws_protocol_acurite_986_decoder = {
     .deserialize = ws_protocol_decoder_acurite_986_deserialize,
     .get_string = ws_protocol_decoder_acurite_986_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_acurite_986_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_986_encoder = {
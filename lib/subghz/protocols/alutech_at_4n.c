@@ -47,6 +47,14 @@ typedef enum {
     Alutech_at_4nDecoderStepCheckDuration,
 } Alutech_at_4nDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_alutech_at_4n_start = {
+    .timing = &subghz_protocol_alutech_at_4n_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderAlutech_at_4n, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .alloc = subghz_protocol_decoder_alutech_at_4n_alloc,
     .free = subghz_protocol_decoder_alutech_at_4n_free,
@@ -60,6 +68,7 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_alutech_at_4n_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
@@ -42,6 +42,14 @@ typedef enum {
     AnsonicDecoderStepCheckDuration,
 } AnsonicDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_ansonic_start = {
+    .timing = &subghz_protocol_ansonic_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderAnsonic, decoder.parser_step),
+    .level = false,
+    .te_mul = 35,
+    .delta_mul = 35,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .alloc = subghz_protocol_decoder_ansonic_alloc,
     .free = subghz_protocol_decoder_ansonic_free,
@@ -55,6 +63,7 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_ansonic_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
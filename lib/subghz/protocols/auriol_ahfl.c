@@ -55,6 +55,14 @@ typedef enum {
     auriol_AHFLDecoderStepCheckDuration,
 } auriol_AHFLDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_auriol_ahfl_start = {
+    .timing = &ws_protocol_auriol_ahfl_const,
+    .step_offset = offsetof(WSProtocolDecoderAuriol_AHFL, decoder.parser_step),
+    .level = false,
+    .te_mul = 18,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_auriol_ahfl_decoder = {
     .alloc = ws_protocol_decoder_auriol_ahfl_alloc,
     .free = ws_protocol_decoder_auriol_ahfl_free,
@@ -68,6 +76,7 @@ const SubGhzProtocolDecoder ws_protocol_auriol_ahfl_decoder = {
     .deserialize = ws_protocol_decoder_auriol_ahfl_deserialize,
     .get_string = ws_protocol_decoder_auriol_ahfl_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_auriol_ahfl_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_auriol_ahfl_encoder = {
@@ -54,6 +54,14 @@ typedef enum {
     auriol_THDecoderStepCheckDuration,
 } auriol_THDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_auriol_th_start = {
+    .timing = &ws_protocol_auriol_th_const,
+    .step_offset = offsetof(WSProtocolDecoderAuriol_TH, decoder.parser_step),
+    .level = false,
+    .te_mul = 8,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_auriol_th_decoder = {
     .alloc = ws_protocol_decoder_auriol_th_alloc,
     .free = ws_protocol_decoder_auriol_th_free,
@@ -67,6 +75,7 @@ const SubGhzProtocolDecoder ws_protocol_auriol_th_decoder = {
     .deserialize = ws_protocol_decoder_auriol_th_deserialize,
     .get_string = ws_protocol_decoder_auriol_th_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_auriol_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_auriol_th_encoder = {
@@ -11,6 +11,64 @@ void subghz_protocol_decoder_base_set_decoder_callback(
     decoder_base->context = context;
 }
 
+bool subghz_protocol_decoder_start_get_window(
+    const SubGhzProtocolDecoderStart* start,
+    uint32_t* min,
+    uint32_t* range) {
+    furi_check(start);
+    furi_check(min);
+    furi_check(range);
+
+    uint32_t te = start->te_long ? start->timing->te_long : start->timing->te_short;
+    uint32_t center = te * start->te_mul;
+    uint32_t delta = start->timing->te_delta * start->delta_mul;
+    if(!delta) return false;
+
+    // DURATION_DIFF(duration, center) < delta
+    *min = center >= delta ? center - delta + 1 : 0;
+    *range = center + delta - 1 - *min;
+    return true;
+}
+
+size_t subghz_protocol_decoder_base_feed_batch(
+    SubGhzProtocolDecoderBase* decoder_base,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_check(decoder_base);
+    furi_check(pairs || !pairs_count);
+
+    decoder_base->batch_stop = false;
+
+    const SubGhzProtocolDecoder* decoder = decoder_base->protocol->decoder;
+    if(decoder->feed_batch) {
+        return decoder->feed_batch(decoder_base, pairs, pairs_count);
+    }
+
+    const uint32_t* step = NULL;
+    bool start_level = false;
+    uint32_t start_min = 0;
+    uint32_t start_range = 0;
+    if(decoder->start &&
+       subghz_protocol_decoder_start_get_window(decoder->start, &start_min, &start_range)) {
+        step = (const uint32_t*)((const uint8_t*)decoder_base + decoder->start->step_offset);
+        start_level = decoder->start->level;
+    }
+
+    for(size_t i = 0; i < pairs_count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        if(step && *step == 0 &&
+           (start_level != level || duration - start_min > start_range)) {
+            continue;
+        }
+        decoder_base->feed_index = i;
+        decoder->feed(decoder_base, level, duration);
+        if(decoder_base->batch_stop) return i + 1;
+    }
+
+    return pairs_count;
+}
+
 bool subghz_protocol_decoder_base_get_string(
     SubGhzProtocolDecoderBase* decoder_base,
     FuriString* output) {
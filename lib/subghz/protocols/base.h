@@ -22,6 +22,9 @@ struct SubGhzProtocolDecoderBase {
     // Callback section
     SubGhzProtocolDecoderBaseRxCallback callback;
     void* context;
+    // Batch section, pair fed by feed_batch and stop request from rx callback
+    size_t feed_index;
+    bool batch_stop;
 };
 
 /**
@@ -35,6 +38,35 @@ void subghz_protocol_decoder_base_set_decoder_callback(
     SubGhzProtocolDecoderBaseRxCallback callback,
     void* context);
 
+/**
+ * Feed block of pulses to decoder, uses decoder feed_batch if present.
+ * Without it pulses are fed one by one, skipping ones outside of start window
+ * while decoder is in reset step.
+ * Index of pair given to decoder is kept in feed_index, stops right after the pair
+ * on which rx callback set batch_stop.
+ * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
+ * @param pairs Levels and durations, no reset markers
+ * @param pairs_count Number of pairs
+ * @return Number of pairs consumed
+ */
+size_t subghz_protocol_decoder_base_feed_batch(
+    SubGhzProtocolDecoderBase* decoder_base,
+    const LevelDuration* pairs,
+    size_t pairs_count);
+
+/**
+ * Get pulse duration window that can move decoder out of reset step.
+ * Pulse of start->level matches when `duration - min <= range`.
+ * @param start Decoder start window, SubGhzProtocolDecoderStart
+ * @param min Minimal duration, us
+ * @param range Window width minus one, us
+ * @return false if window is empty
+ */
+bool subghz_protocol_decoder_start_get_window(
+    const SubGhzProtocolDecoderStart* start,
+    uint32_t* min,
+    uint32_t* range);
+
 /**
  * Getting a textual representation of the received data.
  * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
@@ -52,6 +52,14 @@ typedef enum {
     BETTDecoderStepCheckDuration,
 } BETTDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_bett_start = {
+    .timing = &subghz_protocol_bett_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderBETT, decoder.parser_step),
+    .level = false,
+    .te_mul = 44,
+    .delta_mul = 15,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .alloc = subghz_protocol_decoder_bett_alloc,
     .free = subghz_protocol_decoder_bett_free,
@@ -65,6 +73,7 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_bett_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
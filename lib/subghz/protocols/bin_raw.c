@@ -102,6 +102,7 @@ const SubGhzProtocolDecoder subghz_protocol_bin_raw_decoder = {
     .deserialize = subghz_protocol_decoder_bin_raw_deserialize,
     .get_string = subghz_protocol_decoder_bin_raw_get_string,
     .get_string_brief = NULL,
+    .feed_batch = subghz_protocol_decoder_bin_raw_feed_batch,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bin_raw_encoder = {
@@ -395,6 +396,32 @@ void subghz_protocol_decoder_bin_raw_feed(void* context, bool level, uint32_t du
     }
 }
 
+size_t subghz_protocol_decoder_bin_raw_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBinRAW* instance = context;
+
+    // Only stores pairs, decoding and rx callback happen outside of feed
+    if(instance->decoder.parser_step != BinRAWDecoderStepWrite) return pairs_count;
+
+    size_t count = MIN(pairs_count, BIN_RAW_BUF_RAW_SIZE - instance->data_raw_ind);
+    int32_t* data_raw = &instance->data_raw[instance->data_raw_ind];
+    for(size_t i = 0; i < count; i++) {
+        int32_t duration = level_duration_get_duration(pairs[i]);
+        data_raw[i] = level_duration_get_level(pairs[i]) ? duration : -duration;
+    }
+    instance->data_raw_ind += count;
+
+    // Same as feed: pair that does not fit marks buffer as full
+    if(pairs_count > count) {
+        instance->decoder.parser_step = BinRAWDecoderStepBufFull;
+    }
+
+    return pairs_count;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzProtocolDecoderBinRAW* instance
@@ -74,6 +74,18 @@ void subghz_protocol_decoder_bin_raw_reset(void* context);
  */
 void subghz_protocol_decoder_bin_raw_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * @param context Pointer to a SubGhzProtocolDecoderBinRAW instance
+ * @param pairs Levels and durations
+ * @param pairs_count Number of pairs
+ * @return Number of pairs consumed
+ */
+size_t subghz_protocol_decoder_bin_raw_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderBinRAW instance
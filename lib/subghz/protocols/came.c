@@ -49,6 +49,14 @@ typedef enum {
     CameDecoderStepCheckDuration,
 } CameDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_start = {
+    .timing = &subghz_protocol_came_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderCame, decoder.parser_step),
+    .level = false,
+    .te_mul = 56,
+    .delta_mul = 47,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .alloc = subghz_protocol_decoder_came_alloc,
     .free = subghz_protocol_decoder_came_free,
@@ -62,6 +70,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_came_start,
+    .feed_batch = subghz_protocol_decoder_came_feed_batch,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -313,6 +323,30 @@ void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t durat
     }
 }
 
+size_t subghz_protocol_decoder_came_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+
+    for(size_t i = 0; i < pairs_count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        // Most of the time decoder waits for header, check it here without a call
+        if(instance->decoder.parser_step == CameDecoderStepReset &&
+           (level || DURATION_DIFF(duration, subghz_protocol_came_const.te_short * 56) >=
+                     subghz_protocol_came_const.te_delta * 47)) {
+            continue;
+        }
+        instance->base.feed_index = i;
+        subghz_protocol_decoder_came_feed(instance, level, duration);
+        if(instance->base.batch_stop) return i + 1;
+    }
+
+    return pairs_count;
+}
+
 uint32_t subghz_protocol_decoder_came_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
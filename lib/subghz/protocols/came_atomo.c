@@ -39,6 +39,15 @@ typedef enum {
     CameAtomoDecoderStepDecoderData,
 } CameAtomoDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_atomo_start = {
+    .timing = &subghz_protocol_came_atomo_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderCameAtomo, decoder.parser_step),
+    .level = false,
+    .te_long = true,
+    .te_mul = 60,
+    .delta_mul = 40,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .alloc = subghz_protocol_decoder_came_atomo_alloc,
     .free = subghz_protocol_decoder_came_atomo_free,
@@ -52,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .deserialize = subghz_protocol_decoder_came_atomo_deserialize,
     .get_string = subghz_protocol_decoder_came_atomo_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_came_atomo_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder = {
@@ -70,6 +70,15 @@ typedef enum {
     CameTweeDecoderStepDecoderData,
 } CameTweeDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_twee_start = {
+    .timing = &subghz_protocol_came_twee_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderCameTwee, decoder.parser_step),
+    .level = false,
+    .te_long = true,
+    .te_mul = 51,
+    .delta_mul = 20,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .alloc = subghz_protocol_decoder_came_twee_alloc,
     .free = subghz_protocol_decoder_came_twee_free,
@@ -83,6 +92,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_came_twee_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
@@ -66,6 +66,14 @@ typedef enum {
     Chamb_CodeDecoderStepCheckDuration,
 } Chamb_CodeDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_chamb_code_start = {
+    .timing = &subghz_protocol_chamb_code_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderChamb_Code, decoder.parser_step),
+    .level = false,
+    .te_mul = 39,
+    .delta_mul = 20,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .alloc = subghz_protocol_decoder_chamb_code_alloc,
     .free = subghz_protocol_decoder_chamb_code_free,
@@ -79,6 +87,7 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .deserialize = subghz_protocol_decoder_chamb_code_deserialize,
     .get_string = subghz_protocol_decoder_chamb_code_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_chamb_code_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder = {
@@ -51,6 +51,14 @@ typedef enum {
     ClemsaDecoderStepCheckDuration,
 } ClemsaDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_clemsa_start = {
+    .timing = &subghz_protocol_clemsa_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderClemsa, decoder.parser_step),
+    .level = false,
+    .te_mul = 51,
+    .delta_mul = 25,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .alloc = subghz_protocol_decoder_clemsa_alloc,
     .free = subghz_protocol_decoder_clemsa_free,
@@ -64,6 +72,7 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_clemsa_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
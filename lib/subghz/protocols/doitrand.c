@@ -43,6 +43,14 @@ typedef enum {
     DoitrandDecoderStepCheckDuration,
 } DoitrandDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_doitrand_start = {
+    .timing = &subghz_protocol_doitrand_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderDoitrand, decoder.parser_step),
+    .level = false,
+    .te_mul = 62,
+    .delta_mul = 30,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .alloc = subghz_protocol_decoder_doitrand_alloc,
     .free = subghz_protocol_decoder_doitrand_free,
@@ -56,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_doitrand_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
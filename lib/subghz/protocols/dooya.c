@@ -37,6 +37,15 @@ typedef enum {
     DooyaDecoderStepCheckDuration,
 } DooyaDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_dooya_start = {
+    .timing = &subghz_protocol_dooya_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderDooya, decoder.parser_step),
+    .level = false,
+    .te_long = true,
+    .te_mul = 12,
+    .delta_mul = 20,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .alloc = subghz_protocol_decoder_dooya_alloc,
     .free = subghz_protocol_decoder_dooya_free,
@@ -50,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_dooya_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
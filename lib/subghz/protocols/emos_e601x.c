@@ -55,6 +55,14 @@ typedef enum {
     EmosE601xDecoderStepCheckDuration,
 } EmosE601xDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_emose601x_start = {
+    .timing = &ws_protocol_emose601x_const,
+    .step_offset = offsetof(WSProtocolDecoderEmosE601x, decoder.parser_step),
+    .level = true,
+    .te_mul = 7,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_emose601x_decoder = {
     .alloc = ws_protocol_decoder_emose601x_alloc,
     .free = ws_protocol_decoder_emose601x_free,
@@ -68,6 +76,7 @@ const SubGhzProtocolDecoder ws_protocol_emose601x_decoder = {
     .deserialize = ws_protocol_decoder_emose601x_deserialize,
     .get_string = ws_protocol_decoder_emose601x_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_emose601x_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_emose601x_encoder = {
@@ -1,5 +1,6 @@
 #include "faac_slh.h"
 #include "../subghz_keystore.h"
+#include "../subghz_keystore_i.h"
 #include <m-array.h>
 #include "keeloq_common.h"
 #include "../blocks/const.h"
@@ -58,6 +59,15 @@ typedef enum {
     FaacSLHDecoderStepCheckDuration,
 } FaacSLHDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_faac_slh_start = {
+    .timing = &subghz_protocol_faac_slh_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderFaacSLH, decoder.parser_step),
+    .level = true,
+    .te_long = true,
+    .te_mul = 2,
+    .delta_mul = 3,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .alloc = subghz_protocol_decoder_faac_slh_alloc,
     .free = subghz_protocol_decoder_faac_slh_free,
@@ -71,6 +81,7 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_faac_slh_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
@@ -553,18 +564,17 @@ static void subghz_protocol_faac_slh_check_remote_controller(
         faac_prog_mode = false;
     }
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_FAAC:
-                // FAAC Learning
-                man = subghz_protocol_keeloq_common_faac_learning(
-                    instance->seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
-                *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                break;
-            }
-        }
+    // Decrypt is not validated, so the last FAAC learning key in keystore is the one used
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(keystore);
+    size_t faac_end = index->type_offset[KEELOQ_LEARNING_FAAC + 1];
+    if(faac_end > index->type_offset[KEELOQ_LEARNING_FAAC]) {
+        const SubGhzKey* manufacture_code = SubGhzKeyArray_cget(
+            *subghz_keystore_get_data(keystore), index->type_keys[faac_end - 1]);
+        // FAAC Learning
+        man = subghz_protocol_keeloq_common_faac_learning(instance->seed, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
+        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+    }
     instance->cnt = decrypt & 0xFFFFF;
     // Backup counter in case when we need to use programming mode
     if(code_fix != 0x0) {
@@ -36,6 +36,14 @@ typedef enum {
     GateTXDecoderStepCheckDuration,
 } GateTXDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_gate_tx_start = {
+    .timing = &subghz_protocol_gate_tx_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderGateTx, decoder.parser_step),
+    .level = false,
+    .te_mul = 47,
+    .delta_mul = 47,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .alloc = subghz_protocol_decoder_gate_tx_alloc,
     .free = subghz_protocol_decoder_gate_tx_free,
@@ -49,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .deserialize = subghz_protocol_decoder_gate_tx_deserialize,
     .get_string = subghz_protocol_decoder_gate_tx_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_gate_tx_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder = {
@@ -57,6 +57,14 @@ typedef enum {
     GT_WT02DecoderStepCheckDuration,
 } GT_WT02DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_gt_wt_02_start = {
+    .timing = &ws_protocol_gt_wt_02_const,
+    .step_offset = offsetof(WSProtocolDecoderGT_WT02, decoder.parser_step),
+    .level = false,
+    .te_mul = 18,
+    .delta_mul = 8,
+};
+
 const SubGhzProtocolDecoder ws_protocol_gt_wt_02_decoder = {
     .alloc = ws_protocol_decoder_gt_wt_02_alloc,
     .free = ws_protocol_decoder_gt_wt_02_free,
@@ -70,6 +78,7 @@ const SubGhzProtocolDecoder ws_protocol_gt_wt_02_decoder = {
     .deserialize = ws_protocol_decoder_gt_wt_02_deserialize,
     .get_string = ws_protocol_decoder_gt_wt_02_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_gt_wt_02_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_gt_wt_02_encoder = {
@@ -83,6 +83,14 @@ typedef enum {
     GT_WT03DecoderStepCheckDuration,
 } GT_WT03DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_gt_wt_03_start = {
+    .timing = &ws_protocol_gt_wt_03_const,
+    .step_offset = offsetof(WSProtocolDecoderGT_WT03, decoder.parser_step),
+    .level = true,
+    .te_mul = 3,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_gt_wt_03_decoder = {
     .alloc = ws_protocol_decoder_gt_wt_03_alloc,
     .free = ws_protocol_decoder_gt_wt_03_free,
@@ -96,6 +104,7 @@ const SubGhzProtocolDecoder ws_protocol_gt_wt_03_decoder = {
     .deserialize = ws_protocol_decoder_gt_wt_03_deserialize,
     .get_string = ws_protocol_decoder_gt_wt_03_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_gt_wt_03_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_gt_wt_03_encoder = {
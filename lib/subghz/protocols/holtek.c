@@ -46,6 +46,14 @@ typedef enum {
     HoltekDecoderStepCheckDuration,
 } HoltekDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_holtek_start = {
+    .timing = &subghz_protocol_holtek_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderHoltek, decoder.parser_step),
+    .level = false,
+    .te_mul = 36,
+    .delta_mul = 36,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .alloc = subghz_protocol_decoder_holtek_alloc,
     .free = subghz_protocol_decoder_holtek_free,
@@ -59,6 +67,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_holtek_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
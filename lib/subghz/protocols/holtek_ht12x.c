@@ -53,6 +53,14 @@ typedef enum {
     Holtek_HT12XDecoderStepCheckDuration,
 } Holtek_HT12XDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_holtek_th12x_start = {
+    .timing = &subghz_protocol_holtek_th12x_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderHoltek_HT12X, decoder.parser_step),
+    .level = false,
+    .te_mul = 36,
+    .delta_mul = 36,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .alloc = subghz_protocol_decoder_holtek_th12x_alloc,
     .free = subghz_protocol_decoder_holtek_th12x_free,
@@ -66,6 +74,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_holtek_th12x_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
@@ -47,6 +47,14 @@ typedef enum {
     Honeywell_WDBDecoderStepCheckDuration,
 } Honeywell_WDBDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_honeywell_wdb_start = {
+    .timing = &subghz_protocol_honeywell_wdb_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderHoneywell_WDB, decoder.parser_step),
+    .level = false,
+    .te_mul = 3,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .alloc = subghz_protocol_decoder_honeywell_wdb_alloc,
     .free = subghz_protocol_decoder_honeywell_wdb_free,
@@ -60,6 +68,7 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .deserialize = subghz_protocol_decoder_honeywell_wdb_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_wdb_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_honeywell_wdb_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder = {
@@ -40,6 +40,14 @@ typedef enum {
     HormannDecoderStepCheckDuration,
 } HormannDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_hormann_start = {
+    .timing = &subghz_protocol_hormann_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderHormann, decoder.parser_step),
+    .level = true,
+    .te_mul = 24,
+    .delta_mul = 24,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .alloc = subghz_protocol_decoder_hormann_alloc,
     .free = subghz_protocol_decoder_hormann_free,
@@ -53,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_hormann_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
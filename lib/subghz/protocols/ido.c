@@ -36,6 +36,14 @@ typedef enum {
     IDoDecoderStepCheckDuration,
 } IDoDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_ido_start = {
+    .timing = &subghz_protocol_ido_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderIDo, decoder.parser_step),
+    .level = true,
+    .te_mul = 10,
+    .delta_mul = 5,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .alloc = subghz_protocol_decoder_ido_alloc,
     .free = subghz_protocol_decoder_ido_free,
@@ -49,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .serialize = subghz_protocol_decoder_ido_serialize,
     .get_string = subghz_protocol_decoder_ido_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_ido_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ido_encoder = {
@@ -68,6 +68,14 @@ typedef enum {
     InfactoryDecoderStepCheckDuration,
 } InfactoryDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_infactory_start = {
+    .timing = &ws_protocol_infactory_const,
+    .step_offset = offsetof(WSProtocolDecoderInfactory, decoder.parser_step),
+    .level = true,
+    .te_mul = 2,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_infactory_decoder = {
     .alloc = ws_protocol_decoder_infactory_alloc,
     .free = ws_protocol_decoder_infactory_free,
@@ -81,6 +89,7 @@ const SubGhzProtocolDecoder ws_protocol_infactory_decoder = {
     .deserialize = ws_protocol_decoder_infactory_deserialize,
     .get_string = ws_protocol_decoder_infactory_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_infactory_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_infactory_encoder = {
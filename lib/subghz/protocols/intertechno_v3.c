@@ -45,6 +45,14 @@ typedef enum {
     IntertechnoV3DecoderStepEndDuration,
 } IntertechnoV3DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_intertechno_v3_start = {
+    .timing = &subghz_protocol_intertechno_v3_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderIntertechno_V3, decoder.parser_step),
+    .level = false,
+    .te_mul = 37,
+    .delta_mul = 15,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .alloc = subghz_protocol_decoder_intertechno_v3_alloc,
     .free = subghz_protocol_decoder_intertechno_v3_free,
@@ -58,6 +66,7 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .deserialize = subghz_protocol_decoder_intertechno_v3_deserialize,
     .get_string = subghz_protocol_decoder_intertechno_v3_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_intertechno_v3_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder = {
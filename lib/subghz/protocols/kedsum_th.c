@@ -54,6 +54,14 @@ typedef enum {
     KedsumTHDecoderStepCheckDuration,
 } KedsumTHDecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_kedsum_th_start = {
+    .timing = &ws_protocol_kedsum_th_const,
+    .step_offset = offsetof(WSProtocolDecoderKedsumTH, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_kedsum_th_decoder = {
     .alloc = ws_protocol_decoder_kedsum_th_alloc,
     .free = ws_protocol_decoder_kedsum_th_free,
@@ -67,6 +75,7 @@ const SubGhzProtocolDecoder ws_protocol_kedsum_th_decoder = {
     .deserialize = ws_protocol_decoder_kedsum_th_deserialize,
     .get_string = ws_protocol_decoder_kedsum_th_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_kedsum_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_kedsum_th_encoder = {
@@ -54,6 +54,14 @@ typedef enum {
     KeeloqDecoderStepCheckDuration,
 } KeeloqDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_keeloq_start = {
+    .timing = &subghz_protocol_keeloq_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderKeeloq, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .alloc = subghz_protocol_decoder_keeloq_alloc,
     .free = subghz_protocol_decoder_keeloq_free,
@@ -67,6 +75,8 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_keeloq_start,
+    .feed_batch = subghz_protocol_decoder_keeloq_feed_batch,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -725,6 +735,30 @@ void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t dur
     }
 }
 
+size_t subghz_protocol_decoder_keeloq_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+
+    for(size_t i = 0; i < pairs_count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        // Most of the time decoder waits for header, check it here without a call
+        if(instance->decoder.parser_step == KeeloqDecoderStepReset &&
+           (!level || DURATION_DIFF(duration, subghz_protocol_keeloq_const.te_short) >=
+                      subghz_protocol_keeloq_const.te_delta)) {
+            continue;
+        }
+        instance->base.feed_index = i;
+        subghz_protocol_decoder_keeloq_feed(instance, level, duration);
+        if(instance->base.batch_stop) return i + 1;
+    }
+
+    return pairs_count;
+}
+
 /**
  * Validation of decrypt data.
  * @param instance Pointer to a SubGhzBlockGeneric instance
@@ -774,8 +808,157 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
+/** Manufacture key derivations tried for keys of KEELOQ_LEARNING_UNKNOWN type */
+static const SubGhzKeystoreAttempt subghz_protocol_keeloq_unknown_attempts[] = {
+    {KEELOQ_LEARNING_SIMPLE, false},
+    {KEELOQ_LEARNING_SIMPLE, true},
+    {KEELOQ_LEARNING_NORMAL, false},
+    {KEELOQ_LEARNING_NORMAL, true},
+    {KEELOQ_LEARNING_SECURE, false},
+    {KEELOQ_LEARNING_SECURE, true},
+    {KEELOQ_LEARNING_MAGIC_XOR_TYPE_1, false},
+    {KEELOQ_LEARNING_MAGIC_XOR_TYPE_1, true},
+};
+
+/** Full search order: single decrypt learning types first, so that their matches
+ * cut off the search in groups needing more decrypts per key
+ */
+static const uint8_t subghz_protocol_keeloq_search_order[] = {
+    KEELOQ_LEARNING_SIMPLE,
+    KEELOQ_LEARNING_MAGIC_XOR_TYPE_1,
+    KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1,
+    KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2,
+    KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3,
+    KEELOQ_LEARNING_NORMAL,
+    KEELOQ_LEARNING_SECURE,
+    KEELOQ_LEARNING_UNKNOWN,
+};
+
+static uint64_t subghz_protocol_keeloq_derive_man(
+    uint8_t learning,
+    uint32_t fix,
+    uint32_t seed,
+    uint64_t key) {
+    switch(learning) {
+    case KEELOQ_LEARNING_NORMAL:
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        return subghz_protocol_keeloq_common_normal_learning(fix, key);
+    case KEELOQ_LEARNING_SECURE:
+        return subghz_protocol_keeloq_common_secure_learning(fix, seed, key);
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        return subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        return subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        return subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        return subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, key);
+    default:
+        return key;
+    }
+}
+
+static bool subghz_protocol_keeloq_check_decrypted(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t decrypt,
+    bool centurion) {
+    // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
+    // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
+    // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
+
+    if(centurion) {
+        return subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn);
+    } else {
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    }
+}
+
+static bool subghz_protocol_keeloq_check_man(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    uint64_t man,
+    bool centurion) {
+    uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+    return subghz_protocol_keeloq_check_decrypted(instance, fix, decrypt, centurion);
+}
+
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    const SubGhzKeystoreIndex* index;
+    uint32_t fix;
+    uint16_t centurion_id;
+    uint8_t type;
+} SubGhzProtocolKeeloqSearch;
+
+static bool
+    subghz_protocol_keeloq_search_callback(void* context, uint32_t decrypt, uint16_t key_index) {
+    SubGhzProtocolKeeloqSearch* search = context;
+    bool centurion = search->type == KEELOQ_LEARNING_NORMAL &&
+                     search->index->mf_id[key_index] == search->centurion_id;
+    return subghz_protocol_keeloq_check_decrypted(
+        search->instance, search->fix, decrypt, centurion);
+}
+
+/** 
+ * Checking the accepted code against one manufacture key, all derivations of key learning type
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param key Pointer to a SubGhzKey instance
+ * @param centurion Key belongs to Centurion, it uses own discriminator
+ * @param match Learning type and derived key are stored here on success
+ * @return true if key matches
+ */
+static bool subghz_protocol_keeloq_check_key(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    const SubGhzKey* key,
+    bool centurion,
+    SubGhzKeystoreCacheEntry* match) {
+    if(key->type == KEELOQ_LEARNING_UNKNOWN) {
+        for(size_t i = 0; i < COUNT_OF(subghz_protocol_keeloq_unknown_attempts); i++) {
+            const SubGhzKeystoreAttempt* attempt = &subghz_protocol_keeloq_unknown_attempts[i];
+            uint64_t man = subghz_protocol_keeloq_derive_man(
+                attempt->learning,
+                fix,
+                instance->seed,
+                attempt->mirrored ? __builtin_bswap64(key->key) : key->key);
+            if(subghz_protocol_keeloq_check_man(instance, fix, hop, man, false)) {
+                match->learning = attempt->learning;
+                match->mirrored = attempt->mirrored;
+                match->man = man;
+                return true;
+            }
+        }
+    } else if(
+        key->type <= KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 && key->type != KEELOQ_LEARNING_FAAC) {
+        uint64_t man =
+            subghz_protocol_keeloq_derive_man(key->type, fix, instance->seed, key->key);
+        if(subghz_protocol_keeloq_check_man(
+               instance, fix, hop, man, centurion && key->type == KEELOQ_LEARNING_NORMAL)) {
+            match->learning = key->type;
+            match->mirrored = false;
+            match->man = man;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /** 
  * Checking the accepted code against the database manafacture key
+ *
+ * Remotes seen recently are checked with remembered key first (one decrypt), remotes which
+ * matched nothing are not searched again. Otherwise all keys of manufacture are checked, or
+ * whole keystore by learning type with batch decrypt if manufacture is not known yet. First
+ * matching key in keystore order wins.
+ *
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
@@ -789,15 +972,6 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     uint32_t hop,
     SubGhzKeystore* keystore,
     const char** manufacture_name) {
-    // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
-    // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
-    // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
-
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
-    bool mf_not_set = false;
     // TODO:
     // if(mfname == 0x0) {
     //     mfname = "";
@@ -807,189 +981,99 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
 
     if(strcmp(mfname, "Unknown") == 0) {
         return 1;
-    } else if(strcmp(mfname, "") == 0) {
-        mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0) {
-                        if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    } else {
-                        if(subghz_protocol_keeloq_check_decrypt(
-                               instance, decrypt, btn, end_serial)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    }
-                    break;
-                case KEELOQ_LEARNING_SECURE:
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                    man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                    man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Secure Learning
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Magic xor type1 learning
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(keystore);
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    bool mf_not_set = (mfname[0] == '\0');
+    uint16_t mf_id = mf_not_set ? SUBGHZ_KEYSTORE_INDEX_NONE :
+                                  subghz_keystore_get_manufacture_id(keystore, mfname);
+    uint16_t centurion_id = subghz_keystore_get_manufacture_id(keystore, "Centurion");
+
+    SubGhzKeystoreCacheEntry match = {
+        .fix = fix,
+        .seed = instance->seed,
+        .key_index = SUBGHZ_KEYSTORE_INDEX_NONE,
+    };
+
+    const SubGhzKeystoreCacheEntry* cached =
+        subghz_keystore_cache_find(keystore, fix, instance->seed);
+    // Nothing in keystore matched this remote before
+    bool known_miss = cached && cached->key_index == SUBGHZ_KEYSTORE_INDEX_NONE;
+
+    if(cached && !known_miss && (mf_not_set || index->mf_id[cached->key_index] == mf_id)) {
+        const SubGhzKey* key = SubGhzKeyArray_cget(*keys, cached->key_index);
+        uint64_t man = cached->man;
+        if(cached->learning >= KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1) {
+            // Derived from whole fix part, button included
+            man = subghz_protocol_keeloq_derive_man(
+                cached->learning,
+                fix,
+                instance->seed,
+                cached->mirrored ? __builtin_bswap64(key->key) : key->key);
+        }
+        bool centurion = key->type == KEELOQ_LEARNING_NORMAL &&
+                         index->mf_id[cached->key_index] == centurion_id;
+        if(subghz_protocol_keeloq_check_man(instance, fix, hop, man, centurion)) {
+            match = *cached;
+            match.fix = fix;
+            match.man = man;
+        }
+    }
 
+    if(match.key_index == SUBGHZ_KEYSTORE_INDEX_NONE && !known_miss) {
+        if(mf_not_set) {
+            SubGhzProtocolKeeloqSearch search = {
+                .instance = instance,
+                .index = index,
+                .fix = fix,
+                .centurion_id = centurion_id,
+            };
+            for(size_t i = 0; i < COUNT_OF(subghz_protocol_keeloq_search_order); i++) {
+                search.type = subghz_protocol_keeloq_search_order[i];
+                SubGhzKeystoreAttempt attempt = {.learning = search.type, .mirrored = false};
+                bool unknown = search.type == KEELOQ_LEARNING_UNKNOWN;
+                subghz_keystore_search_type(
+                    keystore,
+                    search.type,
+                    unknown ? subghz_protocol_keeloq_unknown_attempts : &attempt,
+                    unknown ? COUNT_OF(subghz_protocol_keeloq_unknown_attempts) : 1,
+                    fix,
+                    instance->seed,
+                    hop,
+                    subghz_protocol_keeloq_search_callback,
+                    &search,
+                    &match);
+            }
+        } else if(mf_id != SUBGHZ_KEYSTORE_INDEX_NONE) {
+            for(size_t i = index->mf_offset[mf_id]; i < index->mf_offset[mf_id + 1]; i++) {
+                uint16_t key_index = index->mf_keys[i];
+                if(subghz_protocol_keeloq_check_key(
+                       instance,
+                       fix,
+                       hop,
+                       SubGhzKeyArray_cget(*keys, key_index),
+                       mf_id == centurion_id,
+                       &match)) {
+                    match.key_index = key_index;
                     break;
                 }
             }
         }
+        // Only complete search can tell that remote is not in keystore
+        if(mf_not_set || match.key_index != SUBGHZ_KEYSTORE_INDEX_NONE) {
+            subghz_keystore_cache_put(keystore, &match);
+        }
+    }
+
+    if(match.key_index != SUBGHZ_KEYSTORE_INDEX_NONE) {
+        *manufacture_name = index->mf_names[index->mf_id[match.key_index]];
+        keystore->mfname = *manufacture_name;
+        if(SubGhzKeyArray_cget(*keys, match.key_index)->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = match.learning;
+        }
+        return 1;
+    }
 
     // MF not found
     *manufacture_name = "Unknown";
@@ -8,6 +8,21 @@
 #define g5(x, a, b, c, d, e) \
     (bit(x, a) + bit(x, b) * 2 + bit(x, c) * 4 + bit(x, d) * 8 + bit(x, e) * 16)
 
+/*
+ * Bitsliced lane: bit N of every lane word belongs to key N of the batch.
+ * Host uses GCC vector extension, compiler picks the widest SIMD available.
+ */
+#if KEELOQ_BATCH_SIZE > 32
+typedef uint64_t KeeloqWord;
+typedef KeeloqWord KeeloqLane __attribute__((vector_size(KEELOQ_BATCH_SIZE / 8)));
+#define keeloq_lane_word(lane, n) ((lane)[n])
+#else
+typedef uint32_t KeeloqWord;
+typedef KeeloqWord KeeloqLane;
+#define keeloq_lane_word(lane, n) (*((void)(n), &(lane)))
+#endif
+#define KEELOQ_WORD_BITS (sizeof(KeeloqWord) * 8)
+
 /** Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
  * @param key - manufacture (64bit)
@@ -35,6 +50,107 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/** KeeLoq NLF in algebraic normal form, a..e are state bits 0, 8, 19, 25, 30
+ * a^b^ab^bc^ad^cd^ae^abe^ce^ace^bde^cde
+ */
+#define keeloq_nlf(a, b, c, d, e) \
+    (((a) | (b)) ^ ((b) & (c)) ^ ((d) & ((a) ^ (c))) ^ \
+     ((e) & (((a) & ~(b)) ^ ((c) & ~(a)) ^ ((d) & ((b) ^ (c))))))
+
+/** Transpose bit matrix: bit j of word i is swapped with bit i of word j */
+static void subghz_protocol_keeloq_common_transpose(KeeloqWord m[KEELOQ_WORD_BITS]) {
+    KeeloqWord mask = (KeeloqWord)-1 >> (KEELOQ_WORD_BITS / 2);
+    for(size_t j = KEELOQ_WORD_BITS / 2; j; j >>= 1, mask ^= mask << j) {
+        for(size_t k = 0; k < KEELOQ_WORD_BITS; k = ((k | j) + 1) & ~j) {
+            KeeloqWord t = ((m[k] >> j) ^ m[k + j]) & mask;
+            m[k] ^= t << j;
+            m[k + j] ^= t;
+        }
+    }
+}
+
+/** Transpose up to KEELOQ_BATCH_SIZE keys into bitsliced form */
+static void subghz_protocol_keeloq_common_load_lanes(
+    KeeloqLane key_bits[64],
+    const uint64_t* key,
+    size_t count) {
+    KeeloqWord m[KEELOQ_WORD_BITS];
+    for(size_t word = 0; word * KEELOQ_WORD_BITS < KEELOQ_BATCH_SIZE; word++) {
+        for(size_t part = 0; part < 64 / KEELOQ_WORD_BITS; part++) {
+            for(size_t i = 0; i < KEELOQ_WORD_BITS; i++) {
+                size_t lane = word * KEELOQ_WORD_BITS + i;
+                m[i] = (lane < count) ? (KeeloqWord)(key[lane] >> (part * KEELOQ_WORD_BITS)) : 0;
+            }
+            subghz_protocol_keeloq_common_transpose(m);
+            for(size_t i = 0; i < KEELOQ_WORD_BITS; i++) {
+                keeloq_lane_word(key_bits[part * KEELOQ_WORD_BITS + i], word) = m[i];
+            }
+        }
+    }
+}
+
+/** Decrypt one block with every key lane, state ends up in x
+ *
+ * State is a ring of 32 lanes: on round r state bit i is in x[(31 + r - i) & 31],
+ * new bit 0 takes place of bit 31 which is consumed by the same round.
+ * After 528 rounds bit i is in x[(15 - i) & 31].
+ */
+static void subghz_protocol_keeloq_common_decrypt_lanes(
+    const uint32_t data,
+    const KeeloqLane key_bits[64],
+    KeeloqLane x[32]) {
+    for(size_t i = 0; i < 32; i++) {
+        x[31 - i] = (KeeloqLane){0} - (KeeloqWord)bit(data, i);
+    }
+    for(uint32_t r = 0; r < 528; r++) {
+        x[r & 31] ^= x[(r + 16) & 31] ^ key_bits[(15 - r) & 63] ^
+                     keeloq_nlf(
+                         x[(r + 31) & 31],
+                         x[(r + 23) & 31],
+                         x[(r + 12) & 31],
+                         x[(r + 6) & 31],
+                         x[(r + 1) & 31]);
+    }
+}
+
+/** Transpose decrypted state back, m[i] gets block of key lane word * KEELOQ_WORD_BITS + i */
+static void subghz_protocol_keeloq_common_store_lanes(
+    const KeeloqLane x[32],
+    size_t word,
+    KeeloqWord m[KEELOQ_WORD_BITS]) {
+    for(size_t i = 0; i < KEELOQ_WORD_BITS; i++) {
+        m[i] = (i < 32) ? keeloq_lane_word(x[(15 - i) & 31], word) : 0;
+    }
+    subghz_protocol_keeloq_common_transpose(m);
+}
+
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* key,
+    uint32_t* result,
+    size_t count) {
+    furi_check(key || !count);
+    furi_check(result || !count);
+
+    KeeloqLane key_bits[64];
+    KeeloqLane x[32];
+    KeeloqWord m[KEELOQ_WORD_BITS];
+    while(count) {
+        size_t lanes = MIN(count, (size_t)KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_load_lanes(key_bits, key, lanes);
+        subghz_protocol_keeloq_common_decrypt_lanes(data, key_bits, x);
+        for(size_t i = 0; i < lanes; i++) {
+            if(i % KEELOQ_WORD_BITS == 0) {
+                subghz_protocol_keeloq_common_store_lanes(x, i / KEELOQ_WORD_BITS, m);
+            }
+            result[i] = m[i % KEELOQ_WORD_BITS];
+        }
+        key += lanes;
+        result += lanes;
+        count -= lanes;
+    }
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -54,6 +170,41 @@ inline uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, con
     return ((uint64_t)k2 << 32) | k1; // key - shifrovanoya
 }
 
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count) {
+    furi_check(key || !count);
+    furi_check(man || !count);
+
+    KeeloqLane key_bits[64];
+    KeeloqLane x[32];
+    KeeloqWord m[KEELOQ_WORD_BITS];
+    data &= 0x0FFFFFFF;
+    while(count) {
+        size_t lanes = MIN(count, (size_t)KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_load_lanes(key_bits, key, lanes);
+        subghz_protocol_keeloq_common_decrypt_lanes(data | 0x20000000, key_bits, x);
+        for(size_t i = 0; i < lanes; i++) {
+            if(i % KEELOQ_WORD_BITS == 0) {
+                subghz_protocol_keeloq_common_store_lanes(x, i / KEELOQ_WORD_BITS, m);
+            }
+            man[i] = (uint32_t)m[i % KEELOQ_WORD_BITS];
+        }
+        subghz_protocol_keeloq_common_decrypt_lanes(data | 0x60000000, key_bits, x);
+        for(size_t i = 0; i < lanes; i++) {
+            if(i % KEELOQ_WORD_BITS == 0) {
+                subghz_protocol_keeloq_common_store_lanes(x, i / KEELOQ_WORD_BITS, m);
+            }
+            man[i] |= (uint64_t)m[i % KEELOQ_WORD_BITS] << 32;
+        }
+        key += lanes;
+        man += lanes;
+        count -= lanes;
+    }
+}
+
 /** Secure Learning
  * @param data - serial number (28bit)
  * @param seed - seed number (32bit)
@@ -74,6 +225,42 @@ inline uint64_t subghz_protocol_keeloq_common_secure_learning(
     return ((uint64_t)k1 << 32) | k2;
 }
 
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count) {
+    furi_check(key || !count);
+    furi_check(man || !count);
+
+    KeeloqLane key_bits[64];
+    KeeloqLane x[32];
+    KeeloqWord m[KEELOQ_WORD_BITS];
+    data &= 0x0FFFFFFF;
+    while(count) {
+        size_t lanes = MIN(count, (size_t)KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_load_lanes(key_bits, key, lanes);
+        subghz_protocol_keeloq_common_decrypt_lanes(data, key_bits, x);
+        for(size_t i = 0; i < lanes; i++) {
+            if(i % KEELOQ_WORD_BITS == 0) {
+                subghz_protocol_keeloq_common_store_lanes(x, i / KEELOQ_WORD_BITS, m);
+            }
+            man[i] = (uint64_t)m[i % KEELOQ_WORD_BITS] << 32;
+        }
+        subghz_protocol_keeloq_common_decrypt_lanes(seed, key_bits, x);
+        for(size_t i = 0; i < lanes; i++) {
+            if(i % KEELOQ_WORD_BITS == 0) {
+                subghz_protocol_keeloq_common_store_lanes(x, i / KEELOQ_WORD_BITS, m);
+            }
+            man[i] |= (uint32_t)m[i % KEELOQ_WORD_BITS];
+        }
+        key += lanes;
+        man += lanes;
+        count -= lanes;
+    }
+}
+
 /** Magic_xor_type1 Learning
  * @param data - serial number (28bit)
  * @param xor - magic xor (64bit)
@@ -140,3 +327,48 @@ inline uint64_t
     subghz_protocol_keeloq_common_magic_serial_type3_learning(uint32_t data, uint64_t man) {
     return (man & 0xFFFFFFFFFF000000) | (data & 0xFFFFFF);
 }
+
+void subghz_protocol_keeloq_common_learning_batch(
+    uint8_t learning,
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count) {
+    switch(learning) {
+    case KEELOQ_LEARNING_NORMAL:
+        subghz_protocol_keeloq_common_normal_learning_batch(data, key, man, count);
+        break;
+    case KEELOQ_LEARNING_SECURE:
+        subghz_protocol_keeloq_common_secure_learning_batch(data, seed, key, man, count);
+        break;
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        for(size_t i = 0; i < count; i++) {
+            man[i] = subghz_protocol_keeloq_common_magic_xor_type1_learning(data, key[i]);
+        }
+        break;
+    case KEELOQ_LEARNING_FAAC:
+        for(size_t i = 0; i < count; i++) {
+            man[i] = subghz_protocol_keeloq_common_faac_learning(seed, key[i]);
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        for(size_t i = 0; i < count; i++) {
+            man[i] = subghz_protocol_keeloq_common_magic_serial_type1_learning(data, key[i]);
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        for(size_t i = 0; i < count; i++) {
+            man[i] = subghz_protocol_keeloq_common_magic_serial_type2_learning(data, key[i]);
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        for(size_t i = 0; i < count; i++) {
+            man[i] = subghz_protocol_keeloq_common_magic_serial_type3_learning(data, key[i]);
+        }
+        break;
+    default:
+        if(man != key) memcpy(man, key, sizeof(uint64_t) * count);
+        break;
+    }
+}
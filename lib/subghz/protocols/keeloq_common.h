@@ -26,6 +26,15 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 7u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 8u
 
+/*
+ * Keys processed at once by batch functions, bit width of bitsliced lane
+ */
+#ifdef FURI_HOST
+#define KEELOQ_BATCH_SIZE 256u
+#else
+#define KEELOQ_BATCH_SIZE 32u
+#endif
+
 /**
  * Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -42,6 +51,19 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Simple Learning Decrypt of one block under many keys, bitsliced
+ * @param data - keeloq encrypt data
+ * @param key - manufactures (64bit), count items
+ * @param result - decrypted data for every key, count items
+ * @param count - number of keys, any, KEELOQ_BATCH_SIZE multiples are the fastest
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* key,
+    uint32_t* result,
+    size_t count);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
@@ -50,6 +72,19 @@ uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64
  */
 uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, const uint64_t key);
 
+/** 
+ * Normal Learning for many keys, bitsliced
+ * @param data - serial number (28bit)
+ * @param key - manufactures (64bit), count items
+ * @param man - manufactures for this serial number (64bit), count items, may be the same as key
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count);
+
 /** 
  * Secure Learning
  * @param data - serial number (28bit)
@@ -60,6 +95,21 @@ uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, const uint
 uint64_t
     subghz_protocol_keeloq_common_secure_learning(uint32_t data, uint32_t seed, const uint64_t key);
 
+/** 
+ * Secure Learning for many keys, bitsliced
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param key - manufactures (64bit), count items
+ * @param man - manufactures for this serial number (64bit), count items, may be the same as key
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count);
+
 /** 
  * Magic_xor_type1 Learning
  * @param data - serial number (28bit)
@@ -98,3 +148,19 @@ uint64_t subghz_protocol_keeloq_common_magic_serial_type2_learning(uint32_t data
  */
 
 uint64_t subghz_protocol_keeloq_common_magic_serial_type3_learning(uint32_t data, uint64_t man);
+
+/** Manufacture keys for this serial number of given learning type, many keys at once
+ * @param learning - KEELOQ_LEARNING_*, simple learning and unknown types return keys as is
+ * @param data - btn+serial number (32bit)
+ * @param seed - seed number (32bit)
+ * @param key - manufactures (64bit), count items
+ * @param man - manufactures for this serial number (64bit), count items, may be the same as key
+ * @param count - number of keys
+ */
+void subghz_protocol_keeloq_common_learning_batch(
+    uint8_t learning,
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* key,
+    uint64_t* man,
+    size_t count);
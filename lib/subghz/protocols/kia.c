@@ -38,6 +38,14 @@ typedef enum {
     KIADecoderStepCheckDuration,
 } KIADecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_kia_start = {
+    .timing = &subghz_protocol_kia_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderKIA, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .alloc = subghz_protocol_decoder_kia_alloc,
     .free = subghz_protocol_decoder_kia_free,
@@ -51,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_kia_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
@@ -2,6 +2,7 @@
 #include "keeloq_common.h"
 
 #include "../subghz_keystore.h"
+#include "../subghz_keystore_i.h"
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
@@ -43,6 +44,14 @@ typedef enum {
     KingGates_stylo_4kDecoderStepCheckDuration,
 } KingGates_stylo_4kDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_kinggates_stylo_4k_start = {
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderKingGates_stylo_4k, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .alloc = subghz_protocol_decoder_kinggates_stylo_4k_alloc,
     .free = subghz_protocol_decoder_kinggates_stylo_4k_free,
@@ -56,6 +65,7 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .deserialize = subghz_protocol_decoder_kinggates_stylo_4k_deserialize,
     .get_string = subghz_protocol_decoder_kinggates_stylo_4k_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_kinggates_stylo_4k_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder = {
@@ -446,6 +456,29 @@ void subghz_protocol_decoder_kinggates_stylo_4k_feed(void* context, bool level,
     }
 }
 
+static const SubGhzKeystoreAttempt subghz_protocol_kinggates_stylo_4k_attempts[] = {
+    {KEELOQ_LEARNING_SIMPLE, false},
+};
+
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint32_t decrypt;
+} SubGhzProtocolKingGatesStylo4kSearch;
+
+static bool subghz_protocol_kinggates_stylo_4k_search_callback(
+    void* context,
+    uint32_t decrypt,
+    uint16_t key_index) {
+    UNUSED(key_index);
+    SubGhzProtocolKingGatesStylo4kSearch* search = context;
+    if(((decrypt >> 28) == search->instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
+       (((decrypt >> 16) & 0xFF) == (search->instance->serial & 0xFF))) {
+        search->decrypt = decrypt;
+        return true;
+    }
+    return false;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -478,24 +511,25 @@ static void subghz_protocol_kinggates_stylo_4k_remote_controller(
 
     uint32_t hop = subghz_protocol_blocks_reverse_key(instance->data_2 >> 4, 32);
     uint64_t fix = subghz_protocol_blocks_reverse_key(instance->data, 53);
-    bool ret = false;
-    uint32_t decrypt = 0;
     instance->btn = (fix >> 17) & 0x0F;
     instance->serial = ((fix >> 5) & 0xFFFF0000) | (fix & 0xFFFF);
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(manufacture_code->type == KEELOQ_LEARNING_SIMPLE) {
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
-                   (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
-                    ret = true;
-                    break;
-                }
-            }
-        }
+    // Simple learning keys only, first one in keystore order
+    SubGhzProtocolKingGatesStylo4kSearch search = {.instance = instance};
+    SubGhzKeystoreCacheEntry match = {.key_index = SUBGHZ_KEYSTORE_INDEX_NONE};
+    bool ret = subghz_keystore_search_type(
+        keystore,
+        KEELOQ_LEARNING_SIMPLE,
+        subghz_protocol_kinggates_stylo_4k_attempts,
+        COUNT_OF(subghz_protocol_kinggates_stylo_4k_attempts),
+        0,
+        0,
+        hop,
+        subghz_protocol_kinggates_stylo_4k_search_callback,
+        &search,
+        &match);
     if(ret) {
-        instance->cnt = decrypt & 0xFFFF;
+        instance->cnt = search.decrypt & 0xFFFF;
     } else {
         instance->btn = 0;
         instance->serial = 0;
@@ -50,6 +50,14 @@ typedef enum {
     LaCrosse_TX141THBv2DecoderStepCheckDuration,
 } LaCrosse_TX141THBv2DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_lacrosse_tx141thbv2_start = {
+    .timing = &ws_protocol_lacrosse_tx141thbv2_const,
+    .step_offset = offsetof(WSProtocolDecoderLaCrosse_TX141THBv2, decoder.parser_step),
+    .level = true,
+    .te_mul = 4,
+    .delta_mul = 2,
+};
+
 const SubGhzProtocolDecoder ws_protocol_lacrosse_tx141thbv2_decoder = {
     .alloc = ws_protocol_decoder_lacrosse_tx141thbv2_alloc,
     .free = ws_protocol_decoder_lacrosse_tx141thbv2_free,
@@ -63,6 +71,7 @@ const SubGhzProtocolDecoder ws_protocol_lacrosse_tx141thbv2_decoder = {
     .deserialize = ws_protocol_decoder_lacrosse_tx141thbv2_deserialize,
     .get_string = ws_protocol_decoder_lacrosse_tx141thbv2_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_lacrosse_tx141thbv2_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_lacrosse_tx141thbv2_encoder = {
@@ -41,6 +41,14 @@ typedef enum {
     LegrandDecoderStepCheckDuration,
 } LegrandDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_legrand_start = {
+    .timing = &subghz_protocol_legrand_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderLegrand, decoder.parser_step),
+    .level = false,
+    .te_mul = 16,
+    .delta_mul = 8,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_legrand_decoder = {
     .alloc = subghz_protocol_decoder_legrand_alloc,
     .free = subghz_protocol_decoder_legrand_free,
@@ -54,6 +62,7 @@ const SubGhzProtocolDecoder subghz_protocol_legrand_decoder = {
     .deserialize = subghz_protocol_decoder_legrand_deserialize,
     .get_string = subghz_protocol_decoder_legrand_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_legrand_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_legrand_encoder = {
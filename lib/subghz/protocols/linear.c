@@ -42,6 +42,14 @@ typedef enum {
     LinearDecoderStepCheckDuration,
 } LinearDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_linear_start = {
+    .timing = &subghz_protocol_linear_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderLinear, decoder.parser_step),
+    .level = false,
+    .te_mul = 42,
+    .delta_mul = 20,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .alloc = subghz_protocol_decoder_linear_alloc,
     .free = subghz_protocol_decoder_linear_free,
@@ -55,6 +63,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_linear_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
@@ -43,6 +43,14 @@ typedef enum {
     LinearDecoderStepCheckDuration,
 } LinearDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_linear_delta3_start = {
+    .timing = &subghz_protocol_linear_delta3_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderLinearDelta3, decoder.parser_step),
+    .level = false,
+    .te_mul = 70,
+    .delta_mul = 24,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .alloc = subghz_protocol_decoder_linear_delta3_alloc,
     .free = subghz_protocol_decoder_linear_delta3_free,
@@ -56,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .deserialize = subghz_protocol_decoder_linear_delta3_deserialize,
     .get_string = subghz_protocol_decoder_linear_delta3_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_linear_delta3_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder = {
@@ -38,6 +38,14 @@ typedef enum {
     MagellanDecoderStepCheckDuration,
 } MagellanDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_magellan_start = {
+    .timing = &subghz_protocol_magellan_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderMagellan, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .alloc = subghz_protocol_decoder_magellan_alloc,
     .free = subghz_protocol_decoder_magellan_free,
@@ -51,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .deserialize = subghz_protocol_decoder_magellan_deserialize,
     .get_string = subghz_protocol_decoder_magellan_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_magellan_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_magellan_encoder = {
@@ -50,6 +50,14 @@ typedef enum {
     MastercodeDecoderStepCheckDuration,
 } MastercodeDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_mastercode_start = {
+    .timing = &subghz_protocol_mastercode_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderMastercode, decoder.parser_step),
+    .level = false,
+    .te_mul = 15,
+    .delta_mul = 15,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .alloc = subghz_protocol_decoder_mastercode_alloc,
     .free = subghz_protocol_decoder_mastercode_free,
@@ -63,6 +71,7 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .deserialize = subghz_protocol_decoder_mastercode_deserialize,
     .get_string = subghz_protocol_decoder_mastercode_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_mastercode_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_mastercode_encoder = {
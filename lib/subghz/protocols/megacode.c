@@ -48,6 +48,14 @@ typedef enum {
     MegaCodeDecoderStepCheckDuration,
 } MegaCodeDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_megacode_start = {
+    .timing = &subghz_protocol_megacode_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderMegaCode, decoder.parser_step),
+    .level = false,
+    .te_mul = 13,
+    .delta_mul = 17,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .alloc = subghz_protocol_decoder_megacode_alloc,
     .free = subghz_protocol_decoder_megacode_free,
@@ -61,6 +69,7 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_megacode_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
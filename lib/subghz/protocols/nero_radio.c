@@ -38,6 +38,14 @@ typedef enum {
     NeroRadioDecoderStepCheckDuration,
 } NeroRadioDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nero_radio_start = {
+    .timing = &subghz_protocol_nero_radio_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderNeroRadio, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .alloc = subghz_protocol_decoder_nero_radio_alloc,
     .free = subghz_protocol_decoder_nero_radio_free,
@@ -51,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .deserialize = subghz_protocol_decoder_nero_radio_deserialize,
     .get_string = subghz_protocol_decoder_nero_radio_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_nero_radio_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder = {
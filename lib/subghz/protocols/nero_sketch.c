@@ -37,6 +37,14 @@ typedef enum {
     NeroSketchDecoderStepCheckDuration,
 } NeroSketchDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nero_sketch_start = {
+    .timing = &subghz_protocol_nero_sketch_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderNeroSketch, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .alloc = subghz_protocol_decoder_nero_sketch_alloc,
     .free = subghz_protocol_decoder_nero_sketch_free,
@@ -50,6 +58,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .deserialize = subghz_protocol_decoder_nero_sketch_deserialize,
     .get_string = subghz_protocol_decoder_nero_sketch_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_nero_sketch_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder = {
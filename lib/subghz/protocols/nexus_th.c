@@ -316,6 +316,14 @@ void ws_protocol_decoder_nexus_th_get_string(void* context, FuriString* output)
     ws_block_generic_get_string(&instance->generic, output);
 }
 
+static const SubGhzProtocolDecoderStart ws_protocol_nexus_th_start = {
+    .timing = &ws_protocol_nexus_th_const,
+    .step_offset = offsetof(WSProtocolDecoderNexus_TH, decoder.parser_step),
+    .level = false,
+    .te_mul = 8,
+    .delta_mul = 4,
+};
+
 const SubGhzProtocolDecoder ws_protocol_nexus_th_decoder = {
     .alloc = ws_protocol_decoder_nexus_th_alloc,
     .free = ws_protocol_decoder_nexus_th_free,
@@ -329,6 +337,7 @@ const SubGhzProtocolDecoder ws_protocol_nexus_th_decoder = {
     .deserialize = ws_protocol_decoder_nexus_th_deserialize,
     .get_string = ws_protocol_decoder_nexus_th_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_nexus_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_nexus_th_encoder = {
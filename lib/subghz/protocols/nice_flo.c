@@ -35,6 +35,14 @@ typedef enum {
     NiceFloDecoderStepCheckDuration,
 } NiceFloDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nice_flo_start = {
+    .timing = &subghz_protocol_nice_flo_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderNiceFlo, decoder.parser_step),
+    .level = false,
+    .te_mul = 36,
+    .delta_mul = 36,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .alloc = subghz_protocol_decoder_nice_flo_alloc,
     .free = subghz_protocol_decoder_nice_flo_free,
@@ -48,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_nice_flo_start,
+    .feed_batch = subghz_protocol_decoder_nice_flo_feed_batch,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -278,6 +288,30 @@ void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t d
     }
 }
 
+size_t subghz_protocol_decoder_nice_flo_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+
+    for(size_t i = 0; i < pairs_count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        // Most of the time decoder waits for header, check it here without a call
+        if(instance->decoder.parser_step == NiceFloDecoderStepReset &&
+           (level || DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short * 36) >=
+                     subghz_protocol_nice_flo_const.te_delta * 36)) {
+            continue;
+        }
+        instance->base.feed_index = i;
+        subghz_protocol_decoder_nice_flo_feed(instance, level, duration);
+        if(instance->base.batch_stop) return i + 1;
+    }
+
+    return pairs_count;
+}
+
 uint32_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
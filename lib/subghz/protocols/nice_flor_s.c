@@ -53,6 +53,14 @@ typedef enum {
     NiceFlorSDecoderStepCheckDuration,
 } NiceFlorSDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nice_flor_s_start = {
+    .timing = &subghz_protocol_nice_flor_s_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderNiceFlorS, decoder.parser_step),
+    .level = false,
+    .te_mul = 38,
+    .delta_mul = 38,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .alloc = subghz_protocol_decoder_nice_flor_s_alloc,
     .free = subghz_protocol_decoder_nice_flor_s_free,
@@ -66,6 +74,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_nice_flor_s_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
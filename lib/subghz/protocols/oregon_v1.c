@@ -69,6 +69,14 @@ typedef enum {
     Oregon_V1DecoderStepParse,
 } Oregon_V1DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_oregon_v1_start = {
+    .timing = &ws_protocol_oregon_v1_const,
+    .step_offset = offsetof(WSProtocolDecoderOregon_V1, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_oregon_v1_decoder = {
     .alloc = ws_protocol_decoder_oregon_v1_alloc,
     .free = ws_protocol_decoder_oregon_v1_free,
@@ -82,6 +90,7 @@ const SubGhzProtocolDecoder ws_protocol_oregon_v1_decoder = {
     .deserialize = ws_protocol_decoder_oregon_v1_deserialize,
     .get_string = ws_protocol_decoder_oregon_v1_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_oregon_v1_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_oregon_v1_encoder = {
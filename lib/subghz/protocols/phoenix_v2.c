@@ -38,6 +38,14 @@ typedef enum {
     Phoenix_V2DecoderStepCheckDuration,
 } Phoenix_V2DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_phoenix_v2_start = {
+    .timing = &subghz_protocol_phoenix_v2_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderPhoenix_V2, decoder.parser_step),
+    .level = false,
+    .te_mul = 60,
+    .delta_mul = 30,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .alloc = subghz_protocol_decoder_phoenix_v2_alloc,
     .free = subghz_protocol_decoder_phoenix_v2_free,
@@ -51,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_phoenix_v2_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
@@ -51,6 +51,14 @@ typedef enum {
     PrincetonDecoderStepCheckDuration,
 } PrincetonDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_princeton_start = {
+    .timing = &subghz_protocol_princeton_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderPrinceton, decoder.parser_step),
+    .level = false,
+    .te_mul = 36,
+    .delta_mul = 36,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .alloc = subghz_protocol_decoder_princeton_alloc,
     .free = subghz_protocol_decoder_princeton_free,
@@ -64,6 +72,8 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .deserialize = subghz_protocol_decoder_princeton_deserialize,
     .get_string = subghz_protocol_decoder_princeton_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_princeton_start,
+    .feed_batch = subghz_protocol_decoder_princeton_feed_batch,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_princeton_encoder = {
@@ -320,6 +330,30 @@ void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t
     }
 }
 
+size_t subghz_protocol_decoder_princeton_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+
+    for(size_t i = 0; i < pairs_count; i++) {
+        bool level = level_duration_get_level(pairs[i]);
+        uint32_t duration = level_duration_get_duration(pairs[i]);
+        // Most of the time decoder waits for header, check it here without a call
+        if(instance->decoder.parser_step == PrincetonDecoderStepReset &&
+           (level || DURATION_DIFF(duration, subghz_protocol_princeton_const.te_short * 36) >=
+                     subghz_protocol_princeton_const.te_delta * 36)) {
+            continue;
+        }
+        instance->base.feed_index = i;
+        subghz_protocol_decoder_princeton_feed(instance, level, duration);
+        if(instance->base.batch_stop) return i + 1;
+    }
+
+    return pairs_count;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -77,6 +77,18 @@ void subghz_protocol_decoder_princeton_reset(void* context);
  */
 void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * @param context Pointer to a SubGhzProtocolDecoderPrinceton instance
+ * @param pairs Levels and durations
+ * @param pairs_count Number of pairs
+ * @return Number of pairs consumed
+ */
+size_t subghz_protocol_decoder_princeton_feed_batch(
+    void* context,
+    const LevelDuration* pairs,
+    size_t pairs_count);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderPrinceton instance
@@ -1,6 +1,7 @@
 #include "raw.h"
 #include <lib/flipper_format/flipper_format.h>
 #include "../subghz_file_encoder_worker.h"
+#include "../subghz_raw_binary.h"
 
 #include "../blocks/const.h"
 #include "../blocks/generic.h"
@@ -31,6 +32,8 @@ struct SubGhzProtocolDecoderRAW {
     size_t sample_write;
     bool last_level;
     bool pause;
+    SubGhzProtocolRawFormat format;
+    SubGhzRawBinaryWriter* binary_writer;
 };
 
 struct SubGhzProtocolEncoderRAW {
@@ -158,6 +161,16 @@ bool subghz_protocol_raw_save_to_file_init(
             break;
         }
 
+        if(instance->format != SubGhzProtocolRawFormatText) {
+            instance->binary_writer = subghz_raw_binary_writer_alloc(
+                instance->format == SubGhzProtocolRawFormatBinaryCompressed);
+            if(!subghz_raw_binary_writer_start(instance->binary_writer, instance->flipper_file)) {
+                subghz_raw_binary_writer_free(instance->binary_writer);
+                instance->binary_writer = NULL;
+                break;
+            }
+        }
+
         instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
         instance->file_is_open = RAWFileIsOpenWrite;
         instance->sample_write = 0;
@@ -175,7 +188,16 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
     furi_assert(instance);
 
     bool is_write = false;
-    if(instance->file_is_open == RAWFileIsOpenWrite) {
+    if(instance->file_is_open == RAWFileIsOpenWrite && instance->binary_writer) {
+        if(!subghz_raw_binary_writer_add(
+               instance->binary_writer, instance->upload_raw, instance->ind_write)) {
+            FURI_LOG_E(TAG, "Unable to add RAW binary data");
+        } else {
+            instance->sample_write += instance->ind_write;
+            instance->ind_write = 0;
+            is_write = true;
+        }
+    } else if(instance->file_is_open == RAWFileIsOpenWrite) {
         if(!flipper_format_write_int32(
                instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
@@ -193,6 +215,13 @@ void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance) {
 
     if(instance->file_is_open == RAWFileIsOpenWrite && instance->ind_write)
         subghz_protocol_raw_save_to_file_write(instance);
+    if(instance->binary_writer) {
+        if(!subghz_raw_binary_writer_finish(instance->binary_writer)) {
+            FURI_LOG_E(TAG, "Unable to finish RAW binary data");
+        }
+        subghz_raw_binary_writer_free(instance->binary_writer);
+        instance->binary_writer = NULL;
+    }
     if(instance->file_is_open != RAWFileIsOpenClose) {
         free(instance->upload_raw);
         instance->upload_raw = NULL;
@@ -212,6 +241,13 @@ void subghz_protocol_raw_save_to_file_pause(SubGhzProtocolDecoderRAW* instance,
     }
 }
 
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRawFormat format) {
+    furi_check(instance);
+    instance->format = format;
+}
+
 size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance) {
     furi_check(instance);
     return instance->sample_write + instance->ind_write;
@@ -225,6 +261,8 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->ind_write = 0;
     instance->last_level = false;
     instance->file_is_open = RAWFileIsOpenClose;
+    instance->format = SubGhzProtocolRawFormatText;
+    instance->binary_writer = NULL;
     instance->file_name = furi_string_alloc();
 
     return instance;
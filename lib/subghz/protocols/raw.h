@@ -10,6 +10,12 @@ extern "C" {
 
 typedef void (*SubGhzProtocolEncoderRAWCallbackEnd)(void* context);
 
+typedef enum {
+    SubGhzProtocolRawFormatText, /**< RAW_Data lines, default */
+    SubGhzProtocolRawFormatBinary, /**< Varint delta blocks, see subghz_raw_binary.h */
+    SubGhzProtocolRawFormatBinaryCompressed, /**< Same, heatshrink compressed */
+} SubGhzProtocolRawFormat;
+
 typedef struct SubGhzProtocolDecoderRAW SubGhzProtocolDecoderRAW;
 typedef struct SubGhzProtocolEncoderRAW SubGhzProtocolEncoderRAW;
 
@@ -35,6 +41,15 @@ bool subghz_protocol_raw_save_to_file_init(
  */
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance);
 
+/**
+ * Set format of RAW data, applied by next subghz_protocol_raw_save_to_file_init
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param format RAW data format, SubGhzProtocolRawFormat
+ */
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRawFormat format);
+
 /**
  * Get the number of samples received SubGhzProtocolDecoderRAW.
  * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
@@ -44,6 +44,14 @@ typedef enum {
     ScherKhanDecoderStepCheckDuration,
 } ScherKhanDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_scher_khan_start = {
+    .timing = &subghz_protocol_scher_khan_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderScherKhan, decoder.parser_step),
+    .level = true,
+    .te_mul = 2,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .alloc = subghz_protocol_decoder_scher_khan_alloc,
     .free = subghz_protocol_decoder_scher_khan_free,
@@ -57,6 +65,7 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .deserialize = subghz_protocol_decoder_scher_khan_deserialize,
     .get_string = subghz_protocol_decoder_scher_khan_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_scher_khan_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder = {
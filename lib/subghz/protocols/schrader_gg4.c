@@ -75,6 +75,15 @@ typedef enum {
     SchraderGG4DecoderStepCheckDuration,
 } SchraderGG4DecoderStep;
 
+static const SubGhzProtocolDecoderStart tpms_protocol_schrader_gg4_start = {
+    .timing = &tpms_protocol_schrader_gg4_const,
+    .step_offset = offsetof(TPMSProtocolDecoderSchraderGG4, decoder.parser_step),
+    .level = true,
+    .te_long = true,
+    .te_mul = 2,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder tpms_protocol_schrader_gg4_decoder = {
     .alloc = tpms_protocol_decoder_schrader_gg4_alloc,
     .free = tpms_protocol_decoder_schrader_gg4_free,
@@ -88,6 +97,7 @@ const SubGhzProtocolDecoder tpms_protocol_schrader_gg4_decoder = {
     .deserialize = tpms_protocol_decoder_schrader_gg4_deserialize,
     .get_string = tpms_protocol_decoder_schrader_gg4_get_string,
     .get_string_brief = NULL,
+    .start = &tpms_protocol_schrader_gg4_start,
 };
 
 const SubGhzProtocolEncoder tpms_protocol_schrader_gg4_encoder = {
@@ -59,6 +59,14 @@ typedef enum {
     SecPlus_v1DecoderStepDecoderData,
 } SecPlus_v1DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_secplus_v1_start = {
+    .timing = &subghz_protocol_secplus_v1_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderSecPlus_v1, decoder.parser_step),
+    .level = false,
+    .te_mul = 120,
+    .delta_mul = 120,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v1_alloc,
     .free = subghz_protocol_decoder_secplus_v1_free,
@@ -72,6 +80,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_secplus_v1_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
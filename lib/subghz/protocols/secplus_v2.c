@@ -53,6 +53,15 @@ typedef enum {
     SecPlus_v2DecoderStepDecoderData,
 } SecPlus_v2DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_secplus_v2_start = {
+    .timing = &subghz_protocol_secplus_v2_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderSecPlus_v2, decoder.parser_step),
+    .level = false,
+    .te_long = true,
+    .te_mul = 130,
+    .delta_mul = 100,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v2_alloc,
     .free = subghz_protocol_decoder_secplus_v2_free,
@@ -66,6 +75,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .deserialize = subghz_protocol_decoder_secplus_v2_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v2_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_secplus_v2_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v2_encoder = {
@@ -61,6 +61,14 @@ typedef enum {
     SMC5326DecoderStepCheckDuration,
 } SMC5326DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_smc5326_start = {
+    .timing = &subghz_protocol_smc5326_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderSMC5326, decoder.parser_step),
+    .level = false,
+    .te_mul = 24,
+    .delta_mul = 12,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .alloc = subghz_protocol_decoder_smc5326_alloc,
     .free = subghz_protocol_decoder_smc5326_free,
@@ -74,6 +82,7 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_smc5326_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
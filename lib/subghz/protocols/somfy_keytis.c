@@ -42,6 +42,14 @@ typedef enum {
     SomfyKeytisDecoderStepDecoderData,
 } SomfyKeytisDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_somfy_keytis_start = {
+    .timing = &subghz_protocol_somfy_keytis_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderSomfyKeytis, decoder.parser_step),
+    .level = true,
+    .te_mul = 4,
+    .delta_mul = 4,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_keytis_alloc,
     .free = subghz_protocol_decoder_somfy_keytis_free,
@@ -55,6 +63,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .deserialize = subghz_protocol_decoder_somfy_keytis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_keytis_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_somfy_keytis_start,
 };
 
 const SubGhzProtocol subghz_protocol_somfy_keytis = {
@@ -43,6 +43,14 @@ typedef enum {
     SomfyTelisDecoderStepDecoderData,
 } SomfyTelisDecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_somfy_telis_start = {
+    .timing = &subghz_protocol_somfy_telis_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderSomfyTelis, decoder.parser_step),
+    .level = true,
+    .te_mul = 4,
+    .delta_mul = 4,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_telis_alloc,
     .free = subghz_protocol_decoder_somfy_telis_free,
@@ -56,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .deserialize = subghz_protocol_decoder_somfy_telis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_telis_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_somfy_telis_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_telis_encoder = {
@@ -499,8 +499,44 @@ static inline bool subghz_protocol_star_line_check_decrypt(
     return false;
 }
 
+/** Manufacture key derivations tried for keys of KEELOQ_LEARNING_UNKNOWN type */
+static const SubGhzKeystoreAttempt subghz_protocol_star_line_unknown_attempts[] = {
+    {KEELOQ_LEARNING_SIMPLE, false},
+    {KEELOQ_LEARNING_SIMPLE, true},
+    {KEELOQ_LEARNING_NORMAL, false},
+    {KEELOQ_LEARNING_NORMAL, true},
+};
+
+static const SubGhzKeystoreAttempt subghz_protocol_star_line_simple_attempts[] = {
+    {KEELOQ_LEARNING_SIMPLE, false},
+};
+
+static const SubGhzKeystoreAttempt subghz_protocol_star_line_normal_attempts[] = {
+    {KEELOQ_LEARNING_NORMAL, false},
+};
+
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint32_t fix;
+} SubGhzProtocolStarLineSearch;
+
+static bool subghz_protocol_star_line_search_callback(
+    void* context,
+    uint32_t decrypt,
+    uint16_t key_index) {
+    UNUSED(key_index);
+    SubGhzProtocolStarLineSearch* search = context;
+    uint16_t end_serial = (uint16_t)(search->fix & 0xFF);
+    uint8_t btn = (uint8_t)(search->fix >> 24);
+    return subghz_protocol_star_line_check_decrypt(search->instance, decrypt, btn, end_serial);
+}
+
 /** 
  * Checking the accepted code against the database manafacture key
+ *
+ * Without manufacture whole keystore is searched by learning type with batch decrypt,
+ * first matching key in keystore order wins.
+ *
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
@@ -514,11 +550,6 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     uint32_t hop,
     SubGhzKeystore* keystore,
     const char** manufacture_name) {
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 24);
-    uint32_t decrypt = 0;
-    uint64_t man_normal_learning;
-    bool mf_not_set = false;
     // TODO:
     // if(mfname == 0x0) {
     //     mfname = "";
@@ -528,89 +559,90 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
 
     if(strcmp(mfname, "Unknown") == 0) {
         return 1;
-    } else if(strcmp(mfname, "") == 0) {
-        mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    //###########################
-                    // Normal Learning
+
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(keystore);
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    SubGhzProtocolStarLineSearch search = {.instance = instance, .fix = fix};
+    SubGhzKeystoreCacheEntry match = {.fix = fix, .key_index = SUBGHZ_KEYSTORE_INDEX_NONE};
+
+    if(mfname[0] == '\0') {
+        subghz_keystore_search_type(
+            keystore,
+            KEELOQ_LEARNING_SIMPLE,
+            subghz_protocol_star_line_simple_attempts,
+            COUNT_OF(subghz_protocol_star_line_simple_attempts),
+            fix,
+            0,
+            hop,
+            subghz_protocol_star_line_search_callback,
+            &search,
+            &match);
+        subghz_keystore_search_type(
+            keystore,
+            KEELOQ_LEARNING_NORMAL,
+            subghz_protocol_star_line_normal_attempts,
+            COUNT_OF(subghz_protocol_star_line_normal_attempts),
+            fix,
+            0,
+            hop,
+            subghz_protocol_star_line_search_callback,
+            &search,
+            &match);
+        subghz_keystore_search_type(
+            keystore,
+            KEELOQ_LEARNING_UNKNOWN,
+            subghz_protocol_star_line_unknown_attempts,
+            COUNT_OF(subghz_protocol_star_line_unknown_attempts),
+            fix,
+            0,
+            hop,
+            subghz_protocol_star_line_search_callback,
+            &search,
+            &match);
+    } else {
+        uint16_t mf_id = subghz_keystore_get_manufacture_id(keystore, mfname);
+        size_t start = (mf_id == SUBGHZ_KEYSTORE_INDEX_NONE) ? 0 : index->mf_offset[mf_id];
+        size_t end = (mf_id == SUBGHZ_KEYSTORE_INDEX_NONE) ? 0 : index->mf_offset[mf_id + 1];
+        for(size_t i = start; i < end && match.key_index == SUBGHZ_KEYSTORE_INDEX_NONE; i++) {
+            uint16_t key_index = index->mf_keys[i];
+            const SubGhzKey* key = SubGhzKeyArray_cget(*keys, key_index);
+            const SubGhzKeystoreAttempt* attempts = NULL;
+            size_t attempts_count = 0;
+            if(key->type == KEELOQ_LEARNING_SIMPLE) {
+                attempts = subghz_protocol_star_line_simple_attempts;
+                attempts_count = COUNT_OF(subghz_protocol_star_line_simple_attempts);
+            } else if(key->type == KEELOQ_LEARNING_NORMAL) {
+                attempts = subghz_protocol_star_line_normal_attempts;
+                attempts_count = COUNT_OF(subghz_protocol_star_line_normal_attempts);
+            } else if(key->type == KEELOQ_LEARNING_UNKNOWN) {
+                attempts = subghz_protocol_star_line_unknown_attempts;
+                attempts_count = COUNT_OF(subghz_protocol_star_line_unknown_attempts);
+            }
+            for(size_t j = 0; j < attempts_count; j++) {
+                uint64_t man = attempts[j].mirrored ? __builtin_bswap64(key->key) : key->key;
+                if(attempts[j].learning == KEELOQ_LEARNING_NORMAL) {
                     // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
+                    man = subghz_protocol_keeloq_common_normal_learning(fix, man);
+                }
+                uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+                if(subghz_protocol_star_line_search_callback(&search, decrypt, key_index)) {
+                    match.key_index = key_index;
+                    match.learning = attempts[j].learning;
                     break;
                 }
             }
         }
+    }
+
+    if(match.key_index != SUBGHZ_KEYSTORE_INDEX_NONE) {
+        *manufacture_name = index->mf_names[index->mf_id[match.key_index]];
+        keystore->mfname = *manufacture_name;
+        if(SubGhzKeyArray_cget(*keys, match.key_index)->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = match.learning;
+        }
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     keystore->mfname = "Unknown";
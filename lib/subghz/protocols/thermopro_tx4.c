@@ -53,6 +53,14 @@ typedef enum {
     ThermoPRO_TX4DecoderStepCheckDuration,
 } ThermoPRO_TX4DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_thermopro_tx4_start = {
+    .timing = &ws_protocol_thermopro_tx4_const,
+    .step_offset = offsetof(WSProtocolDecoderThermoPRO_TX4, decoder.parser_step),
+    .level = false,
+    .te_mul = 18,
+    .delta_mul = 10,
+};
+
 const SubGhzProtocolDecoder ws_protocol_thermopro_tx4_decoder = {
     .alloc = ws_protocol_decoder_thermopro_tx4_alloc,
     .free = ws_protocol_decoder_thermopro_tx4_free,
@@ -66,6 +74,7 @@ const SubGhzProtocolDecoder ws_protocol_thermopro_tx4_decoder = {
     .deserialize = ws_protocol_decoder_thermopro_tx4_deserialize,
     .get_string = ws_protocol_decoder_thermopro_tx4_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_thermopro_tx4_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_thermopro_tx4_encoder = {
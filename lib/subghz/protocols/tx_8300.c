@@ -64,6 +64,14 @@ typedef enum {
     TX_8300DecoderStepCheckDuration,
 } TX_8300DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_tx_8300_start = {
+    .timing = &ws_protocol_tx_8300_const,
+    .step_offset = offsetof(WSProtocolDecoderTX_8300, decoder.parser_step),
+    .level = true,
+    .te_mul = 2,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_tx_8300_decoder = {
     .alloc = ws_protocol_decoder_tx_8300_alloc,
     .free = ws_protocol_decoder_tx_8300_free,
@@ -77,6 +85,7 @@ const SubGhzProtocolDecoder ws_protocol_tx_8300_decoder = {
     .deserialize = ws_protocol_decoder_tx_8300_deserialize,
     .get_string = ws_protocol_decoder_tx_8300_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_tx_8300_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_tx_8300_encoder = {
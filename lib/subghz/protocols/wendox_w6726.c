@@ -58,6 +58,14 @@ typedef enum {
     WendoxW6726DecoderStepCheckDuration,
 } WendoxW6726DecoderStep;
 
+static const SubGhzProtocolDecoderStart ws_protocol_wendox_w6726_start = {
+    .timing = &ws_protocol_wendox_w6726_const,
+    .step_offset = offsetof(WSProtocolDecoderWendoxW6726, decoder.parser_step),
+    .level = true,
+    .te_mul = 1,
+    .delta_mul = 1,
+};
+
 const SubGhzProtocolDecoder ws_protocol_wendox_w6726_decoder = {
     .alloc = ws_protocol_decoder_wendox_w6726_alloc,
     .free = ws_protocol_decoder_wendox_w6726_free,
@@ -71,6 +79,7 @@ const SubGhzProtocolDecoder ws_protocol_wendox_w6726_decoder = {
     .deserialize = ws_protocol_decoder_wendox_w6726_deserialize,
     .get_string = ws_protocol_decoder_wendox_w6726_get_string,
     .get_string_brief = NULL,
+    .start = &ws_protocol_wendox_w6726_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_wendox_w6726_encoder = {
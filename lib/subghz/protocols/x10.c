@@ -66,6 +66,14 @@ typedef enum {
     X10DecoderStepCheckDuration,
 } X10DecoderStep;
 
+static const SubGhzProtocolDecoderStart subghz_protocol_x10_start = {
+    .timing = &subghz_protocol_x10_const,
+    .step_offset = offsetof(SubGhzProtocolDecoderX10, decoder.parser_step),
+    .level = true,
+    .te_mul = 16,
+    .delta_mul = 7,
+};
+
 const SubGhzProtocolDecoder subghz_protocol_x10_decoder = {
     .alloc = subghz_protocol_decoder_x10_alloc,
     .free = subghz_protocol_decoder_x10_free,
@@ -77,6 +85,7 @@ const SubGhzProtocolDecoder subghz_protocol_x10_decoder = {
     .deserialize = subghz_protocol_decoder_x10_deserialize,
     .get_string = subghz_protocol_decoder_x10_get_string,
     .get_string_brief = NULL,
+    .start = &subghz_protocol_x10_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_x10_encoder = {
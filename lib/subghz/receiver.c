@@ -5,7 +5,18 @@
 #include <m-array.h>
 
 typedef struct {
-    SubGhzProtocolEncoderBase* base;
+    SubGhzProtocolDecoderBase* base;
+    SubGhzDecoderFeed feed;
+    bool enabled;
+
+    // Start window, decoder without it gets every pulse
+    const uint32_t* step;
+    bool start_level;
+    uint32_t start_min;
+    uint32_t start_range;
+
+    // Position of decoder in block passed to subghz_receiver_decode_batch
+    size_t batch_index;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -18,8 +29,36 @@ struct SubGhzReceiver {
 
     SubGhzReceiverCallback callback;
     void* context;
+
+    // Block in subghz_receiver_decode_batch. Decoders run through it one by one,
+    // when one of them decodes the others are brought to the same pair first
+    const LevelDuration* batch_pairs;
+    bool batch_active;
+    SubGhzReceiverSlot* batch_slot;
+    SubGhzReceiverSlot* catch_up_slot;
+    size_t catch_up_index;
+    bool is_batch_slot_reset;
+    bool is_reset;
 };
 
+static void subghz_receiver_slot_init_start(SubGhzReceiverSlot* slot) {
+    const SubGhzProtocolDecoderStart* start = slot->base->protocol->decoder->start;
+    if(!start) return;
+    if(!subghz_protocol_decoder_start_get_window(start, &slot->start_min, &slot->start_range))
+        return;
+
+    slot->step = (const uint32_t*)((const uint8_t*)slot->base + start->step_offset);
+    slot->start_level = start->level;
+}
+
+static void subghz_receiver_update_enabled(SubGhzReceiver* instance) {
+    for
+        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+            slot->enabled = (slot->base->protocol->flag & instance->filter) != 0 &&
+                            (slot->base->protocol->filter & instance->ignore_filter) == 0;
+        }
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -32,12 +71,26 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
 
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
+            memset(slot, 0, sizeof(SubGhzReceiverSlot));
             slot->base = protocol->decoder->alloc(environment);
+            slot->feed = protocol->decoder->feed;
+            subghz_receiver_slot_init_start(slot);
         }
     }
 
+    instance->filter = 0;
+    instance->ignore_filter = 0;
+    subghz_receiver_update_enabled(instance);
+
     instance->callback = NULL;
     instance->context = NULL;
+    instance->batch_pairs = NULL;
+    instance->batch_active = false;
+    instance->batch_slot = NULL;
+    instance->catch_up_slot = NULL;
+    instance->catch_up_index = 0;
+    instance->is_batch_slot_reset = false;
+    instance->is_reset = false;
     return instance;
 }
 
@@ -58,17 +111,135 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
     free(instance);
 }
 
+static inline void
+    subghz_receiver_slot_feed(SubGhzReceiverSlot* slot, bool level, uint32_t duration) {
+    // Most decoders wait in reset step for a pulse of specific level and length,
+    // skip them without a call unless pulse fits their start window
+    if(slot->step && *slot->step == 0 &&
+       (slot->start_level != level || duration - slot->start_min > slot->start_range)) {
+        return;
+    }
+    slot->feed(slot->base, level, duration);
+}
+
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
     furi_check(instance);
     furi_check(instance->slots);
 
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0 &&
-               (slot->base->protocol->filter & instance->ignore_filter) == 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+            if(!slot->enabled) continue;
+            subghz_receiver_slot_feed(slot, level, duration);
+        }
+}
+
+/* Call rx callback for decoder that decoded pair with given index in block */
+static void subghz_receiver_batch_callback(
+    SubGhzReceiver* instance,
+    SubGhzReceiverSlot* decoded_slot,
+    size_t index) {
+    instance->is_reset = false;
+    instance->callback(instance, decoded_slot->base, instance->context);
+    if(!instance->is_reset) return;
+
+    // Decoders were reset after this pair as in subghz_receiver_decode: ones before
+    // the decoded one got it already, the rest get it after reset
+    bool is_after = false;
+    for
+        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+            slot->batch_index = is_after ? index : index + 1;
+            if(slot == decoded_slot) is_after = true;
+        }
+
+    // Decoder in feed_batch went past this pair, it restarts from here
+    if(instance->batch_slot) {
+        instance->batch_slot->base->batch_stop = true;
+        instance->is_batch_slot_reset = instance->batch_slot != decoded_slot;
+    }
+}
+
+/* Feed other decoders pair by pair up to the one decoded by batch slot,
+ * false if rx callback reset them before it */
+static bool subghz_receiver_batch_catch_up(SubGhzReceiver* instance, size_t index) {
+    size_t catch_up_index = index;
+    for
+        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+            if(slot == instance->batch_slot || !slot->enabled) continue;
+            catch_up_index = MIN(catch_up_index, slot->batch_index);
+        }
+
+    bool result = true;
+    for(; result && catch_up_index <= index; catch_up_index++) {
+        const LevelDuration pair = instance->batch_pairs[catch_up_index];
+        bool is_before = true;
+        for
+            M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+                if(slot == instance->batch_slot) {
+                    is_before = false;
+                    continue;
+                }
+                if(!slot->enabled || slot->batch_index != catch_up_index) continue;
+                if(catch_up_index == index && !is_before) continue;
+
+                slot->batch_index = catch_up_index + 1;
+                instance->catch_up_slot = slot;
+                instance->catch_up_index = catch_up_index;
+                subghz_receiver_slot_feed(
+                    slot, level_duration_get_level(pair), level_duration_get_duration(pair));
+                instance->catch_up_slot = NULL;
+                if(instance->is_batch_slot_reset) {
+                    result = false;
+                    break;
+                }
             }
+    }
+    return result;
+}
+
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pairs,
+    size_t pairs_count) {
+    furi_check(instance);
+    furi_check(instance->slots);
+    furi_check(pairs || !pairs_count);
+
+    for
+        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+            slot->batch_index = 0;
         }
+
+    // Every decoder runs through the whole block. Before rx callback is called
+    // the others are fed up to the decoded pair, so callbacks and resets from them
+    // happen exactly as with subghz_receiver_decode called for every pair.
+    instance->batch_pairs = pairs;
+    instance->batch_active = true;
+    bool is_restarted;
+    do {
+        is_restarted = false;
+        for
+            M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+                if(!slot->enabled || slot->batch_index >= pairs_count) continue;
+                instance->batch_slot = slot;
+                size_t count = subghz_protocol_decoder_base_feed_batch(
+                    slot->base, pairs + slot->batch_index, pairs_count - slot->batch_index);
+                instance->batch_slot = NULL;
+                if(!slot->base->batch_stop) {
+                    slot->batch_index += count;
+                    continue;
+                }
+
+                // Reset by rx callback, decoder did not get it in time if decoded by another
+                if(instance->is_batch_slot_reset) {
+                    instance->is_batch_slot_reset = false;
+                    slot->base->protocol->decoder->reset(slot->base);
+                }
+                is_restarted = true;
+                break;
+            }
+    } while(is_restarted);
+    instance->batch_active = false;
+    instance->batch_pairs = NULL;
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -79,12 +250,24 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+    instance->is_reset = true;
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
     SubGhzReceiver* instance = context;
-    if(instance->callback) {
+    if(!instance->callback) return;
+
+    if(!instance->batch_active) {
         instance->callback(instance, decoder_base, instance->context);
+    } else if(instance->catch_up_slot) {
+        subghz_receiver_batch_callback(
+            instance, instance->catch_up_slot, instance->catch_up_index);
+    } else {
+        furi_assert(instance->batch_slot && instance->batch_slot->base == decoder_base);
+        size_t index = instance->batch_slot->batch_index + decoder_base->feed_index;
+        if(subghz_receiver_batch_catch_up(instance, index)) {
+            subghz_receiver_batch_callback(instance, instance->batch_slot, index);
+        }
     }
 }
 
@@ -97,7 +280,7 @@ void subghz_receiver_set_rx_callback(
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             subghz_protocol_decoder_base_set_decoder_callback(
-                (SubGhzProtocolDecoderBase*)slot->base, subghz_receiver_rx_callback, instance);
+                slot->base, subghz_receiver_rx_callback, instance);
         }
 
     instance->callback = callback;
@@ -107,6 +290,7 @@ void subghz_receiver_set_rx_callback(
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter) {
     furi_check(instance);
     instance->filter = filter;
+    subghz_receiver_update_enabled(instance);
 }
 
 void subghz_receiver_set_ignore_filter(
@@ -114,6 +298,7 @@ void subghz_receiver_set_ignore_filter(
     SubGhzProtocolFilter ignore_filter) {
     furi_assert(instance);
     instance->ignore_filter = ignore_filter;
+    subghz_receiver_update_enabled(instance);
 }
 
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
@@ -126,7 +311,7 @@ SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             if(strcmp(slot->base->protocol->name, decoder_name) == 0) {
-                result = (SubGhzProtocolDecoderBase*)slot->base;
+                result = slot->base;
                 break;
             }
         }
@@ -35,6 +35,20 @@ void subghz_receiver_free(SubGhzReceiver* instance);
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * Every decoder gets the block at once, rx callback is called while decoder is fed.
+ * Decodes and their order are the same as with subghz_receiver_decode called for
+ * every pair, reset from rx callback included.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param pairs Levels and durations, no reset markers
+ * @param pairs_count Number of pairs
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pairs,
+    size_t pairs_count);
+
 /**
  * Reset decoder SubGhzReceiver.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -4,6 +4,7 @@
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
+#include "subghz_raw_binary.h"
 
 #define TAG "SubGhzFileEncoderWorker"
 
@@ -21,6 +22,8 @@ struct SubGhzFileEncoderWorker {
     bool is_storage_slow;
     FuriString* str_data;
     FuriString* file_path;
+    SubGhzRawBinaryReader* binary_reader;
+    int32_t* binary_samples;
     const SubGhzDevice* device;
 
     SubGhzFileEncoderWorkerCallbackEnd callback_end;
@@ -141,8 +144,13 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
             break;
         }
 
-        //skip the end of the previous line "\n"
-        stream_seek(stream, 1, StreamOffsetFromCurrent);
+        // Binary payload is read in blocks, text RAW_Data line by line
+        if(subghz_raw_binary_reader_start(instance->binary_reader, instance->flipper_format)) {
+            instance->binary_samples = malloc(sizeof(int32_t) * SUBGHZ_FILE_ENCODER_LOAD);
+        } else {
+            //skip the end of the previous line "\n"
+            stream_seek(stream, 1, StreamOffsetFromCurrent);
+        }
         res = true;
         instance->worker_stopping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -151,7 +159,19 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
+            if(instance->binary_samples) {
+                size_t count = subghz_raw_binary_reader_read(
+                    instance->binary_reader, instance->binary_samples, SUBGHZ_FILE_ENCODER_LOAD);
+                if(!count) {
+                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                    break;
+                }
+                size_t size = count * sizeof(int32_t);
+                if(furi_stream_buffer_send(
+                       instance->stream, instance->binary_samples, size, 100) != size) {
+                    FURI_LOG_E(TAG, "Invalid add duration in the stream");
+                }
+            } else if(stream_read_line(stream, instance->str_data)) {
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
@@ -185,6 +205,8 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         furi_delay_ms(50);
     }
     flipper_format_file_close(instance->flipper_format);
+    free(instance->binary_samples);
+    instance->binary_samples = NULL;
 
     FURI_LOG_I(TAG, "Worker stop");
     return 0;
@@ -202,6 +224,7 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc(void) {
 
     instance->str_data = furi_string_alloc();
     instance->file_path = furi_string_alloc();
+    instance->binary_reader = subghz_raw_binary_reader_alloc();
     instance->worker_stopping = true;
 
     return instance;
@@ -215,6 +238,7 @@ void subghz_file_encoder_worker_free(SubGhzFileEncoderWorker* instance) {
 
     furi_string_free(instance->str_data);
     furi_string_free(instance->file_path);
+    subghz_raw_binary_reader_free(instance->binary_reader);
 
     flipper_format_free(instance->flipper_format);
     furi_record_close(RECORD_STORAGE);
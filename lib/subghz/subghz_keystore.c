@@ -6,10 +6,13 @@
 
 #include <storage/storage.h>
 #include <toolbox/hex.h>
+#include <toolbox/crc32_calc.h>
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 
+#include "protocols/keeloq_common.h"
+
 #define TAG "SubGhzKeystore"
 
 #define FILE_BUFFER_SIZE 64
@@ -22,15 +25,55 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_COMPILED_EXTENSION ".cache"
+#define SUBGHZ_KEYSTORE_COMPILED_MAGIC     0x434B4753 // "SGKC"
+#define SUBGHZ_KEYSTORE_COMPILED_VERSION   1
+#define SUBGHZ_KEYSTORE_COMPILED_ALIGN     16
+#define SUBGHZ_KEYSTORE_COMPILED_NO_NAME   UINT32_MAX
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
 } SubGhzKeystoreEncryption;
 
+/** Compiled keystore: decrypted and parsed keys of one keystore file
+ *
+ * Header is followed by payload encrypted with the same enclave key slot as
+ * the source: key_count records, then pool of zero terminated names, every
+ * manufacture name stored once. Payload is padded to AES block size.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t source_size; /**< Source keystore size, cache is stale on mismatch */
+    uint32_t source_timestamp; /**< Source keystore timestamp, same as above */
+    uint32_t key_count;
+    uint32_t pool_size;
+    uint32_t crc; /**< Decrypted payload CRC32 */
+    uint32_t reserved;
+    uint8_t iv[16];
+} SubGhzKeystoreCompiledHeader;
+
+typedef struct {
+    uint64_t key;
+    uint32_t name_offset; /**< Offset of name in pool */
+    uint16_t type;
+    uint16_t reserved;
+} SubGhzKeystoreCompiledRecord;
+
+_Static_assert(
+    sizeof(SubGhzKeystoreCompiledHeader) % SUBGHZ_KEYSTORE_COMPILED_ALIGN == 0,
+    "Compiled keystore header must be block aligned");
+_Static_assert(
+    sizeof(SubGhzKeystoreCompiledRecord) == SUBGHZ_KEYSTORE_COMPILED_ALIGN,
+    "Compiled keystore record must be one block");
+
 SubGhzKeystore* subghz_keystore_alloc(void) {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    memset(&instance->index, 0, sizeof(SubGhzKeystoreIndex));
 
     subghz_keystore_reset_kl(instance);
 
@@ -44,6 +87,229 @@ void subghz_keystore_reset_kl(SubGhzKeystore* instance) {
     instance->kl_type = 0;
 }
 
+static void subghz_keystore_index_clear(SubGhzKeystoreIndex* index) {
+    free(index->mf_names);
+    free(index->mf_id);
+    free(index->mf_keys);
+    free(index->mf_offset);
+    free(index->type_keys);
+    memset(index, 0, sizeof(SubGhzKeystoreIndex));
+}
+
+typedef struct {
+    const char* name;
+    uint16_t key_index;
+} SubGhzKeystoreIndexName;
+
+static int subghz_keystore_index_compare_name(const void* a, const void* b) {
+    const SubGhzKeystoreIndexName* name_a = a;
+    const SubGhzKeystoreIndexName* name_b = b;
+    int ret = strcmp(name_a->name, name_b->name);
+    // Keep file order inside of manufacture
+    if(ret == 0) ret = (int)name_a->key_index - (int)name_b->key_index;
+    return ret;
+}
+
+static void subghz_keystore_index_build(SubGhzKeystore* instance) {
+    SubGhzKeystoreIndex* index = &instance->index;
+    subghz_keystore_index_clear(index);
+
+    size_t key_count = SubGhzKeyArray_size(instance->data);
+    index->key_count = key_count;
+    if(key_count >= SUBGHZ_KEYSTORE_INDEX_NONE) {
+        FURI_LOG_W(
+            TAG, "Too many keys, only first %u are indexed", SUBGHZ_KEYSTORE_INDEX_NONE - 1);
+        key_count = SUBGHZ_KEYSTORE_INDEX_NONE - 1;
+    }
+
+    index->mf_id = malloc(sizeof(uint16_t) * (key_count + 1));
+    index->mf_keys = malloc(sizeof(uint16_t) * (key_count + 1));
+    index->type_keys = malloc(sizeof(uint16_t) * (key_count + 1));
+
+    // Manufactures: sort keys by name, equal names get the same id
+    SubGhzKeystoreIndexName* names = malloc(sizeof(SubGhzKeystoreIndexName) * (key_count + 1));
+    for(size_t i = 0; i < key_count; i++) {
+        names[i].name = furi_string_get_cstr(SubGhzKeyArray_cget(instance->data, i)->name);
+        names[i].key_index = i;
+    }
+    qsort(names, key_count, sizeof(SubGhzKeystoreIndexName), subghz_keystore_index_compare_name);
+
+    index->mf_names = malloc(sizeof(const char*) * (key_count + 1));
+    index->mf_offset = malloc(sizeof(uint16_t) * (key_count + 2));
+    for(size_t i = 0; i < key_count; i++) {
+        if(i == 0 || strcmp(names[i - 1].name, names[i].name) != 0) {
+            index->mf_offset[index->mf_count] = i;
+            index->mf_names[index->mf_count] = names[i].name;
+            index->mf_count++;
+        }
+        index->mf_keys[i] = names[i].key_index;
+        index->mf_id[names[i].key_index] = index->mf_count - 1;
+    }
+    index->mf_offset[index->mf_count] = key_count;
+    free(names);
+
+    // Learning types: stable counting sort, unsupported types go to the last group
+    uint16_t type_count[SUBGHZ_KEYSTORE_LEARNING_MAX + 2] = {0};
+    for(size_t i = 0; i < key_count; i++) {
+        uint16_t type = SubGhzKeyArray_cget(instance->data, i)->type;
+        type_count[MIN(type, SUBGHZ_KEYSTORE_LEARNING_MAX + 1)]++;
+    }
+    uint16_t offset = 0;
+    for(size_t i = 0; i < COUNT_OF(type_count); i++) {
+        index->type_offset[i] = offset;
+        offset += type_count[i];
+        type_count[i] = index->type_offset[i];
+    }
+    for(size_t i = 0; i < key_count; i++) {
+        uint16_t type = SubGhzKeyArray_cget(instance->data, i)->type;
+        index->type_keys[type_count[MIN(type, SUBGHZ_KEYSTORE_LEARNING_MAX + 1)]++] = i;
+    }
+
+    FURI_LOG_D(TAG, "Indexed %zu keys, %u manufactures", key_count, index->mf_count);
+}
+
+const SubGhzKeystoreIndex* subghz_keystore_get_index(SubGhzKeystore* instance) {
+    furi_assert(instance);
+
+    SubGhzKeystoreIndex* index = &instance->index;
+    if(!index->mf_id || index->key_count != SubGhzKeyArray_size(instance->data)) {
+        subghz_keystore_index_build(instance);
+    }
+
+    return index;
+}
+
+uint16_t subghz_keystore_get_manufacture_id(SubGhzKeystore* instance, const char* name) {
+    furi_assert(instance);
+    furi_assert(name);
+
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(instance);
+    size_t low = 0;
+    size_t high = index->mf_count;
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        int ret = strcmp(index->mf_names[mid], name);
+        if(ret == 0) {
+            return mid;
+        } else if(ret < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return SUBGHZ_KEYSTORE_INDEX_NONE;
+}
+
+const SubGhzKeystoreCacheEntry*
+    subghz_keystore_cache_find(SubGhzKeystore* instance, uint32_t fix, uint32_t seed) {
+    furi_assert(instance);
+
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(instance);
+    for(size_t i = 0; i < index->cache_count; i++) {
+        const SubGhzKeystoreCacheEntry* entry = &index->cache[i];
+        if(entry->seed != seed) continue;
+        if(entry->key_index == SUBGHZ_KEYSTORE_INDEX_NONE) {
+            if(entry->fix == fix) return entry;
+        } else if(((entry->fix ^ fix) & SUBGHZ_KEYSTORE_SERIAL_MASK) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+void subghz_keystore_cache_put(SubGhzKeystore* instance, const SubGhzKeystoreCacheEntry* entry) {
+    furi_assert(instance);
+    furi_assert(entry);
+
+    SubGhzKeystoreIndex* index = &instance->index;
+    for(size_t i = 0; i < index->cache_count; i++) {
+        SubGhzKeystoreCacheEntry* item = &index->cache[i];
+        if(item->seed == entry->seed &&
+           ((item->fix ^ entry->fix) & SUBGHZ_KEYSTORE_SERIAL_MASK) == 0 &&
+           (item->key_index != SUBGHZ_KEYSTORE_INDEX_NONE || item->fix == entry->fix)) {
+            *item = *entry;
+            return;
+        }
+    }
+
+    // Round robin replacement, recent remotes are what receiver sees again
+    index->cache[index->cache_next] = *entry;
+    index->cache_next = (index->cache_next + 1) % SUBGHZ_KEYSTORE_CACHE_SIZE;
+    if(index->cache_count < SUBGHZ_KEYSTORE_CACHE_SIZE) index->cache_count++;
+}
+
+bool subghz_keystore_search_type(
+    SubGhzKeystore* instance,
+    uint8_t type,
+    const SubGhzKeystoreAttempt* attempts,
+    size_t attempts_count,
+    uint32_t fix,
+    uint32_t seed,
+    uint32_t hop,
+    SubGhzKeystoreCheckCallback callback,
+    void* context,
+    SubGhzKeystoreCacheEntry* match) {
+    furi_assert(instance);
+    furi_assert(attempts);
+    furi_assert(callback);
+    furi_assert(match);
+    furi_assert(type <= SUBGHZ_KEYSTORE_LEARNING_MAX);
+
+    subghz_keystore_get_index(instance);
+    SubGhzKeystoreIndex* index = &instance->index;
+    bool found = false;
+
+    for(size_t offset = index->type_offset[type]; offset < index->type_offset[type + 1];
+        offset += KEELOQ_BATCH_SIZE) {
+        size_t count = MIN(index->type_offset[type + 1] - offset, KEELOQ_BATCH_SIZE);
+        // Keys are in keystore order, nothing after current match is interesting
+        while(count && index->type_keys[offset + count - 1] >= match->key_index) {
+            count--;
+        }
+        if(!count) break;
+
+        for(size_t i = 0; i < count; i++) {
+            index->batch_key[i] =
+                SubGhzKeyArray_cget(instance->data, index->type_keys[offset + i])->key;
+        }
+
+        // Every next attempt is only interesting for keys before the matched one
+        size_t limit = count;
+        for(size_t a = 0; a < attempts_count && limit; a++) {
+            const uint64_t* key = index->batch_key;
+            if(attempts[a].mirrored) {
+                for(size_t i = 0; i < limit; i++) {
+                    index->batch_man[i] = __builtin_bswap64(index->batch_key[i]);
+                }
+                key = index->batch_man;
+            }
+            subghz_protocol_keeloq_common_learning_batch(
+                attempts[a].learning, fix, seed, key, index->batch_man, limit);
+            subghz_protocol_keeloq_common_decrypt_batch(
+                hop, index->batch_man, index->batch_decrypt, limit);
+
+            for(size_t i = 0; i < limit; i++) {
+                uint16_t key_index = index->type_keys[offset + i];
+                if(callback(context, index->batch_decrypt[i], key_index)) {
+                    match->key_index = key_index;
+                    match->learning = attempts[a].learning;
+                    match->mirrored = attempts[a].mirrored;
+                    match->man = index->batch_man[i];
+                    limit = i;
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        if(found) break;
+    }
+
+    return found;
+}
+
 void subghz_keystore_free(SubGhzKeystore* instance) {
     furi_assert(instance);
 
@@ -53,6 +319,7 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
+    subghz_keystore_index_clear(&instance->index);
 
     free(instance);
 }
@@ -86,11 +353,12 @@ static bool subghz_keystore_process_line(SubGhzKeystore* instance, char* line) {
 
 static void subghz_keystore_mess_with_iv(uint8_t* iv) {
     // Alignment check for `ldrd` instruction
-    furi_assert(((uint32_t)iv) % 4 == 0);
+    furi_assert(((uintptr_t)iv) % 4 == 0);
     // Please do not share decrypted manufacture keys
     // Sharing them will bring some discomfort to legal owners
     // And potential legal action against you
     // While you reading this code think about your own personal responsibility
+#ifndef FURI_HOST
     asm volatile("nani%=:                  \n"
                  "ldrd  r0, r2, [%0, #0x0] \n"
                  "lsl   r1, r0, #8         \n"
@@ -110,6 +378,11 @@ static void subghz_keystore_mess_with_iv(uint8_t* iv) {
                  :
                  : "r"(iv)
                  : "r0", "r1", "r2", "r3", "memory");
+#else
+    for(size_t i = 15; i > 0; i--) {
+        iv[i] += iv[i - 1];
+    }
+#endif
 }
 
 static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream, uint8_t* iv) {
@@ -190,6 +463,232 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
     return result;
 }
 
+static void subghz_keystore_compiled_get_path(FuriString* path, const char* file_name) {
+    furi_string_printf(path, "%s" SUBGHZ_KEYSTORE_COMPILED_EXTENSION, file_name);
+}
+
+static bool subghz_keystore_compiled_get_source_info(
+    Storage* storage,
+    const char* file_name,
+    uint32_t* size,
+    uint32_t* timestamp) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, file_name, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, file_name, timestamp) != FSE_OK) return false;
+    *size = file_info.size;
+    return true;
+}
+
+static bool subghz_keystore_compiled_crypt(
+    SubGhzKeystoreCompiledHeader* header,
+    uint8_t* payload,
+    size_t payload_size,
+    bool encrypt) {
+    uint8_t iv[16];
+    memcpy(iv, header->iv, sizeof(iv));
+    subghz_keystore_mess_with_iv(iv);
+
+    if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+        FURI_LOG_E(TAG, "Unable to load encryption key");
+        return false;
+    }
+    // In place, payload is processed block by block
+    bool result = encrypt ? furi_hal_crypto_encrypt(payload, payload, payload_size) :
+                            furi_hal_crypto_decrypt(payload, payload, payload_size);
+    furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+
+    if(!result) FURI_LOG_E(TAG, "Compiled keystore crypto failed");
+    return result;
+}
+
+static bool subghz_keystore_load_compiled(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* file_name) {
+    bool result = false;
+    SubGhzKeystoreCompiledHeader header;
+    uint32_t source_size = 0;
+    uint32_t source_timestamp = 0;
+    uint8_t* payload = NULL;
+    size_t payload_size = 0;
+
+    FuriString* path = furi_string_alloc();
+    subghz_keystore_compiled_get_path(path, file_name);
+    File* file = storage_file_alloc(storage);
+
+    do {
+        if(!subghz_keystore_compiled_get_source_info(
+               storage, file_name, &source_size, &source_timestamp)) {
+            break;
+        }
+        if(!storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        if(header.magic != SUBGHZ_KEYSTORE_COMPILED_MAGIC ||
+           header.version != SUBGHZ_KEYSTORE_COMPILED_VERSION ||
+           header.record_size != sizeof(SubGhzKeystoreCompiledRecord)) {
+            FURI_LOG_W(TAG, "Compiled keystore version mismatch");
+            break;
+        }
+        if(header.source_size != source_size || header.source_timestamp != source_timestamp) {
+            FURI_LOG_I(TAG, "Compiled keystore is stale");
+            break;
+        }
+
+        payload_size = (size_t)header.key_count * sizeof(SubGhzKeystoreCompiledRecord) +
+                       header.pool_size;
+        if(header.key_count == 0 || header.pool_size == 0 ||
+           header.pool_size % SUBGHZ_KEYSTORE_COMPILED_ALIGN != 0 ||
+           storage_file_size(file) != sizeof(header) + payload_size) {
+            FURI_LOG_E(TAG, "Compiled keystore is malformed");
+            break;
+        }
+
+        // Whole keystore in one read and one decrypt
+        payload = malloc(payload_size);
+        if(storage_file_read(file, payload, payload_size) != payload_size) {
+            FURI_LOG_E(TAG, "Compiled keystore read failed");
+            break;
+        }
+        if(!subghz_keystore_compiled_crypt(&header, payload, payload_size, false)) break;
+        if(crc32_calc_buffer(0, payload, payload_size) != header.crc) {
+            FURI_LOG_E(TAG, "Compiled keystore checksum mismatch");
+            break;
+        }
+
+        const SubGhzKeystoreCompiledRecord* records = (const SubGhzKeystoreCompiledRecord*)payload;
+        const char* pool = (const char*)&records[header.key_count];
+        if(pool[header.pool_size - 1] != '\0') break;
+
+        bool valid = true;
+        for(size_t i = 0; i < header.key_count; i++) {
+            if(records[i].name_offset >= header.pool_size) {
+                valid = false;
+                break;
+            }
+        }
+        if(!valid) {
+            FURI_LOG_E(TAG, "Compiled keystore name is out of pool");
+            break;
+        }
+
+        SubGhzKeyArray_reserve(
+            instance->data, SubGhzKeyArray_size(instance->data) + header.key_count);
+        for(size_t i = 0; i < header.key_count; i++) {
+            subghz_keystore_add_key(
+                instance, &pool[records[i].name_offset], records[i].key, records[i].type);
+        }
+
+        FURI_LOG_I(TAG, "Loaded %lu keys from compiled keystore", header.key_count);
+        result = true;
+    } while(false);
+
+    if(payload) {
+        // Please do not share decrypted manufacture keys
+        memset(payload, 0, payload_size);
+        free(payload);
+    }
+    storage_file_free(file);
+    furi_string_free(path);
+
+    return result;
+}
+
+static void subghz_keystore_save_compiled(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* file_name,
+    size_t key_start) {
+    size_t key_count = SubGhzKeyArray_size(instance->data) - key_start;
+    SubGhzKeystoreCompiledHeader header = {
+        .magic = SUBGHZ_KEYSTORE_COMPILED_MAGIC,
+        .version = SUBGHZ_KEYSTORE_COMPILED_VERSION,
+        .record_size = sizeof(SubGhzKeystoreCompiledRecord),
+        .key_count = key_count,
+    };
+    if(!key_count || !subghz_keystore_compiled_get_source_info(
+                         storage, file_name, &header.source_size, &header.source_timestamp)) {
+        return;
+    }
+
+    // Intern names through keystore index: one pool entry per manufacture
+    const SubGhzKeystoreIndex* index = subghz_keystore_get_index(instance);
+    uint32_t* mf_offset = malloc(sizeof(uint32_t) * (index->mf_count + 1));
+    for(size_t i = 0; i < index->mf_count; i++) {
+        mf_offset[i] = SUBGHZ_KEYSTORE_COMPILED_NO_NAME;
+    }
+
+    size_t pool_size = 0;
+    for(size_t i = key_start; i < key_start + key_count; i++) {
+        bool interned = i < SUBGHZ_KEYSTORE_INDEX_NONE - 1;
+        if(interned && mf_offset[index->mf_id[i]] != SUBGHZ_KEYSTORE_COMPILED_NO_NAME) continue;
+        if(interned) mf_offset[index->mf_id[i]] = pool_size;
+        pool_size += furi_string_size(SubGhzKeyArray_cget(instance->data, i)->name) + 1;
+    }
+    pool_size = (pool_size + SUBGHZ_KEYSTORE_COMPILED_ALIGN - 1) / SUBGHZ_KEYSTORE_COMPILED_ALIGN *
+                SUBGHZ_KEYSTORE_COMPILED_ALIGN;
+    header.pool_size = pool_size;
+
+    size_t payload_size = key_count * sizeof(SubGhzKeystoreCompiledRecord) + pool_size;
+    uint8_t* payload = malloc(payload_size);
+    memset(payload, 0, payload_size);
+    SubGhzKeystoreCompiledRecord* records = (SubGhzKeystoreCompiledRecord*)payload;
+    char* pool = (char*)&records[key_count];
+
+    size_t pool_cursor = 0;
+    for(size_t i = 0; i < key_count; i++) {
+        size_t key_index = key_start + i;
+        const SubGhzKey* key = SubGhzKeyArray_cget(instance->data, key_index);
+        uint32_t name_offset = pool_cursor;
+        if(key_index < SUBGHZ_KEYSTORE_INDEX_NONE - 1) {
+            name_offset = mf_offset[index->mf_id[key_index]];
+        }
+        if(name_offset == pool_cursor) {
+            size_t name_size = furi_string_size(key->name) + 1;
+            memcpy(&pool[pool_cursor], furi_string_get_cstr(key->name), name_size);
+            pool_cursor += name_size;
+        }
+        records[i].key = key->key;
+        records[i].name_offset = name_offset;
+        records[i].type = key->type;
+    }
+    free(mf_offset);
+
+    header.crc = crc32_calc_buffer(0, payload, payload_size);
+    furi_hal_random_fill_buf(header.iv, sizeof(header.iv));
+
+    FuriString* path = furi_string_alloc();
+    subghz_keystore_compiled_get_path(path, file_name);
+    File* file = storage_file_alloc(storage);
+
+    bool result = false;
+    do {
+        if(!subghz_keystore_compiled_crypt(&header, payload, payload_size, true)) break;
+        if(!storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", furi_string_get_cstr(path));
+            break;
+        }
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(file, payload, payload_size) != payload_size) break;
+        result = true;
+    } while(false);
+    storage_file_close(file);
+
+    if(result) {
+        FURI_LOG_I(TAG, "Compiled %zu keys to %s", key_count, furi_string_get_cstr(path));
+    } else {
+        FURI_LOG_E(TAG, "Unable to save compiled keystore");
+        storage_simply_remove(storage, furi_string_get_cstr(path));
+    }
+
+    memset(payload, 0, payload_size);
+    free(payload);
+    storage_file_free(file);
+    furi_string_free(path);
+}
+
 bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     furi_assert(instance);
     bool result = false;
@@ -203,9 +702,14 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     FURI_LOG_I(TAG, "Loading keystore %s", file_name);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
+    size_t key_start = SubGhzKeyArray_size(instance->data);
 
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
     do {
+        if(subghz_keystore_load_compiled(instance, storage, file_name)) {
+            result = true;
+            break;
+        }
         if(!flipper_format_file_open_existing(flipper_format, file_name)) {
             FURI_LOG_E(TAG, "Unable to open file for read: %s", file_name);
             break;
@@ -235,6 +739,8 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
             }
             subghz_keystore_mess_with_iv(iv);
             result = subghz_keystore_read_file(instance, stream, iv);
+            // Decrypt and parse only once, next time keys come from compiled keystore
+            if(result) subghz_keystore_save_compiled(instance, storage, file_name, key_start);
         } else {
             FURI_LOG_E(TAG, "Unknown encryption");
             break;
@@ -246,6 +752,8 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
 
     furi_string_free(filetype);
 
+    if(result) subghz_keystore_get_index(instance);
+
     return result;
 }
 
@@ -257,6 +765,12 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
     char* decrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
     char* encrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE);
 
+    // Compiled keystore of previous content must not outlive it
+    FuriString* compiled_path = furi_string_alloc();
+    subghz_keystore_compiled_get_path(compiled_path, file_name);
+    storage_common_remove(storage, furi_string_get_cstr(compiled_path));
+    furi_string_free(compiled_path);
+
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
     do {
         if(!flipper_format_file_open_always(flipper_format, file_name)) {
@@ -34,6 +34,8 @@ void subghz_keystore_free(SubGhzKeystore* instance);
 
 /** 
  * Loading manufacture key from file
+ * Encrypted keystore is compiled to `<filename>.cache` after first load,
+ * following loads read it while source file is unchanged
  * @param instance Pointer to a SubGhzKeystore instance
  * @param filename Full path to the file
  */
@@ -2,8 +2,138 @@
 
 #include <m-array.h>
 
+#include "protocols/keeloq_common.h"
+
+#define SUBGHZ_KEYSTORE_INDEX_NONE    UINT16_MAX
+#define SUBGHZ_KEYSTORE_LEARNING_MAX  8u
+#define SUBGHZ_KEYSTORE_CACHE_SIZE    16u
+#define SUBGHZ_KEYSTORE_SERIAL_MASK   0x0FFFFFFFu
+
+/** Outcome of a key search for one remote, remembered between frames */
+typedef struct {
+    uint32_t fix; /**< Fix part of the parcel the search was made for */
+    uint32_t seed; /**< Seed used by secure learning */
+    uint64_t man; /**< Derived manufacture key that matched */
+    uint16_t key_index; /**< Matched key, SUBGHZ_KEYSTORE_INDEX_NONE if none did */
+    uint8_t learning; /**< Learning type that matched, KEELOQ_LEARNING_* */
+    bool mirrored; /**< Matched with byte-mirrored manufacture key */
+} SubGhzKeystoreCacheEntry;
+
+/** Lookup structures built over keystore data after load */
+typedef struct {
+    size_t key_count; /**< Keys covered, index is stale when data size differs */
+
+    /** Interned manufacture names: sorted, pointing to first key name with this value */
+    const char** mf_names;
+    uint16_t mf_count;
+    /** Manufacture id of every key */
+    uint16_t* mf_id;
+    /** Key indexes grouped by manufacture id, mf_offset has mf_count + 1 items */
+    uint16_t* mf_keys;
+    uint16_t* mf_offset;
+
+    /** Key indexes grouped by learning type, ascending inside of group */
+    uint16_t* type_keys;
+    uint16_t type_offset[SUBGHZ_KEYSTORE_LEARNING_MAX + 2];
+
+    SubGhzKeystoreCacheEntry cache[SUBGHZ_KEYSTORE_CACHE_SIZE];
+    uint8_t cache_count;
+    uint8_t cache_next;
+
+    /** Scratch for batch search, kept off decoder thread stack */
+    uint64_t batch_key[KEELOQ_BATCH_SIZE];
+    uint64_t batch_man[KEELOQ_BATCH_SIZE];
+    uint32_t batch_decrypt[KEELOQ_BATCH_SIZE];
+} SubGhzKeystoreIndex;
+
+/** Manufacture key derivation tried by batch search */
+typedef struct {
+    uint8_t learning; /**< KEELOQ_LEARNING_* */
+    bool mirrored; /**< Use byte-mirrored manufacture key */
+} SubGhzKeystoreAttempt;
+
+/** Decrypted hop validation
+ *
+ * @param      context    Callback context
+ * @param      decrypt    Decrypted hop
+ * @param      key_index  Index of key in keystore data
+ *
+ * @return     true if decrypted hop is valid
+ */
+typedef bool (*SubGhzKeystoreCheckCallback)(void* context, uint32_t decrypt, uint16_t key_index);
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
     const char* mfname;
     uint8_t kl_type;
+    SubGhzKeystoreIndex index;
 };
+
+/** Get keystore index, rebuilding it if keys were added since last build
+ *
+ * @param      instance  Pointer to a SubGhzKeystore instance
+ *
+ * @return     Pointer to a SubGhzKeystoreIndex instance
+ */
+const SubGhzKeystoreIndex* subghz_keystore_get_index(SubGhzKeystore* instance);
+
+/** Get interned manufacture id by name
+ *
+ * @param      instance  Pointer to a SubGhzKeystore instance
+ * @param      name      Manufacture name
+ *
+ * @return     Manufacture id or SUBGHZ_KEYSTORE_INDEX_NONE if no key has such name
+ */
+uint16_t subghz_keystore_get_manufacture_id(SubGhzKeystore* instance, const char* name);
+
+/** Find cached search outcome for remote
+ *
+ * Positive outcome is shared by all buttons of the remote (same serial),
+ * negative outcome is only valid for exactly the same fix part.
+ *
+ * @param      instance  Pointer to a SubGhzKeystore instance
+ * @param      fix       Fix part of the parcel
+ * @param      seed      Seed
+ *
+ * @return     Pointer to a cache entry or NULL
+ */
+const SubGhzKeystoreCacheEntry*
+    subghz_keystore_cache_find(SubGhzKeystore* instance, uint32_t fix, uint32_t seed);
+
+/** Remember search outcome for remote, replaces previous outcome for the same serial
+ *
+ * @param      instance  Pointer to a SubGhzKeystore instance
+ * @param      entry     Outcome to remember
+ */
+void subghz_keystore_cache_put(SubGhzKeystore* instance, const SubGhzKeystoreCacheEntry* entry);
+
+/** Search keys of one learning type for the first one in keystore order matching hop
+ *
+ * Keys are checked KEELOQ_BATCH_SIZE at once with bitsliced decrypt, attempts are tried
+ * in given order for every key. Only keys before match->key_index are checked, match is
+ * updated when earlier key is found, so groups can be searched one by one.
+ *
+ * @param      instance        Pointer to a SubGhzKeystore instance
+ * @param      type            Learning type of keys to search, KEELOQ_LEARNING_*
+ * @param      attempts        Derivations to try for every key
+ * @param      attempts_count  Number of attempts
+ * @param      fix             Fix part of the parcel
+ * @param      seed            Seed
+ * @param      hop             Hop encrypted part of the parcel
+ * @param      callback        Decrypted hop validation
+ * @param      context         Callback context
+ * @param      match           Best match so far, updated on success
+ *
+ * @return     true if earlier matching key was found
+ */
+bool subghz_keystore_search_type(
+    SubGhzKeystore* instance,
+    uint8_t type,
+    const SubGhzKeystoreAttempt* attempts,
+    size_t attempts_count,
+    uint32_t fix,
+    uint32_t seed,
+    uint32_t hop,
+    SubGhzKeystoreCheckCallback callback,
+    void* context,
+    SubGhzKeystoreCacheEntry* match);
@@ -0,0 +1,560 @@
+#include "subghz_raw_binary.h"
+#include "types.h"
+
+#include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/stream.h>
+#include <toolbox/compress.h>
+#include <toolbox/varint.h>
+
+#define TAG "SubGhzRawBinary"
+
+#define SUBGHZ_RAW_BINARY_MAGIC           0x42524753 // "SGRB"
+#define SUBGHZ_RAW_BINARY_FLAG_COMPRESSED (1 << 0)
+#define SUBGHZ_RAW_BINARY_VARINT_MAX      5
+#define SUBGHZ_RAW_BINARY_BLOCK_DATA_SIZE \
+    (SUBGHZ_RAW_BINARY_BLOCK_SAMPLES * SUBGHZ_RAW_BINARY_VARINT_MAX)
+// Compress header or stored data marker, one byte of slack for uncompressed decode
+#define SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE (SUBGHZ_RAW_BINARY_BLOCK_DATA_SIZE + 8)
+
+/** Payload header, offsets are relative to its start */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t flags;
+    uint16_t block_samples;
+    uint32_t sample_count; /**< 0 until finished */
+    uint32_t block_count; /**< 0 until finished */
+    uint32_t index_offset; /**< Block offsets, uint32_t each, 0 until finished */
+} SubGhzRawBinaryHeader;
+
+_Static_assert(sizeof(SubGhzRawBinaryHeader) == 20, "Incorrect SubGhzRawBinaryHeader size");
+
+/** Block header, followed by data_size bytes of varint deltas, compressed if flag is set */
+typedef struct {
+    uint16_t samples;
+    uint16_t data_size;
+} SubGhzRawBinaryBlock;
+
+_Static_assert(sizeof(SubGhzRawBinaryBlock) == 4, "Incorrect SubGhzRawBinaryBlock size");
+
+struct SubGhzRawBinaryWriter {
+    Stream* stream;
+    size_t base;
+    SubGhzRawBinaryHeader header;
+    Compress* compress;
+
+    int32_t samples[SUBGHZ_RAW_BINARY_BLOCK_SAMPLES];
+    size_t samples_count;
+    uint8_t* data;
+    uint8_t* store;
+
+    uint32_t* offsets;
+    size_t offsets_capacity;
+};
+
+struct SubGhzRawBinaryReader {
+    Stream* stream;
+    size_t base;
+    SubGhzRawBinaryHeader header;
+    Compress* compress;
+
+    int32_t* samples;
+    size_t samples_count;
+    size_t samples_pos;
+    uint8_t* data;
+    uint8_t* store;
+
+    size_t block; /**< Next block number */
+    size_t block_offset; /**< Next block offset */
+};
+
+/** Deltas are taken against sample of the same level, two samples back */
+static size_t subghz_raw_binary_pack(const int32_t* samples, size_t count, uint8_t* output) {
+    int32_t history[2] = {0, 0};
+    size_t size = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        size += varint_int32_pack(samples[i] - history[1], &output[size]);
+        history[1] = history[0];
+        history[0] = samples[i];
+    }
+
+    return size;
+}
+
+static bool subghz_raw_binary_unpack(
+    const uint8_t* input,
+    size_t input_size,
+    int32_t* samples,
+    size_t count) {
+    int32_t history[2] = {0, 0};
+    size_t offset = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        size_t left = MIN(input_size - offset, (size_t)SUBGHZ_RAW_BINARY_VARINT_MAX);
+        if(!left) return false;
+
+        int32_t delta = 0;
+        size_t used = varint_int32_unpack(&delta, &input[offset], left);
+        if(used > left) return false;
+        offset += used;
+
+        samples[i] = history[1] + delta;
+        history[1] = history[0];
+        history[0] = samples[i];
+    }
+
+    return offset == input_size;
+}
+
+SubGhzRawBinaryWriter* subghz_raw_binary_writer_alloc(bool compress) {
+    SubGhzRawBinaryWriter* instance = malloc(sizeof(SubGhzRawBinaryWriter));
+
+    instance->data = malloc(SUBGHZ_RAW_BINARY_BLOCK_DATA_SIZE);
+    if(compress) {
+        instance->compress =
+            compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+        instance->store = malloc(SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE);
+        instance->header.flags |= SUBGHZ_RAW_BINARY_FLAG_COMPRESSED;
+    }
+
+    return instance;
+}
+
+void subghz_raw_binary_writer_free(SubGhzRawBinaryWriter* instance) {
+    furi_check(instance);
+
+    if(instance->compress) {
+        compress_free(instance->compress);
+        free(instance->store);
+    }
+    free(instance->data);
+    free(instance->offsets);
+    free(instance);
+}
+
+static bool subghz_raw_binary_writer_write_header(SubGhzRawBinaryWriter* instance) {
+    return stream_write(
+               instance->stream, (const uint8_t*)&instance->header, sizeof(instance->header)) ==
+           sizeof(instance->header);
+}
+
+bool subghz_raw_binary_writer_start(
+    SubGhzRawBinaryWriter* instance,
+    FlipperFormat* flipper_format) {
+    furi_check(instance);
+    furi_check(flipper_format);
+
+    instance->stream = flipper_format_get_raw_stream(flipper_format);
+    instance->header.magic = SUBGHZ_RAW_BINARY_MAGIC;
+    instance->header.version = SUBGHZ_RAW_BINARY_VERSION;
+    instance->header.block_samples = SUBGHZ_RAW_BINARY_BLOCK_SAMPLES;
+    instance->header.sample_count = 0;
+    instance->header.block_count = 0;
+    instance->header.index_offset = 0;
+    instance->samples_count = 0;
+
+    bool result = false;
+    do {
+        uint32_t version = SUBGHZ_RAW_BINARY_VERSION;
+        if(!flipper_format_write_uint32(flipper_format, SUBGHZ_RAW_BINARY_KEY, &version, 1)) {
+            FURI_LOG_E(TAG, "Unable to add " SUBGHZ_RAW_BINARY_KEY);
+            break;
+        }
+        instance->base = stream_tell(instance->stream);
+        if(!subghz_raw_binary_writer_write_header(instance)) {
+            FURI_LOG_E(TAG, "Unable to write header");
+            break;
+        }
+        result = true;
+    } while(false);
+
+    return result;
+}
+
+static bool subghz_raw_binary_writer_flush(SubGhzRawBinaryWriter* instance) {
+    if(!instance->samples_count) return true;
+
+    if(instance->header.block_count == instance->offsets_capacity) {
+        instance->offsets_capacity = MAX(instance->offsets_capacity * 2, 16U);
+        instance->offsets =
+            realloc(instance->offsets, instance->offsets_capacity * sizeof(uint32_t)); //-V701
+    }
+    instance->offsets[instance->header.block_count] =
+        stream_tell(instance->stream) - instance->base;
+
+    size_t data_size =
+        subghz_raw_binary_pack(instance->samples, instance->samples_count, instance->data);
+    const uint8_t* data = instance->data;
+    if(instance->compress) {
+        if(!compress_encode(
+               instance->compress,
+               instance->data,
+               data_size,
+               instance->store,
+               SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE,
+               &data_size)) {
+            FURI_LOG_E(TAG, "Unable to compress block");
+            return false;
+        }
+        data = instance->store;
+    }
+
+    SubGhzRawBinaryBlock block = {
+        .samples = instance->samples_count,
+        .data_size = data_size,
+    };
+    if(stream_write(instance->stream, (const uint8_t*)&block, sizeof(block)) != sizeof(block) ||
+       stream_write(instance->stream, data, data_size) != data_size) {
+        FURI_LOG_E(TAG, "Unable to write block");
+        return false;
+    }
+
+    instance->header.sample_count += instance->samples_count;
+    instance->header.block_count++;
+    instance->samples_count = 0;
+    return true;
+}
+
+bool subghz_raw_binary_writer_add(
+    SubGhzRawBinaryWriter* instance,
+    const int32_t* samples,
+    size_t count) {
+    furi_check(instance);
+    furi_check(instance->stream);
+    furi_check(samples || !count);
+
+    for(size_t i = 0; i < count; i++) {
+        int32_t sample = samples[i];
+        if((sample < -SUBGHZ_RAW_BINARY_DURATION_MAX) ||
+           (sample > SUBGHZ_RAW_BINARY_DURATION_MAX)) {
+            sample = sample > 0 ? 100 : -100;
+        }
+        instance->samples[instance->samples_count++] = sample;
+
+        if(instance->samples_count == SUBGHZ_RAW_BINARY_BLOCK_SAMPLES) {
+            if(!subghz_raw_binary_writer_flush(instance)) return false;
+        }
+    }
+
+    return true;
+}
+
+bool subghz_raw_binary_writer_finish(SubGhzRawBinaryWriter* instance) {
+    furi_check(instance);
+    furi_check(instance->stream);
+
+    bool result = false;
+    do {
+        if(!subghz_raw_binary_writer_flush(instance)) break;
+
+        instance->header.index_offset = stream_tell(instance->stream) - instance->base;
+        size_t index_size = instance->header.block_count * sizeof(uint32_t);
+        if(index_size &&
+           stream_write(instance->stream, (const uint8_t*)instance->offsets, index_size) !=
+               index_size) {
+            FURI_LOG_E(TAG, "Unable to write index");
+            break;
+        }
+
+        if(!stream_seek(instance->stream, instance->base, StreamOffsetFromStart)) break;
+        if(!subghz_raw_binary_writer_write_header(instance)) {
+            FURI_LOG_E(TAG, "Unable to update header");
+            break;
+        }
+        if(!stream_seek(instance->stream, 0, StreamOffsetFromEnd)) break;
+
+        result = true;
+    } while(false);
+
+    return result;
+}
+
+size_t subghz_raw_binary_writer_get_sample_count(SubGhzRawBinaryWriter* instance) {
+    furi_check(instance);
+    return instance->header.sample_count + instance->samples_count;
+}
+
+SubGhzRawBinaryReader* subghz_raw_binary_reader_alloc(void) {
+    // Buffers are allocated once payload is found, text files need none
+    SubGhzRawBinaryReader* instance = malloc(sizeof(SubGhzRawBinaryReader));
+    return instance;
+}
+
+void subghz_raw_binary_reader_free(SubGhzRawBinaryReader* instance) {
+    furi_check(instance);
+
+    if(instance->compress) {
+        compress_free(instance->compress);
+        free(instance->store);
+    }
+    free(instance->samples);
+    free(instance->data);
+    free(instance);
+}
+
+bool subghz_raw_binary_reader_start(
+    SubGhzRawBinaryReader* instance,
+    FlipperFormat* flipper_format) {
+    furi_check(instance);
+    furi_check(flipper_format);
+
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    size_t position = stream_tell(stream);
+
+    // Strict mode: text RAW_Data must not be scanned in search of the key
+    uint32_t version = 0;
+    flipper_format_set_strict_mode(flipper_format, true);
+    bool is_binary =
+        flipper_format_read_uint32(flipper_format, SUBGHZ_RAW_BINARY_KEY, &version, 1);
+    flipper_format_set_strict_mode(flipper_format, false);
+
+    bool result = false;
+    do {
+        if(!is_binary) break;
+        if(version != SUBGHZ_RAW_BINARY_VERSION) {
+            FURI_LOG_E(TAG, "Unsupported version %lu", version);
+            break;
+        }
+
+        // Payload starts right after end of line
+        uint8_t symbol = 0;
+        while(stream_read(stream, &symbol, 1) == 1 && symbol != '\n') {
+        }
+        if(symbol != '\n') break;
+
+        instance->stream = stream;
+        instance->base = stream_tell(stream);
+        if(stream_read(stream, (uint8_t*)&instance->header, sizeof(instance->header)) !=
+           sizeof(instance->header)) {
+            FURI_LOG_E(TAG, "Unable to read header");
+            break;
+        }
+        if(instance->header.magic != SUBGHZ_RAW_BINARY_MAGIC ||
+           instance->header.version != SUBGHZ_RAW_BINARY_VERSION ||
+           instance->header.block_samples != SUBGHZ_RAW_BINARY_BLOCK_SAMPLES) {
+            FURI_LOG_E(TAG, "Invalid header");
+            break;
+        }
+        if(!instance->header.index_offset) {
+            FURI_LOG_W(TAG, "Payload is not finished, reading sequentially");
+        }
+
+        if(!instance->samples) {
+            instance->samples = malloc(sizeof(int32_t) * SUBGHZ_RAW_BINARY_BLOCK_SAMPLES);
+            instance->data = malloc(SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE);
+        }
+        if((instance->header.flags & SUBGHZ_RAW_BINARY_FLAG_COMPRESSED) && !instance->compress) {
+            instance->compress =
+                compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+            instance->store = malloc(SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE);
+        }
+
+        instance->samples_count = 0;
+        instance->samples_pos = 0;
+        instance->block = 0;
+        instance->block_offset = sizeof(SubGhzRawBinaryHeader);
+        result = true;
+    } while(false);
+
+    if(!result) {
+        instance->stream = NULL;
+        stream_seek(stream, position, StreamOffsetFromStart);
+    }
+
+    return result;
+}
+
+static bool subghz_raw_binary_reader_load_block(SubGhzRawBinaryReader* instance) {
+    instance->samples_count = 0;
+    instance->samples_pos = 0;
+
+    // Unfinished payload is read until incomplete block or end of file
+    const SubGhzRawBinaryHeader* header = &instance->header;
+    if(header->index_offset && instance->block >= header->block_count) return false;
+
+    SubGhzRawBinaryBlock block;
+    if(!stream_seek(
+           instance->stream, instance->base + instance->block_offset, StreamOffsetFromStart) ||
+       stream_read(instance->stream, (uint8_t*)&block, sizeof(block)) != sizeof(block)) {
+        return false;
+    }
+    if(!block.samples || block.samples > SUBGHZ_RAW_BINARY_BLOCK_SAMPLES ||
+       block.data_size > SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE - 1) {
+        FURI_LOG_E(TAG, "Invalid block %zu", instance->block);
+        return false;
+    }
+    if(stream_read(instance->stream, instance->data, block.data_size) != block.data_size) {
+        return false;
+    }
+
+    const uint8_t* data = instance->data;
+    size_t data_size = block.data_size;
+    if(instance->compress) {
+        if(!compress_decode(
+               instance->compress,
+               instance->data,
+               block.data_size,
+               instance->store,
+               SUBGHZ_RAW_BINARY_BLOCK_STORE_SIZE,
+               &data_size)) {
+            FURI_LOG_E(TAG, "Unable to decompress block %zu", instance->block);
+            return false;
+        }
+        data = instance->store;
+    }
+
+    if(!subghz_raw_binary_unpack(data, data_size, instance->samples, block.samples)) {
+        FURI_LOG_E(TAG, "Corrupted block %zu", instance->block);
+        return false;
+    }
+
+    instance->samples_count = block.samples;
+    instance->block++;
+    instance->block_offset += sizeof(block) + block.data_size;
+    return true;
+}
+
+size_t subghz_raw_binary_reader_read(
+    SubGhzRawBinaryReader* instance,
+    int32_t* samples,
+    size_t count) {
+    furi_check(instance);
+    furi_check(samples || !count);
+
+    if(!instance->stream) return 0;
+
+    size_t read = 0;
+    while(read < count) {
+        if(instance->samples_pos == instance->samples_count) {
+            if(!subghz_raw_binary_reader_load_block(instance)) break;
+        }
+        size_t chunk = MIN(count - read, instance->samples_count - instance->samples_pos);
+        memcpy(
+            &samples[read], &instance->samples[instance->samples_pos], chunk * sizeof(int32_t));
+        instance->samples_pos += chunk;
+        read += chunk;
+    }
+
+    return read;
+}
+
+bool subghz_raw_binary_reader_seek(SubGhzRawBinaryReader* instance, size_t sample) {
+    furi_check(instance);
+
+    const SubGhzRawBinaryHeader* header = &instance->header;
+    if(!instance->stream || !header->index_offset || sample >= header->sample_count) {
+        return false;
+    }
+
+    size_t block = sample / SUBGHZ_RAW_BINARY_BLOCK_SAMPLES;
+    uint32_t block_offset = 0;
+    if(!stream_seek(
+           instance->stream,
+           instance->base + header->index_offset + block * sizeof(uint32_t),
+           StreamOffsetFromStart) ||
+       stream_read(instance->stream, (uint8_t*)&block_offset, sizeof(uint32_t)) !=
+           sizeof(uint32_t)) {
+        return false;
+    }
+
+    instance->block = block;
+    instance->block_offset = block_offset;
+    if(!subghz_raw_binary_reader_load_block(instance)) return false;
+    instance->samples_pos = sample % SUBGHZ_RAW_BINARY_BLOCK_SAMPLES;
+
+    return true;
+}
+
+size_t subghz_raw_binary_reader_get_sample_count(SubGhzRawBinaryReader* instance) {
+    furi_check(instance);
+    return instance->header.sample_count;
+}
+
+bool subghz_raw_binary_convert(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path,
+    bool compress) {
+    furi_check(storage);
+    furi_check(source_path);
+    furi_check(destination_path);
+
+    FlipperFormat* source = flipper_format_file_alloc(storage);
+    FlipperFormat* destination = flipper_format_file_alloc(storage);
+    SubGhzRawBinaryWriter* writer = subghz_raw_binary_writer_alloc(compress);
+    FuriString* temp_str = furi_string_alloc();
+    size_t capacity = SUBGHZ_RAW_BINARY_BLOCK_SAMPLES;
+    int32_t* samples = malloc(sizeof(int32_t) * capacity);
+
+    bool result = false;
+    do {
+        if(!flipper_format_file_open_existing(source, source_path)) {
+            FURI_LOG_E(TAG, "Unable to open %s", source_path);
+            break;
+        }
+        uint32_t version = 0;
+        if(!flipper_format_read_header(source, temp_str, &version) ||
+           !furi_string_equal(temp_str, SUBGHZ_RAW_FILE_TYPE)) {
+            FURI_LOG_E(TAG, "Not a RAW file");
+            break;
+        }
+        if(!flipper_format_read_string(source, "Protocol", temp_str) ||
+           !furi_string_equal(temp_str, "RAW")) {
+            FURI_LOG_E(TAG, "Missing Protocol");
+            break;
+        }
+
+        // Header is copied as is, up to and including Protocol line
+        Stream* source_stream = flipper_format_get_raw_stream(source);
+        uint8_t symbol = 0;
+        while(stream_read(source_stream, &symbol, 1) == 1 && symbol != '\n') {
+        }
+        size_t header_size = stream_tell(source_stream);
+
+        SubGhzRawBinaryReader* reader = subghz_raw_binary_reader_alloc();
+        bool is_binary = subghz_raw_binary_reader_start(reader, source);
+        subghz_raw_binary_reader_free(reader);
+        if(is_binary) {
+            FURI_LOG_E(TAG, "Already binary");
+            break;
+        }
+
+        if(!flipper_format_file_open_always(destination, destination_path)) {
+            FURI_LOG_E(TAG, "Unable to open %s", destination_path);
+            break;
+        }
+        Stream* destination_stream = flipper_format_get_raw_stream(destination);
+        if(!stream_rewind(source_stream)) break;
+        if(stream_copy(source_stream, destination_stream, header_size) != header_size) break;
+
+        if(!subghz_raw_binary_writer_start(writer, destination)) break;
+
+        bool data_ok = true;
+        uint32_t count = 0;
+        while(flipper_format_get_value_count(source, "RAW_Data", &count)) {
+            if(count > capacity) {
+                capacity = count;
+                samples = realloc(samples, sizeof(int32_t) * capacity); //-V701
+            }
+            if(!flipper_format_read_int32(source, "RAW_Data", samples, count) ||
+               !subghz_raw_binary_writer_add(writer, samples, count)) {
+                data_ok = false;
+                break;
+            }
+        }
+        if(!data_ok) break;
+
+        result = subghz_raw_binary_writer_finish(writer);
+    } while(false);
+
+    free(samples);
+    furi_string_free(temp_str);
+    subghz_raw_binary_writer_free(writer);
+    flipper_format_free(destination);
+    flipper_format_free(source);
+
+    if(!result) storage_simply_remove(storage, destination_path);
+
+    return result;
+}
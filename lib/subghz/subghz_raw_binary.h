@@ -0,0 +1,142 @@
+#pragma once
+
+#include <furi.h>
+#include <flipper_format/flipper_format.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key that replaces RAW_Data lines, binary payload follows right after its line */
+#define SUBGHZ_RAW_BINARY_KEY     "RAW_Binary"
+#define SUBGHZ_RAW_BINARY_VERSION 1
+
+/** Samples in every block but the last one */
+#define SUBGHZ_RAW_BINARY_BLOCK_SAMPLES 512
+
+/** Samples beyond this are stored as +-100, same as text RAW playback does */
+#define SUBGHZ_RAW_BINARY_DURATION_MAX 1000000
+
+typedef struct SubGhzRawBinaryWriter SubGhzRawBinaryWriter;
+typedef struct SubGhzRawBinaryReader SubGhzRawBinaryReader;
+
+/**
+ * Allocate SubGhzRawBinaryWriter.
+ * @param compress Compress blocks with heatshrink
+ * @return SubGhzRawBinaryWriter* pointer to a SubGhzRawBinaryWriter instance
+ */
+SubGhzRawBinaryWriter* subghz_raw_binary_writer_alloc(bool compress);
+
+/**
+ * Free SubGhzRawBinaryWriter.
+ * @param instance Pointer to a SubGhzRawBinaryWriter instance
+ */
+void subghz_raw_binary_writer_free(SubGhzRawBinaryWriter* instance);
+
+/**
+ * Start binary payload at the end of file.
+ * File header and Protocol key must be written already, nothing else can be written after.
+ * @param instance Pointer to a SubGhzRawBinaryWriter instance
+ * @param flipper_format Pointer to a FlipperFormat instance, file opened for writing
+ * @return true On success
+ */
+bool subghz_raw_binary_writer_start(
+    SubGhzRawBinaryWriter* instance,
+    FlipperFormat* flipper_format);
+
+/**
+ * Add samples, full blocks are written to file.
+ * @param instance Pointer to a SubGhzRawBinaryWriter instance
+ * @param samples Durations in us, negative for low level
+ * @param count Number of samples
+ * @return true On success
+ */
+bool subghz_raw_binary_writer_add(
+    SubGhzRawBinaryWriter* instance,
+    const int32_t* samples,
+    size_t count);
+
+/**
+ * Write last block and block index, update payload header.
+ * Payload written without it is still readable, but not seekable.
+ * @param instance Pointer to a SubGhzRawBinaryWriter instance
+ * @return true On success
+ */
+bool subghz_raw_binary_writer_finish(SubGhzRawBinaryWriter* instance);
+
+/**
+ * Get the number of samples added.
+ * @param instance Pointer to a SubGhzRawBinaryWriter instance
+ * @return count of samples
+ */
+size_t subghz_raw_binary_writer_get_sample_count(SubGhzRawBinaryWriter* instance);
+
+/**
+ * Allocate SubGhzRawBinaryReader.
+ * @return SubGhzRawBinaryReader* pointer to a SubGhzRawBinaryReader instance
+ */
+SubGhzRawBinaryReader* subghz_raw_binary_reader_alloc(void);
+
+/**
+ * Free SubGhzRawBinaryReader.
+ * @param instance Pointer to a SubGhzRawBinaryReader instance
+ */
+void subghz_raw_binary_reader_free(SubGhzRawBinaryReader* instance);
+
+/**
+ * Start reading binary payload if it follows current position of file.
+ * Position is kept when next key is not SUBGHZ_RAW_BINARY_KEY, so text RAW_Data can be read.
+ * @param instance Pointer to a SubGhzRawBinaryReader instance
+ * @param flipper_format Pointer to a FlipperFormat instance, positioned after Protocol key
+ * @return true if file has binary payload and its header is valid
+ */
+bool subghz_raw_binary_reader_start(
+    SubGhzRawBinaryReader* instance,
+    FlipperFormat* flipper_format);
+
+/**
+ * Read samples.
+ * @param instance Pointer to a SubGhzRawBinaryReader instance
+ * @param samples Output durations in us, negative for low level
+ * @param count Maximum number of samples to read
+ * @return Number of samples read, 0 at the end of payload or on error
+ */
+size_t subghz_raw_binary_reader_read(
+    SubGhzRawBinaryReader* instance,
+    int32_t* samples,
+    size_t count);
+
+/**
+ * Seek to sample, uses block index.
+ * @param instance Pointer to a SubGhzRawBinaryReader instance
+ * @param sample Sample number
+ * @return true On success, false if payload is not finished or sample is out of range
+ */
+bool subghz_raw_binary_reader_seek(SubGhzRawBinaryReader* instance, size_t sample);
+
+/**
+ * Get the number of samples in payload.
+ * @param instance Pointer to a SubGhzRawBinaryReader instance
+ * @return count of samples, 0 if payload was not finished
+ */
+size_t subghz_raw_binary_reader_get_sample_count(SubGhzRawBinaryReader* instance);
+
+/**
+ * Convert RAW file with text RAW_Data to binary payload.
+ * Header lines are copied as is.
+ * @param storage Pointer to a Storage instance
+ * @param source_path Text RAW file
+ * @param destination_path Binary RAW file, overwritten
+ * @param compress Compress blocks with heatshrink
+ * @return true On success
+ */
+bool subghz_raw_binary_convert(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path,
+    bool compress);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,8 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_BLOCK_SIZE 64
+
 struct SubGhzWorker {
     FuriThread* thread;
     FuriStreamBuffer* stream;
@@ -16,7 +18,14 @@ struct SubGhzWorker {
 
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
+
+    // Kept off thread stack
+    LevelDuration block[SUBGHZ_WORKER_BLOCK_SIZE];
+    size_t block_bytes;
+    LevelDuration pairs[SUBGHZ_WORKER_BLOCK_SIZE];
+    size_t pairs_count;
 };
 
 /** Rx callback timer
@@ -38,7 +47,49 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     if(sizeof(LevelDuration) != ret) instance->overrun = true;
 }
 
+static void subghz_worker_flush_pairs(SubGhzWorker* instance) {
+    if(!instance->pairs_count) return;
+
+    if(instance->pair_batch_callback) {
+        instance->pair_batch_callback(instance->context, instance->pairs, instance->pairs_count);
+    } else if(instance->pair_callback) {
+        for(size_t i = 0; i < instance->pairs_count; i++) {
+            instance->pair_callback(
+                instance->context,
+                level_duration_get_level(instance->pairs[i]),
+                level_duration_get_duration(instance->pairs[i]));
+        }
+    }
+    instance->pairs_count = 0;
+}
+
+static void subghz_worker_process(SubGhzWorker* instance, LevelDuration level_duration) {
+    if(level_duration_is_reset(level_duration)) {
+        FURI_LOG_E(TAG, "Overrun buffer");
+        // Pairs received before overrun go first
+        subghz_worker_flush_pairs(instance);
+        if(instance->overrun_callback) instance->overrun_callback(instance->context);
+    } else {
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+
+        if((duration < instance->filter_duration) ||
+           (instance->filter_level_duration.level == level)) {
+            instance->filter_level_duration.duration += duration;
+
+        } else if(instance->filter_level_duration.level != level) {
+            instance->pairs[instance->pairs_count++] = level_duration_make(
+                instance->filter_level_duration.level, instance->filter_level_duration.duration);
+
+            instance->filter_level_duration.duration = duration;
+            instance->filter_level_duration.level = level;
+        }
+    }
+}
+
 /** Worker callback thread
+ * 
+ * Drains stream buffer in blocks, filtered pairs of every block are handed over at once
  * 
  * @param context 
  * @return exit code 
@@ -46,33 +97,24 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
-            if(level_duration_is_reset(level_duration)) {
-                FURI_LOG_E(TAG, "Overrun buffer");
-                if(instance->overrun_callback) instance->overrun_callback(instance->context);
-            } else {
-                bool level = level_duration_get_level(level_duration);
-                uint32_t duration = level_duration_get_duration(level_duration);
-
-                if((duration < instance->filter_duration) ||
-                   (instance->filter_level_duration.level == level)) {
-                    instance->filter_level_duration.duration += duration;
-
-                } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
-
-                    instance->filter_level_duration.duration = duration;
-                    instance->filter_level_duration.level = level;
-                }
-            }
+        size_t ret = furi_stream_buffer_receive(
+            instance->stream,
+            (uint8_t*)instance->block + instance->block_bytes,
+            sizeof(instance->block) - instance->block_bytes,
+            10);
+        instance->block_bytes += ret;
+
+        size_t count = instance->block_bytes / sizeof(LevelDuration);
+        for(size_t i = 0; i < count; i++) {
+            subghz_worker_process(instance, instance->block[i]);
+        }
+        subghz_worker_flush_pairs(instance);
+
+        // Keep incomplete item for the next round
+        instance->block_bytes -= count * sizeof(LevelDuration);
+        if(instance->block_bytes && count) {
+            memmove(instance->block, &instance->block[count], instance->block_bytes);
         }
     }
 
@@ -115,6 +157,13 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_check(instance);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_check(instance);
     instance->context = context;
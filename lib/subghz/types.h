@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -77,6 +78,7 @@ typedef SubGhzProtocolStatus (*SubGhzDeserialize)(void* context, FlipperFormat*
 
 // Decoder specific
 typedef void (*SubGhzDecoderFeed)(void* decoder, bool level, uint32_t duration);
+typedef size_t (*SubGhzDecoderFeedBatch)(void* decoder, const LevelDuration* pairs, size_t count);
 typedef void (*SubGhzDecoderReset)(void* decoder);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef uint32_t (*SubGhzGetHashDataLong)(void* decoder);
@@ -87,6 +89,22 @@ typedef void (*SubGhzGetStringBrief)(void* decoder, FuriString* output);
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
 
+/** Pulses that can move decoder out of its reset step
+ *
+ * Receiver skips decoder in reset step for pulses outside of this window,
+ * declaring it is only valid when decoder ignores such pulses there.
+ * Window matches `DURATION_DIFF(duration, te * te_mul) < te_delta * delta_mul`
+ * for pulse of given level, te is te_short or te_long of timing.
+ */
+typedef struct {
+    const SubGhzBlockConst* timing;
+    size_t step_offset; /**< Offset of parser step in decoder instance, reset step is 0 */
+    bool level;
+    bool te_long; /**< Window is based on te_long, te_short otherwise */
+    uint16_t te_mul;
+    uint16_t delta_mul;
+} SubGhzProtocolDecoderStart;
+
 typedef struct {
     SubGhzAlloc alloc;
     SubGhzFree free;
@@ -101,6 +119,13 @@ typedef struct {
 
     SubGhzGetHashDataLong get_hash_data_long;
     SubGhzGetStringBrief get_string_brief;
+
+    /** Optional, decoder without it gets every pulse */
+    const SubGhzProtocolDecoderStart* start;
+    /** Optional, same as feed for every pair. Decoder state must stay in instance,
+     * keeps index of fed pair in base feed_index. Returns right after the pair that set
+     * base batch_stop, pairs consumed otherwise */
+    SubGhzDecoderFeedBatch feed_batch;
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -341,7 +341,7 @@ static bool compress_decode_internal(
             *data_res_size = data_out_size - decompressed_context.data_size;
         }
     } else if(data_out_size >= data_in_size - 1) {
-        memcpy(data_out, &data_in[1], data_in_size);
+        memcpy(data_out, &data_in[1], data_in_size - 1);
         *data_res_size = data_in_size - 1;
         result = true;
     } else {
@@ -13,6 +13,15 @@ struct KeysDict {
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    // In memory mode stream is only open during load and write back
+    bool in_memory;
+    bool modified;
+    FS_OpenMode open_mode;
+    FuriString* path;
+    uint64_t* keys; /**< Sorted, without duplicates */
+    size_t keys_capacity;
+    size_t keys_position;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -29,6 +38,18 @@ static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
     }
 }
 
+static bool keys_dict_check_key_line(KeysDict* instance, FuriString* line) {
+    bool is_comment = furi_string_get_char(line, 0) == '#';
+
+    if(!is_comment) {
+        furi_string_left(line, instance->key_size_symbols - 1);
+    }
+
+    bool is_correct_size = furi_string_size(line) == instance->key_size_symbols - 1;
+
+    return !is_comment && is_correct_size;
+}
+
 static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool* is_endfile) {
     if(stream_read_line(instance->stream, line) == false) {
         *is_endfile = true;
@@ -38,18 +59,75 @@ static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool*
         FURI_LOG_T(
             TAG, "Read line: %s, len: %zu", furi_string_get_cstr(line), furi_string_size(line));
 
-        bool is_comment = furi_string_get_char(line, 0) == '#';
+        return keys_dict_check_key_line(instance, line);
+    }
+
+    return false;
+}
 
-        if(!is_comment) {
-            furi_string_left(line, instance->key_size_symbols - 1);
+static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int);
+
+static int keys_dict_compare(const void* a, const void* b) {
+    const uint64_t key_a = *(const uint64_t*)a;
+    const uint64_t key_b = *(const uint64_t*)b;
+
+    if(key_a == key_b) return 0;
+    return key_a < key_b ? -1 : 1;
+}
+
+/** Index of the key or of the first bigger one */
+static size_t keys_dict_lower_bound(KeysDict* instance, uint64_t key) {
+    size_t low = 0;
+    size_t high = instance->total_keys;
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(instance->keys[middle] < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
         }
+    }
 
-        bool is_correct_size = furi_string_size(line) == instance->key_size_symbols - 1;
+    return low;
+}
 
-        return !is_comment && is_correct_size;
+static bool keys_dict_find(KeysDict* instance, uint64_t key, size_t* index) {
+    *index = keys_dict_lower_bound(instance, key);
+    return *index < instance->total_keys && instance->keys[*index] == key;
+}
+
+static void keys_dict_load(KeysDict* instance) {
+    FuriString* line = furi_string_alloc();
+    bool is_endfile = false;
+
+    while(!is_endfile) {
+        if(!keys_dict_read_key_line(instance, line, &is_endfile)) continue;
+
+        if(instance->total_keys == instance->keys_capacity) {
+            instance->keys_capacity = MAX(instance->keys_capacity * 2, 64U);
+            instance->keys = realloc( //-V701
+                instance->keys,
+                instance->keys_capacity * sizeof(uint64_t));
+        }
+        keys_dict_str_to_int(instance, line, &instance->keys[instance->total_keys++]);
     }
+    furi_string_free(line);
 
-    return false;
+    if(instance->total_keys) {
+        qsort(instance->keys, instance->total_keys, sizeof(uint64_t), keys_dict_compare);
+
+        size_t unique_keys = 1;
+        for(size_t i = 1; i < instance->total_keys; i++) {
+            if(instance->keys[i] != instance->keys[unique_keys - 1]) {
+                instance->keys[unique_keys++] = instance->keys[i];
+            }
+        }
+        if(unique_keys != instance->total_keys) {
+            FURI_LOG_D(TAG, "Skipped %zu duplicate keys", instance->total_keys - unique_keys);
+        }
+        instance->total_keys = unique_keys;
+    }
 }
 
 bool keys_dict_check_presence(const char* path) {
@@ -67,14 +145,15 @@ bool keys_dict_check_presence(const char* path) {
 KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size) {
     furi_check(path);
     furi_check(key_size > 0);
+    furi_check(!(mode & KeysDictModeInMemory) || key_size <= sizeof(uint64_t));
 
     KeysDict* instance = malloc(sizeof(KeysDict));
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     instance->stream = buffered_file_stream_alloc(storage);
 
-    FS_OpenMode open_mode = (mode == KeysDictModeOpenAlways) ? FSOM_OPEN_ALWAYS :
-                                                               FSOM_OPEN_EXISTING;
+    FS_OpenMode open_mode = (mode & KeysDictModeOpenAlways) ? FSOM_OPEN_ALWAYS :
+                                                              FSOM_OPEN_EXISTING;
 
     // Byte = 2 symbols + 1 end of line
     instance->key_size = key_size;
@@ -82,6 +161,14 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     instance->total_keys = 0;
 
+    instance->in_memory = mode & KeysDictModeInMemory;
+    instance->modified = false;
+    instance->open_mode = open_mode;
+    instance->path = instance->in_memory ? furi_string_alloc_set_str(path) : NULL;
+    instance->keys = NULL;
+    instance->keys_capacity = 0;
+    instance->keys_position = 0;
+
     bool file_exists =
         buffered_file_stream_open(instance->stream, path, FSAM_READ_WRITE, open_mode);
 
@@ -92,6 +179,15 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
         keys_dict_add_ending_new_line(instance);
     }
 
+    if(instance->in_memory) {
+        if(file_exists) {
+            keys_dict_load(instance);
+            buffered_file_stream_close(instance->stream);
+        }
+        FURI_LOG_I(TAG, "Loaded dictionary with %zu keys to memory", instance->total_keys);
+        return instance;
+    }
+
     FuriString* line = furi_string_alloc();
 
     bool is_endfile = false;
@@ -112,11 +208,165 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     return instance;
 }
 
+static void keys_dict_int_to_key(KeysDict* instance, uint64_t key_int, uint8_t* key) {
+    size_t tmp_len = instance->key_size;
+
+    while(tmp_len--) {
+        key[tmp_len] = (uint8_t)key_int;
+        key_int >>= 8;
+    }
+}
+
+static uint64_t keys_dict_key_to_int(KeysDict* instance, const uint8_t* key) {
+    uint64_t key_int = 0;
+
+    for(size_t i = 0; i < instance->key_size; i++) {
+        key_int = (key_int << 8) | key[i];
+    }
+
+    return key_int;
+}
+
+static bool keys_dict_write_key(KeysDict* instance, Stream* stream, uint64_t key_int) {
+    uint8_t key[sizeof(uint64_t)];
+    keys_dict_int_to_key(instance, key_int, key);
+
+    FuriString* key_str = furi_string_alloc();
+    for(size_t i = 0; i < instance->key_size; i++) {
+        furi_string_cat_printf(key_str, "%02X", key[i]);
+    }
+    furi_string_push_back(key_str, '\n');
+
+    bool success = stream_write_string(stream, key_str) == furi_string_size(key_str);
+    furi_string_free(key_str);
+
+    return success;
+}
+
+/**
+ * Go through the file, mark keys that are kept in it and copy kept lines if needed.
+ * A key line is kept if the key is still in the dictionary and was not seen above.
+ * @return false on write error
+ */
+static bool keys_dict_scan_file(
+    KeysDict* instance,
+    uint32_t* in_file,
+    Stream* copy_to,
+    size_t* dropped_lines) {
+    FuriString* line = furi_string_alloc();
+    FuriString* key_line = furi_string_alloc();
+    bool success = true;
+
+    *dropped_lines = 0;
+    stream_rewind(instance->stream);
+    while(success && stream_read_line(instance->stream, line)) {
+        bool keep = true;
+
+        furi_string_set(key_line, line);
+        if(keys_dict_check_key_line(instance, key_line)) {
+            uint64_t key_int;
+            size_t index;
+            keys_dict_str_to_int(instance, key_line, &key_int);
+
+            keep = keys_dict_find(instance, key_int, &index) &&
+                   !(in_file[index / 32] & (1UL << (index % 32)));
+            if(keep) in_file[index / 32] |= 1UL << (index % 32);
+        }
+
+        if(!keep) {
+            (*dropped_lines)++;
+        } else if(copy_to) {
+            success = stream_write_string(copy_to, line) == furi_string_size(line);
+        }
+    }
+
+    furi_string_free(key_line);
+    furi_string_free(line);
+
+    return success;
+}
+
+static bool keys_dict_save(KeysDict* instance) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const char* path = furi_string_get_cstr(instance->path);
+    FuriString* path_tmp = furi_string_alloc_printf("%s.tmp", path);
+    Stream* stream_tmp = buffered_file_stream_alloc(storage);
+    const size_t in_file_size = (instance->total_keys / 32 + 1) * sizeof(uint32_t);
+    uint32_t* in_file = malloc(in_file_size);
+    bool rewrite = false;
+    bool success = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               instance->stream, path, FSAM_READ_WRITE, instance->open_mode)) {
+            break;
+        }
+        keys_dict_add_ending_new_line(instance);
+
+        // Common case is only added keys, they are appended and the file is kept as is
+        size_t dropped_lines;
+        memset(in_file, 0, in_file_size);
+        if(!keys_dict_scan_file(instance, in_file, NULL, &dropped_lines)) break;
+
+        Stream* stream = instance->stream;
+        if(dropped_lines) {
+            // Deleted and duplicate keys are dropped, comments and order are kept
+            rewrite = true;
+            stream = stream_tmp;
+            if(!buffered_file_stream_open(
+                   stream_tmp, furi_string_get_cstr(path_tmp), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+                break;
+            }
+            memset(in_file, 0, in_file_size);
+            if(!keys_dict_scan_file(instance, in_file, stream_tmp, &dropped_lines)) break;
+        } else if(!stream_seek(stream, 0, StreamOffsetFromEnd)) {
+            break;
+        }
+
+        bool write_error = false;
+        for(size_t i = 0; i < instance->total_keys && !write_error; i++) {
+            if(in_file[i / 32] & (1UL << (i % 32))) continue;
+            write_error = !keys_dict_write_key(instance, stream, instance->keys[i]);
+        }
+        if(write_error) break;
+
+        success = true;
+    } while(false);
+
+    buffered_file_stream_close(instance->stream);
+    if(rewrite) {
+        success &= buffered_file_stream_close(stream_tmp);
+        if(success) {
+            success = storage_common_rename(storage, furi_string_get_cstr(path_tmp), path) ==
+                      FSE_OK;
+        } else {
+            storage_common_remove(storage, furi_string_get_cstr(path_tmp));
+        }
+    }
+
+    if(!success) {
+        FURI_LOG_E(TAG, "Failed to write dictionary %s", path);
+    }
+
+    free(in_file);
+    stream_free(stream_tmp);
+    furi_string_free(path_tmp);
+    furi_record_close(RECORD_STORAGE);
+
+    return success;
+}
+
 void keys_dict_free(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
-    buffered_file_stream_close(instance->stream);
+    if(instance->in_memory) {
+        if(instance->modified) keys_dict_save(instance);
+        furi_string_free(instance->path);
+        free(instance->keys);
+    } else {
+        buffered_file_stream_close(instance->stream);
+    }
     stream_free(instance->stream);
     free(instance);
 
@@ -163,6 +413,11 @@ bool keys_dict_rewind(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
+    if(instance->in_memory) {
+        instance->keys_position = 0;
+        return true;
+    }
+
     return stream_rewind(instance->stream);
 }
 
@@ -188,20 +443,20 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->in_memory) {
+        if(instance->keys_position >= instance->total_keys) return false;
+        keys_dict_int_to_key(instance, instance->keys[instance->keys_position++], key);
+        return true;
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     bool key_read = keys_dict_get_next_key_str(instance, temp_key);
 
     if(key_read) {
-        size_t tmp_len = key_size;
         uint64_t key_int = 0;
-
         keys_dict_str_to_int(instance, temp_key, &key_int);
-
-        while(tmp_len--) {
-            key[tmp_len] = (uint8_t)key_int;
-            key_int >>= 8;
-        }
+        keys_dict_int_to_key(instance, key_int, key);
     }
 
     furi_string_free(temp_key);
@@ -240,6 +495,11 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->in_memory) {
+        size_t index;
+        return keys_dict_find(instance, keys_dict_key_to_int(instance, key), &index);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -277,6 +537,28 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->in_memory) {
+        uint64_t key_int = keys_dict_key_to_int(instance, key);
+        size_t index;
+        if(keys_dict_find(instance, key_int, &index)) return true;
+
+        if(instance->total_keys == instance->keys_capacity) {
+            instance->keys_capacity = MAX(instance->keys_capacity * 2, 64U);
+            instance->keys = realloc( //-V701
+                instance->keys,
+                instance->keys_capacity * sizeof(uint64_t));
+        }
+        memmove(
+            &instance->keys[index + 1],
+            &instance->keys[index],
+            (instance->total_keys - index) * sizeof(uint64_t));
+        instance->keys[index] = key_int;
+        instance->total_keys++;
+        if(index < instance->keys_position) instance->keys_position++;
+        instance->modified = true;
+        return true;
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -295,6 +577,20 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->in_memory) {
+        size_t index;
+        if(!keys_dict_find(instance, keys_dict_key_to_int(instance, key), &index)) return false;
+
+        instance->total_keys--;
+        memmove(
+            &instance->keys[index],
+            &instance->keys[index + 1],
+            (instance->total_keys - index) * sizeof(uint64_t));
+        if(index < instance->keys_position) instance->keys_position--;
+        instance->modified = true;
+        return true;
+    }
+
     bool key_removed = false;
 
     uint8_t* temp_key = malloc(key_size);
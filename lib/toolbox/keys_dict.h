@@ -9,8 +9,11 @@ extern "C" {
 #endif
 
 typedef enum {
-    KeysDictModeOpenExisting,
-    KeysDictModeOpenAlways,
+    KeysDictModeOpenExisting = 0,
+    KeysDictModeOpenAlways = (1 << 0),
+    /** Keys are loaded to RAM, sorted and without duplicates, and are iterated in ascending
+     * order. Changes are written to the file on free. Only for keys up to 8 bytes. */
+    KeysDictModeInMemory = (1 << 1),
 } KeysDictMode;
 
 typedef struct KeysDict KeysDict;
@@ -27,7 +30,7 @@ bool keys_dict_check_presence(const char* path);
  * Depending on mode, list will be opened or created.
  *
  * @param path      - Path of the file that contain the list
- * @param mode      - ListKeysMode value
+ * @param mode      - KeysDictMode value, KeysDictModeInMemory can be combined with others
  * @param key_size  - Size of each key in bytes
  *
  * @return Returns KeysDict list instance
@@ -79,6 +82,7 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 
 /** Add key to list
+ * In memory mode adding a key that is already present does nothing and succeeds.
  *
  * @param instance  - KeysDict list instance
  * @param key       - Key to add
@@ -77,6 +77,11 @@ size_t protocol_dict_get_max_data_size(ProtocolDict* dict) {
     return max_data_size;
 }
 
+size_t protocol_dict_get_protocol_count(ProtocolDict* dict) {
+    furi_check(dict);
+    return dict->count;
+}
+
 const char* protocol_dict_get_name(ProtocolDict* dict, size_t protocol_index) {
     furi_check(protocol_index < dict->count);
     return dict->base[protocol_index]->name;
@@ -99,6 +104,16 @@ void protocol_dict_decoders_start(ProtocolDict* dict) {
     }
 }
 
+void protocol_dict_decoders_start_by_id(ProtocolDict* dict, size_t protocol_index) {
+    furi_check(protocol_index < dict->count);
+
+    ProtocolDecoderStart fn = dict->base[protocol_index]->decoder.start;
+
+    if(fn) {
+        fn(dict->data[protocol_index]);
+    }
+}
+
 uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
     furi_check(protocol_index < dict->count);
     return dict->base[protocol_index]->features;
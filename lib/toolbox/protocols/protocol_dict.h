@@ -32,12 +32,16 @@ size_t protocol_dict_get_data_size(ProtocolDict* dict, size_t protocol_index);
 
 size_t protocol_dict_get_max_data_size(ProtocolDict* dict);
 
+size_t protocol_dict_get_protocol_count(ProtocolDict* dict);
+
 const char* protocol_dict_get_name(ProtocolDict* dict, size_t protocol_index);
 
 const char* protocol_dict_get_manufacturer(ProtocolDict* dict, size_t protocol_index);
 
 void protocol_dict_decoders_start(ProtocolDict* dict);
 
+void protocol_dict_decoders_start_by_id(ProtocolDict* dict, size_t protocol_index);
+
 uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index);
 
 ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration);
@@ -21,6 +21,7 @@ static size_t buffered_file_stream_size(BufferedFileStream* stream);
 static size_t
     buffered_file_stream_write(BufferedFileStream* stream, const uint8_t* data, size_t size);
 static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* data, size_t size);
+static size_t buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data);
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
@@ -40,6 +41,7 @@ const StreamVTable buffered_file_stream_vtable = {
     .write = (StreamWriteFn)buffered_file_stream_write,
     .read = (StreamReadFn)buffered_file_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)buffered_file_stream_delete_and_insert,
+    .peek = (StreamPeekFn)buffered_file_stream_peek,
 };
 
 Stream* buffered_file_stream_alloc(Storage* storage) {
@@ -61,6 +63,7 @@ bool buffered_file_stream_open(
     furi_check(_stream);
     BufferedFileStream* stream = (BufferedFileStream*)_stream;
     furi_check(stream->stream_base.vtable == &buffered_file_stream_vtable);
+    stream->stream_base.modification_count++;
     return file_stream_open(stream->file_stream, path, access_mode, open_mode);
 }
 
@@ -68,6 +71,7 @@ bool buffered_file_stream_close(Stream* _stream) {
     furi_check(_stream);
     BufferedFileStream* stream = (BufferedFileStream*)_stream;
     furi_check(stream->stream_base.vtable == &buffered_file_stream_vtable);
+    stream->stream_base.modification_count++;
     bool success = false;
     do {
         if(!(stream->sync_pending ? buffered_file_stream_flush(stream) :
@@ -206,6 +210,17 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
     return size - need_to_read;
 }
 
+static size_t buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data) {
+    // Same refill as read, cache is the window into the file
+    if(stream_cache_at_end(stream->cache)) {
+        if(stream->sync_pending) {
+            if(!buffered_file_stream_flush(stream)) return 0;
+        }
+        if(!stream_cache_fill(stream->cache, stream->file_stream)) return 0;
+    }
+    return stream_cache_peek(stream->cache, data);
+}
+
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
@@ -53,6 +53,7 @@ bool file_stream_open(
     furi_check(_stream);
     FileStream* stream = (FileStream*)_stream;
     furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    stream->stream_base.modification_count++;
     return storage_file_open(stream->file, path, access_mode, open_mode);
 }
 
@@ -60,6 +61,7 @@ bool file_stream_close(Stream* _stream) {
     furi_check(_stream);
     FileStream* stream = (FileStream*)_stream;
     furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    stream->stream_base.modification_count++;
     return storage_file_close(stream->file);
 }
 
@@ -13,6 +13,7 @@ void stream_free(Stream* stream) {
 
 void stream_clean(Stream* stream) {
     furi_check(stream);
+    stream->modification_count++;
     stream->vtable->clean(stream);
 }
 
@@ -116,6 +117,7 @@ size_t stream_size(Stream* stream) {
 
 size_t stream_write(Stream* stream, const uint8_t* data, size_t size) {
     furi_check(stream);
+    stream->modification_count++;
     return stream->vtable->write(stream, data, size);
 }
 
@@ -124,15 +126,28 @@ size_t stream_read(Stream* stream, uint8_t* data, size_t size) {
     return stream->vtable->read(stream, data, size);
 }
 
+size_t stream_peek(Stream* stream, const uint8_t** data) {
+    furi_check(stream);
+    furi_check(data);
+    if(!stream->vtable->peek) return 0;
+    return stream->vtable->peek(stream, data);
+}
+
 bool stream_delete_and_insert(
     Stream* stream,
     size_t delete_size,
     StreamWriteCB write_callback,
     const void* ctx) {
     furi_check(stream);
+    stream->modification_count++;
     return stream->vtable->delete_and_insert(stream, delete_size, write_callback, ctx);
 }
 
+uint32_t stream_get_modification_count(Stream* stream) {
+    furi_check(stream);
+    return stream->modification_count;
+}
+
 /********************************** Some random helpers starts here **********************************/
 
 typedef struct {
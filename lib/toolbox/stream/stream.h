@@ -95,6 +95,15 @@ size_t stream_write(Stream* stream, const uint8_t* data, size_t size);
  */
 size_t stream_read(Stream* stream, uint8_t* data, size_t count);
 
+/**
+ * Get data at the RW pointer without copying, RW pointer is not moved.
+ * Data is valid until the next operation on the stream.
+ * @param stream Stream instance
+ * @param data pointer to the data
+ * @return size_t how many bytes are available, 0 at the end or if stream has no buffer
+ */
+size_t stream_peek(Stream* stream, const uint8_t** data);
+
 /**
  * Delete N chars from the stream and write data by calling write_callback(context)
  * @param stream Stream instance
@@ -110,6 +119,13 @@ bool stream_delete_and_insert(
     StreamWriteCB write_callback,
     const void* context);
 
+/**
+ * Get modification counter, it changes on every write, clean, open and close
+ * @param stream Stream instance
+ * @return counter value, only comparison for equality makes sense
+ */
+uint32_t stream_get_modification_count(Stream* stream);
+
 /********************************** Some random helpers starts here **********************************/
 
 /**
@@ -19,6 +19,7 @@ typedef size_t (*StreamTellFn)(Stream* stream);
 typedef size_t (*StreamSizeFn)(Stream* stream);
 typedef size_t (*StreamWriteFn)(Stream* stream, const uint8_t* data, size_t size);
 typedef size_t (*StreamReadFn)(Stream* stream, uint8_t* data, size_t count);
+typedef size_t (*StreamPeekFn)(Stream* stream, const uint8_t** data);
 typedef bool (*StreamDeleteAndInsertFn)(
     Stream* stream,
     size_t delete_size,
@@ -35,10 +36,13 @@ struct StreamVTable {
     const StreamWriteFn write;
     const StreamReadFn read;
     const StreamDeleteAndInsertFn delete_and_insert;
+    /** Optional, streams without own buffer leave it NULL */
+    const StreamPeekFn peek;
 };
 
 struct Stream {
     const StreamVTable* vtable;
+    uint32_t modification_count;
 };
 
 #ifdef __cplusplus
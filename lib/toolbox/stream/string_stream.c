@@ -19,6 +19,7 @@ static size_t string_stream_tell(StringStream* stream);
 static size_t string_stream_size(StringStream* stream);
 static size_t string_stream_write(StringStream* stream, const char* data, size_t size);
 static size_t string_stream_read(StringStream* stream, char* data, size_t size);
+static size_t string_stream_peek(StringStream* stream, const uint8_t** data);
 static bool string_stream_delete_and_insert(
     StringStream* stream,
     size_t delete_size,
@@ -35,6 +36,7 @@ const StreamVTable string_stream_vtable = {
     .write = (StreamWriteFn)string_stream_write,
     .read = (StreamReadFn)string_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)string_stream_delete_and_insert,
+    .peek = (StreamPeekFn)string_stream_peek,
 };
 
 Stream* string_stream_alloc(void) {
@@ -116,21 +118,18 @@ static size_t string_stream_write(StringStream* stream, const char* data, size_t
 }
 
 static size_t string_stream_read(StringStream* stream, char* data, size_t size) {
-    size_t write_index = 0;
-    const char* cstr = furi_string_get_cstr(stream->string);
+    const uint8_t* view;
+    size_t was_read = MIN(size, string_stream_peek(stream, &view));
 
-    if(!string_stream_eof(stream)) {
-        while(true) {
-            if(write_index >= size) break;
+    memcpy(data, view, was_read);
+    stream->index += was_read;
 
-            data[write_index] = cstr[stream->index];
-            write_index++;
-            string_stream_seek(stream, 1, StreamOffsetFromCurrent);
-            if(string_stream_eof(stream)) break;
-        }
-    }
+    return was_read;
+}
 
-    return write_index;
+static size_t string_stream_peek(StringStream* stream, const uint8_t** data) {
+    *data = (const uint8_t*)furi_string_get_cstr(stream->string) + stream->index;
+    return string_stream_eof(stream) ? 0 : string_stream_size(stream) - stream->index;
 }
 
 static bool string_stream_delete_and_insert(
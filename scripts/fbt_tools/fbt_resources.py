@@ -80,11 +80,13 @@ def _resources_dist_action(target, source, env):
 def generate(env, **kw):
     env.SetDefault(
         ASSETS_COMPILER="${FBT_SCRIPT_DIR}/assets.py",
+        IRDB_COMPILER="${FBT_SCRIPT_DIR}/infrared.py",
     )
 
     if not env["VERBOSE"]:
         env.SetDefault(
             RESOURCEDISTCOMSTR="\tRESDIST\t${RESOURCES_ROOT}",
+            RESIRDBCOMSTR="\tIRDB\t${RESOURCES_ROOT}/infrared/assets",
             RESMANIFESTCOMSTR="\tMANIFST\t${TARGET}",
         )
 
@@ -96,6 +98,17 @@ def generate(env, **kw):
                         _resources_dist_action,
                         "${RESOURCEDISTCOMSTR}",
                     ),
+                    Action(
+                        [
+                            [
+                                "${PYTHON3}",
+                                "${IRDB_COMPILER}",
+                                "compile",
+                                "${TARGET.dir.posix}/infrared/assets",
+                            ]
+                        ],
+                        "${RESIRDBCOMSTR}",
+                    ),
                     Action(
                         [
                             [
@@ -0,0 +1,175 @@
+import os
+import struct
+import zlib
+
+from flipper.utils.fff import FlipperFormatFile
+
+# Compiled universal remote database, read by infrared_brute_force.c
+#
+# Header:      magic "IRDB", u16 version, u16 name count, u32 source .ir size,
+#              u32 source .ir CRC32, u8 protocol count, then protocol names as
+#              u8 length + chars
+# Name index:  u8 length + chars, u16 signal count, u32 offset of the first signal
+# Signals:     grouped by name, in source file order
+#   parsed:    u8 type (0), u8 protocol index, u8 address[4], u8 command[4]
+#   raw:       u8 type (1), u32 frequency, f32 duty cycle, u16 timings count,
+#              u16 packed size, packed timings
+#
+# Raw timings are packed as LEB128 varints of the zigzag encoded difference with the
+# timing two positions back, so marks are compared to marks and spaces to spaces.
+# All values are little endian.
+
+IRDB_MAGIC = b"IRDB"
+IRDB_VERSION = 2
+
+IRDB_TYPE_PARSED = 0
+IRDB_TYPE_RAW = 1
+
+
+def _pack_varint(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def pack_timings(timings: list) -> bytes:
+    out = bytearray()
+    for i, timing in enumerate(timings):
+        delta = timing - (timings[i - 2] if i >= 2 else 0)
+        out += _pack_varint((delta << 1) ^ (delta >> 63))
+    return bytes(out)
+
+
+def unpack_timings(data: bytes) -> list:
+    timings = []
+    value = shift = 0
+    for byte in data:
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte & 0x80:
+            continue
+        delta = (value >> 1) ^ -(value & 1)
+        timings.append(delta + (timings[-2] if len(timings) >= 2 else 0))
+        value = shift = 0
+    return timings
+
+
+class IrdbCompiler:
+    def __init__(self, logger):
+        self.logger = logger
+
+    def _read_signals(self, filename: str):
+        f = FlipperFormatFile()
+        f.load(filename)
+
+        filetype, version = f.getHeader()
+        if filetype != "IR library file" or version != 1:
+            raise Exception(f"Incorrect file type({filetype}) or version({version})")
+
+        signals = []
+        while True:
+            try:
+                name = f.readKey("name")
+            except EOFError:
+                break
+            signal_type = f.readKey("type")
+            if signal_type == "parsed":
+                signals.append(
+                    (
+                        name,
+                        IRDB_TYPE_PARSED,
+                        f.readKey("protocol"),
+                        bytes.fromhex(f.readKey("address")),
+                        bytes.fromhex(f.readKey("command")),
+                    )
+                )
+            elif signal_type == "raw":
+                signals.append(
+                    (
+                        name,
+                        IRDB_TYPE_RAW,
+                        f.readKeyInt("frequency"),
+                        f.readKeyFloat("duty_cycle"),
+                        f.readKeyIntArray("data"),
+                    )
+                )
+            else:
+                raise Exception(f"Unknown type: {signal_type}")
+        return signals
+
+    def _pack_signal(self, signal, protocols: list) -> bytes:
+        if signal[1] == IRDB_TYPE_PARSED:
+            _, _, protocol, address, command = signal
+            if len(address) != 4 or len(command) != 4:
+                raise Exception(f"Malformed address or command in {signal[0]}")
+            return (
+                struct.pack("<BB", IRDB_TYPE_PARSED, protocols.index(protocol))
+                + address
+                + command
+            )
+
+        _, _, frequency, duty_cycle, timings = signal
+        packed = pack_timings(timings)
+        return (
+            struct.pack(
+                "<BIfHH",
+                IRDB_TYPE_RAW,
+                frequency,
+                duty_cycle,
+                len(timings),
+                len(packed),
+            )
+            + packed
+        )
+
+    def compile(self, source: str, target: str):
+        signals = self._read_signals(source)
+
+        names = {}
+        protocols = []
+        for signal in signals:
+            names.setdefault(signal[0], []).append(signal)
+            if signal[1] == IRDB_TYPE_PARSED and signal[2] not in protocols:
+                protocols.append(signal[2])
+
+        with open(source, "rb") as f:
+            source_data = f.read()
+
+        header = bytearray(IRDB_MAGIC)
+        header += struct.pack(
+            "<HHIIB",
+            IRDB_VERSION,
+            len(names),
+            len(source_data),
+            zlib.crc32(source_data),
+            len(protocols),
+        )
+        for protocol in protocols:
+            header += struct.pack("<B", len(protocol)) + protocol.encode()
+
+        index_size = sum(
+            1 + len(name.encode()) + struct.calcsize("<HI") for name in names
+        )
+        offset = len(header) + index_size
+
+        index = bytearray()
+        body = bytearray()
+        for name, name_signals in names.items():
+            encoded_name = name.encode()
+            index += struct.pack("<B", len(encoded_name)) + encoded_name
+            index += struct.pack("<HI", len(name_signals), offset + len(body))
+            for signal in name_signals:
+                body += self._pack_signal(signal, protocols)
+
+        with open(target, "wb") as f:
+            f.write(header + index + body)
+
+        self.logger.debug(
+            f"{source}: {len(signals)} signals, {os.path.getsize(target)} bytes"
+        )
@@ -1,8 +1,10 @@
 #!/usr/bin/env python3
 
+import os
 from os import path
 
 from flipper.app import App
+from flipper.assets.irdb import IrdbCompiler
 from flipper.utils.fff import *
 
 
@@ -17,6 +19,26 @@ class Main(App):
         self.parser_cleanup.add_argument("filename", type=str)
         self.parser_cleanup.set_defaults(func=self.cleanup)
 
+        self.parser_compile = self.subparsers.add_parser(
+            "compile", help="Compile IR library files in directory to .irdb"
+        )
+        self.parser_compile.add_argument("directory", type=str)
+        self.parser_compile.set_defaults(func=self.compile)
+
+    def compile(self):
+        if not path.isdir(self.args.directory):
+            self.logger.info(f"No IR libraries in {self.args.directory}")
+            return 0
+
+        compiler = IrdbCompiler(self.logger)
+        for filename in sorted(os.listdir(self.args.directory)):
+            if not filename.endswith(".ir"):
+                continue
+            source = path.join(self.args.directory, filename)
+            compiler.compile(source, source + "db")
+
+        return 0
+
     def cleanup(self):
         f = FlipperFormatFile()
         f.load(self.args.filename)
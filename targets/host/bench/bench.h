@@ -0,0 +1,65 @@
+/**
+ * @file bench.h
+ * Host benchmark runner
+ *
+ * Each benchmark is a set of callbacks: `alloc` prepares input data once,
+ * `run` performs one operation and is called in a loop until the minimal
+ * run time is reached, `free` releases everything allocated in `alloc`.
+ * Runner reports time and heap allocations per operation.
+ */
+#pragma once
+
+#include <furi.h>
+#include <toolbox/level_duration.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void* (*BenchAlloc)(void);
+typedef void (*BenchRun)(void* context);
+typedef void (*BenchFree)(void* context);
+
+typedef struct {
+    const char* name;
+    BenchAlloc alloc;
+    BenchRun run;
+    BenchFree free;
+} Bench;
+
+typedef struct {
+    const char* name;
+    const Bench* benches;
+    size_t count;
+} BenchSuite;
+
+/** Prevent compiler from optimizing out a computed value */
+#define BENCH_KEEP(value)                    \
+    do {                                     \
+        __asm__ volatile("" : : "g"(value)); \
+    } while(0)
+
+/** Path to unit test resources, as seen through host storage */
+#define BENCH_RESOURCE(path) EXT_PATH("unit_tests/" path)
+
+/** Load Sub-GHz RAW file into memory
+ *
+ * @param      path   path to RAW `.sub` file
+ * @param      count  pointer to store amount of loaded durations
+ *
+ * @return     allocated array of level and duration pairs, to be freed with free()
+ */
+LevelDuration* bench_subghz_raw_load(const char* path, size_t* count);
+
+extern const BenchSuite bench_suite_toolbox;
+extern const BenchSuite bench_suite_flipper_format;
+extern const BenchSuite bench_suite_keeloq;
+extern const BenchSuite bench_suite_subghz;
+extern const BenchSuite bench_suite_infrared;
+extern const BenchSuite bench_suite_lfrfid;
+extern const BenchSuite bench_suite_nfc;
+extern const BenchSuite bench_suite_mjs;
+
+#ifdef __cplusplus
+}
+#endif
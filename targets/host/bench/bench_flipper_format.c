@@ -0,0 +1,81 @@
+#include "bench.h"
+
+#include <flipper_format/flipper_format.h>
+
+#define BENCH_FLIPPER_FORMAT_KEY_COUNT (64U)
+
+typedef struct {
+    FlipperFormat* string_ff;
+    FuriString* value;
+} BenchFlipperFormat;
+
+static void* bench_flipper_format_alloc(void) {
+    BenchFlipperFormat* instance = malloc(sizeof(BenchFlipperFormat));
+    instance->string_ff = flipper_format_string_alloc();
+    instance->value = furi_string_alloc();
+
+    // Mimic a typical saved key file: header, a few fields and a long tail
+    FlipperFormat* ff = instance->string_ff;
+    furi_check(flipper_format_write_header_cstr(ff, "Bench File", 1));
+    for(size_t i = 0; i < BENCH_FLIPPER_FORMAT_KEY_COUNT; i++) {
+        furi_string_printf(instance->value, "Key_%zu", i);
+        const uint8_t data[8] = {i, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77};
+        furi_check(flipper_format_write_hex(ff, furi_string_get_cstr(instance->value), data, 8));
+    }
+    furi_check(flipper_format_write_string_cstr(ff, "Last", "value"));
+
+    return instance;
+}
+
+static void bench_flipper_format_free(void* context) {
+    BenchFlipperFormat* instance = context;
+    furi_string_free(instance->value);
+    flipper_format_free(instance->string_ff);
+    free(instance);
+}
+
+static void bench_flipper_format_read_header(void* context) {
+    BenchFlipperFormat* instance = context;
+    uint32_t version;
+    furi_check(flipper_format_rewind(instance->string_ff));
+    furi_check(flipper_format_read_header(instance->string_ff, instance->value, &version));
+}
+
+static void bench_flipper_format_read_last_key(void* context) {
+    BenchFlipperFormat* instance = context;
+    furi_check(flipper_format_rewind(instance->string_ff));
+    furi_check(flipper_format_read_string(instance->string_ff, "Last", instance->value));
+}
+
+static void bench_flipper_format_read_all_hex(void* context) {
+    BenchFlipperFormat* instance = context;
+    uint8_t data[8];
+    char key[16];
+
+    furi_check(flipper_format_rewind(instance->string_ff));
+    for(size_t i = 0; i < BENCH_FLIPPER_FORMAT_KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "Key_%zu", i);
+        furi_check(flipper_format_read_hex(instance->string_ff, key, data, sizeof(data)));
+    }
+}
+
+static const Bench bench_flipper_format[] = {
+    {"flipper_format/read_header",
+     bench_flipper_format_alloc,
+     bench_flipper_format_read_header,
+     bench_flipper_format_free},
+    {"flipper_format/read_last_key_64",
+     bench_flipper_format_alloc,
+     bench_flipper_format_read_last_key,
+     bench_flipper_format_free},
+    {"flipper_format/read_all_hex_64",
+     bench_flipper_format_alloc,
+     bench_flipper_format_read_all_hex,
+     bench_flipper_format_free},
+};
+
+const BenchSuite bench_suite_flipper_format = {
+    .name = "flipper_format",
+    .benches = bench_flipper_format,
+    .count = COUNT_OF(bench_flipper_format),
+};
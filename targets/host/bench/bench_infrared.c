@@ -0,0 +1,176 @@
+#include "bench.h"
+
+#include <flipper_format/flipper_format.h>
+#include <infrared.h>
+
+typedef struct {
+    uint32_t* timings;
+    uint32_t count;
+} BenchInfraredSignal;
+
+typedef struct {
+    InfraredDecoderHandler* decoder;
+    InfraredEncoderHandler* encoder;
+    BenchInfraredSignal* signals;
+    size_t signal_count;
+    size_t decoded;
+} BenchInfrared;
+
+/* Every protocol test vector, in the order of unit_tests resources */
+static const char* const bench_infrared_vectors[] = {
+    "kaseikyo",
+    "nec",
+    "nec42",
+    "nec42ext",
+    "necext",
+    "pioneer",
+    "rc5",
+    "rc5x",
+    "rc6",
+    "rca",
+    "samsung32",
+    "sirc",
+};
+
+/* Load raw signals whose name starts with `prefix`, all of them if `all` is set */
+static void bench_infrared_load(
+    BenchInfrared* instance,
+    const char* path,
+    const char* prefix,
+    bool all) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    FuriString* buf = furi_string_alloc();
+
+    furi_check(flipper_format_buffered_file_open_existing(ff, path));
+    while(flipper_format_read_string(ff, "name", buf)) {
+        if(all ? !furi_string_start_with_str(buf, prefix) : !furi_string_equal_str(buf, prefix))
+            continue;
+
+        size_t size = sizeof(BenchInfraredSignal) * (instance->signal_count + 1);
+        instance->signals = realloc(instance->signals, size); //-V701
+        BenchInfraredSignal* signal = &instance->signals[instance->signal_count++];
+        furi_check(flipper_format_get_value_count(ff, "data", &signal->count));
+        signal->timings = malloc(sizeof(uint32_t) * signal->count);
+        furi_check(flipper_format_read_uint32(ff, "data", signal->timings, signal->count));
+
+        if(!all) break;
+    }
+    furi_check(instance->signal_count);
+
+    furi_string_free(buf);
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static BenchInfrared* bench_infrared_alloc_instance(void) {
+    BenchInfrared* instance = malloc(sizeof(BenchInfrared));
+    instance->decoder = infrared_alloc_decoder();
+    instance->encoder = infrared_alloc_encoder();
+    instance->signals = NULL;
+    instance->signal_count = 0;
+    instance->decoded = 0;
+    return instance;
+}
+
+static BenchInfrared* bench_infrared_alloc(const char* path) {
+    BenchInfrared* instance = bench_infrared_alloc_instance();
+    bench_infrared_load(instance, path, "decoder_input1", false);
+    return instance;
+}
+
+static void* bench_infrared_alloc_nec(void) {
+    return bench_infrared_alloc(BENCH_RESOURCE("infrared/test_nec.irtest"));
+}
+
+static void* bench_infrared_alloc_rc6(void) {
+    return bench_infrared_alloc(BENCH_RESOURCE("infrared/test_rc6.irtest"));
+}
+
+static void* bench_infrared_alloc_sirc(void) {
+    return bench_infrared_alloc(BENCH_RESOURCE("infrared/test_sirc.irtest"));
+}
+
+static void* bench_infrared_alloc_all(void) {
+    BenchInfrared* instance = bench_infrared_alloc_instance();
+    FuriString* path = furi_string_alloc();
+    for(size_t i = 0; i < COUNT_OF(bench_infrared_vectors); i++) {
+        furi_string_printf(
+            path, BENCH_RESOURCE("infrared/test_%s.irtest"), bench_infrared_vectors[i]);
+        bench_infrared_load(instance, furi_string_get_cstr(path), "decoder_input", true);
+    }
+    furi_string_free(path);
+    return instance;
+}
+
+static void bench_infrared_free(void* context) {
+    BenchInfrared* instance = context;
+    for(size_t i = 0; i < instance->signal_count; i++) {
+        free(instance->signals[i].timings);
+    }
+    free(instance->signals);
+    infrared_free_encoder(instance->encoder);
+    infrared_free_decoder(instance->decoder);
+    free(instance);
+}
+
+static void bench_infrared_decode(void* context) {
+    BenchInfrared* instance = context;
+
+    for(size_t s = 0; s < instance->signal_count; s++) {
+        const BenchInfraredSignal* signal = &instance->signals[s];
+        bool level = false;
+
+        infrared_reset_decoder(instance->decoder);
+        for(uint32_t i = 0; i < signal->count; i++) {
+            if(signal->timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+                if(infrared_check_decoder_ready(instance->decoder)) instance->decoded++;
+            }
+            if(infrared_decode(instance->decoder, level, signal->timings[i])) instance->decoded++;
+            level = !level;
+        }
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static void bench_infrared_encode_nec(void* context) {
+    BenchInfrared* instance = context;
+    const InfraredMessage message = {
+        .protocol = InfraredProtocolNEC,
+        .address = 0x12,
+        .command = 0x34,
+        .repeat = false,
+    };
+
+    infrared_reset_encoder(instance->encoder, &message);
+
+    uint32_t duration;
+    bool level;
+    uint32_t total = 0;
+    InfraredStatus status;
+    do {
+        status = infrared_encode(instance->encoder, &duration, &level);
+        total += duration;
+    } while(status == InfraredStatusOk);
+    BENCH_KEEP(total);
+}
+
+static const Bench bench_infrared[] = {
+    {"infrared/decode_nec", bench_infrared_alloc_nec, bench_infrared_decode, bench_infrared_free},
+    {"infrared/decode_rc6", bench_infrared_alloc_rc6, bench_infrared_decode, bench_infrared_free},
+    {"infrared/decode_sirc",
+     bench_infrared_alloc_sirc,
+     bench_infrared_decode,
+     bench_infrared_free},
+    {"infrared/decode_all", bench_infrared_alloc_all, bench_infrared_decode, bench_infrared_free},
+    {"infrared/encode_nec",
+     bench_infrared_alloc_nec,
+     bench_infrared_encode_nec,
+     bench_infrared_free},
+};
+
+const BenchSuite bench_suite_infrared = {
+    .name = "infrared",
+    .benches = bench_infrared,
+    .count = COUNT_OF(bench_infrared),
+};
@@ -0,0 +1,179 @@
+#include "bench.h"
+
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/subghz_keystore.h>
+#include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
+
+#define BENCH_KEELOQ_KEY_COUNT     (512U)
+#define BENCH_KEELOQ_KEYSTORE_PATH EXT_PATH("bench_keystore")
+
+typedef struct {
+    SubGhzEnvironment* environment;
+    SubGhzReceiver* receiver;
+    SubGhzProtocolDecoderBase* decoder;
+    LevelDuration* durations;
+    size_t count;
+    uint32_t data;
+    uint64_t key;
+    uint64_t keys[BENCH_KEELOQ_KEY_COUNT];
+    uint32_t result[BENCH_KEELOQ_KEY_COUNT];
+} BenchKeeloq;
+
+static void* bench_keeloq_alloc(void) {
+    BenchKeeloq* instance = malloc(sizeof(BenchKeeloq));
+
+    instance->environment = subghz_environment_alloc();
+    subghz_environment_set_protocol_registry(
+        instance->environment, (void*)&subghz_protocol_registry);
+
+    // Synthetic keystore: real one is encrypted with device keys
+    SubGhzKeystore* keystore = subghz_environment_get_keystore(instance->environment);
+    uint64_t seed = 0x5DEECE66DULL;
+    for(size_t i = 0; i < BENCH_KEELOQ_KEY_COUNT; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        SubGhzKey key = {
+            .name = furi_string_alloc_printf("Bench_%zu", i / 4),
+            .key = seed,
+            .type = KEELOQ_LEARNING_SIMPLE + (i % 4),
+        };
+        SubGhzKeyArray_push_back(*subghz_keystore_get_data(keystore), key);
+        instance->keys[i] = key.key;
+    }
+
+    instance->receiver = subghz_receiver_alloc_init(instance->environment);
+    instance->decoder = subghz_receiver_search_decoder_base_by_name(
+        instance->receiver, SUBGHZ_PROTOCOL_KEELOQ_NAME);
+    furi_check(instance->decoder);
+
+    instance->durations =
+        bench_subghz_raw_load(BENCH_RESOURCE("subghz/doorhan_raw.sub"), &instance->count);
+
+    instance->data = 0x2A5C7E31;
+    instance->key = 0x0123456789ABCDEFULL;
+
+    return instance;
+}
+
+static void bench_keeloq_free(void* context) {
+    BenchKeeloq* instance = context;
+    free(instance->durations);
+    subghz_receiver_free(instance->receiver);
+    subghz_environment_free(instance->environment);
+    free(instance);
+}
+
+static void bench_keeloq_encrypt(void* context) {
+    BenchKeeloq* instance = context;
+    instance->data = subghz_protocol_keeloq_common_encrypt(instance->data, instance->key);
+    BENCH_KEEP(instance->data);
+}
+
+static void bench_keeloq_decrypt(void* context) {
+    BenchKeeloq* instance = context;
+    instance->data = subghz_protocol_keeloq_common_decrypt(instance->data, instance->key);
+    BENCH_KEEP(instance->data);
+}
+
+static void bench_keeloq_decrypt_batch(void* context) {
+    BenchKeeloq* instance = context;
+    subghz_protocol_keeloq_common_decrypt_batch(
+        instance->data++, instance->keys, instance->result, BENCH_KEELOQ_KEY_COUNT);
+    BENCH_KEEP(instance->result[0]);
+}
+
+static void bench_keeloq_decrypt_scalar_512(void* context) {
+    BenchKeeloq* instance = context;
+    for(size_t i = 0; i < BENCH_KEELOQ_KEY_COUNT; i++) {
+        instance->result[i] =
+            subghz_protocol_keeloq_common_decrypt(instance->data, instance->keys[i]);
+    }
+    instance->data++;
+    BENCH_KEEP(instance->result[0]);
+}
+
+static void bench_keeloq_normal_learning(void* context) {
+    BenchKeeloq* instance = context;
+    instance->key = subghz_protocol_keeloq_common_normal_learning(instance->data++, instance->key);
+    BENCH_KEEP(instance->key);
+}
+
+static void bench_keeloq_decode_keystore_scan(void* context) {
+    BenchKeeloq* instance = context;
+    SubGhzKeystore* keystore = subghz_environment_get_keystore(instance->environment);
+
+    subghz_keystore_reset_kl(keystore);
+    instance->decoder->protocol->decoder->reset(instance->decoder);
+    for(size_t i = 0; i < instance->count; i++) {
+        instance->decoder->protocol->decoder->feed(
+            instance->decoder,
+            level_duration_get_level(instance->durations[i]),
+            level_duration_get_duration(instance->durations[i]));
+    }
+}
+
+static void* bench_keeloq_keystore_alloc(void) {
+    BenchKeeloq* instance = bench_keeloq_alloc();
+    uint8_t iv[16] = {0x42};
+    furi_check(subghz_keystore_save(
+        subghz_environment_get_keystore(instance->environment), BENCH_KEELOQ_KEYSTORE_PATH, iv));
+    return instance;
+}
+
+static void bench_keeloq_keystore_load(bool compiled) {
+    if(!compiled) {
+        // Without compiled keystore every load decrypts and parses text, then compiles it again
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        storage_simply_remove(storage, BENCH_KEELOQ_KEYSTORE_PATH ".cache");
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    furi_check(subghz_keystore_load(keystore, BENCH_KEELOQ_KEYSTORE_PATH));
+    subghz_keystore_free(keystore);
+}
+
+static void bench_keeloq_keystore_load_text(void* context) {
+    UNUSED(context);
+    bench_keeloq_keystore_load(false);
+}
+
+static void bench_keeloq_keystore_load_compiled(void* context) {
+    UNUSED(context);
+    bench_keeloq_keystore_load(true);
+}
+
+static const Bench bench_keeloq[] = {
+    {"keeloq/encrypt", bench_keeloq_alloc, bench_keeloq_encrypt, bench_keeloq_free},
+    {"keeloq/decrypt", bench_keeloq_alloc, bench_keeloq_decrypt, bench_keeloq_free},
+    {"keeloq/decrypt_512_keys",
+     bench_keeloq_alloc,
+     bench_keeloq_decrypt_scalar_512,
+     bench_keeloq_free},
+    {"keeloq/decrypt_batch_512_keys",
+     bench_keeloq_alloc,
+     bench_keeloq_decrypt_batch,
+     bench_keeloq_free},
+    {"keeloq/normal_learning",
+     bench_keeloq_alloc,
+     bench_keeloq_normal_learning,
+     bench_keeloq_free},
+    {"keeloq/decode_doorhan_raw_512_keys",
+     bench_keeloq_alloc,
+     bench_keeloq_decode_keystore_scan,
+     bench_keeloq_free},
+    {"keeloq/keystore_load_text_512_keys",
+     bench_keeloq_keystore_alloc,
+     bench_keeloq_keystore_load_text,
+     bench_keeloq_free},
+    {"keeloq/keystore_load_compiled_512_keys",
+     bench_keeloq_keystore_alloc,
+     bench_keeloq_keystore_load_compiled,
+     bench_keeloq_free},
+};
+
+const BenchSuite bench_suite_keeloq = {
+    .name = "keeloq",
+    .benches = bench_keeloq,
+    .count = COUNT_OF(bench_keeloq),
+};
@@ -0,0 +1,169 @@
+#include "bench.h"
+
+#include <toolbox/protocols/protocol_dict.h>
+#include <toolbox/pulse_protocols/pulse_glue.h>
+#include <lfrfid/protocols/lfrfid_protocols.h>
+#include <lfrfid/lfrfid_read_decoder.h>
+#include <lfrfid/lfrfid_raw_file.h>
+#include <lfrfid/tools/varint_pair.h>
+
+#define BENCH_LFRFID_READ_TIMING_MULTIPLIER (8U)
+#define BENCH_LFRFID_EMULATION_TIMINGS      (4096U)
+#define BENCH_LFRFID_RAW_BUFFER_SIZE        (2048U)
+#define BENCH_LFRFID_RAW_PATH               EXT_PATH("bench_lfrfid.raw")
+
+typedef struct {
+    ProtocolDict* dict;
+    uint32_t* pulses;
+    size_t pulses_count;
+    size_t decoded;
+} BenchLfrfid;
+
+static BenchLfrfid* bench_lfrfid_alloc(LFRFIDProtocol protocol, const uint8_t* data) {
+    BenchLfrfid* instance = malloc(sizeof(BenchLfrfid));
+    instance->dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    instance->pulses = malloc(sizeof(uint32_t) * BENCH_LFRFID_EMULATION_TIMINGS * 2);
+
+    // Emulated signal, converted to the same pulses the reader produces
+    protocol_dict_set_data(
+        instance->dict, protocol, data, protocol_dict_get_data_size(instance->dict, protocol));
+    furi_check(protocol_dict_encoder_start(instance->dict, protocol));
+
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    for(size_t i = 0; i < BENCH_LFRFID_EMULATION_TIMINGS; i++) {
+        LevelDuration level_duration = protocol_dict_encoder_yield(instance->dict, protocol);
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            level_duration_get_level(level_duration),
+            level_duration_get_duration(level_duration) * BENCH_LFRFID_READ_TIMING_MULTIPLIER);
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+            instance->pulses[instance->pulses_count++] = period;
+            instance->pulses[instance->pulses_count++] = length - period;
+        }
+    }
+    pulse_glue_free(pulse_glue);
+
+    return instance;
+}
+
+static void* bench_lfrfid_alloc_em4100(void) {
+    const uint8_t data[] = {0x58, 0x00, 0x85, 0x64, 0x02};
+    return bench_lfrfid_alloc(LFRFIDProtocolEM4100, data);
+}
+
+static void* bench_lfrfid_alloc_h10301(void) {
+    const uint8_t data[] = {0x8D, 0x48, 0xA8};
+    return bench_lfrfid_alloc(LFRFIDProtocolH10301, data);
+}
+
+static void* bench_lfrfid_alloc_em4100_raw(void) {
+    BenchLfrfid* instance = bench_lfrfid_alloc_em4100();
+
+    // Same pulses as the reader capture, stored the way the RAW read worker does
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    furi_check(lfrfid_raw_file_open_write(file, BENCH_LFRFID_RAW_PATH));
+    furi_check(lfrfid_raw_file_write_header(file, 125000, 0.5, BENCH_LFRFID_RAW_BUFFER_SIZE));
+
+    VarintPair* pair = varint_pair_alloc();
+    uint8_t* buffer = malloc(BENCH_LFRFID_RAW_BUFFER_SIZE);
+    size_t buffer_size = 0;
+    for(size_t i = 0; i < instance->pulses_count; i += 2) {
+        varint_pair_pack(pair, true, instance->pulses[i]);
+        if(varint_pair_pack(pair, false, instance->pulses[i] + instance->pulses[i + 1])) {
+            if(buffer_size + varint_pair_get_size(pair) > BENCH_LFRFID_RAW_BUFFER_SIZE) {
+                furi_check(lfrfid_raw_file_write_buffer(file, buffer, buffer_size));
+                buffer_size = 0;
+            }
+            memcpy(&buffer[buffer_size], varint_pair_get_data(pair), varint_pair_get_size(pair));
+            buffer_size += varint_pair_get_size(pair);
+            varint_pair_reset(pair);
+        }
+    }
+    furi_check(lfrfid_raw_file_write_buffer(file, buffer, buffer_size));
+
+    free(buffer);
+    varint_pair_free(pair);
+    lfrfid_raw_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return instance;
+}
+
+static void bench_lfrfid_free(void* context) {
+    BenchLfrfid* instance = context;
+    free(instance->pulses);
+    protocol_dict_free(instance->dict);
+    free(instance);
+}
+
+static void bench_lfrfid_decode_all(void* context) {
+    BenchLfrfid* instance = context;
+
+    protocol_dict_decoders_start(instance->dict);
+    for(size_t i = 0; i < instance->pulses_count; i += 2) {
+        if(protocol_dict_decoders_feed(instance->dict, true, instance->pulses[i]) != PROTOCOL_NO) {
+            instance->decoded++;
+        }
+        if(protocol_dict_decoders_feed(instance->dict, false, instance->pulses[i + 1]) !=
+           PROTOCOL_NO) {
+            instance->decoded++;
+        }
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static void bench_lfrfid_read_raw_all_modulations(void* context) {
+    BenchLfrfid* instance = context;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    furi_check(lfrfid_raw_file_open_read(file, BENCH_LFRFID_RAW_PATH));
+
+    float frequency, duty_cycle;
+    furi_check(lfrfid_raw_file_read_header(file, &frequency, &duty_cycle));
+
+    // One pass over the capture, every modulation decoded from the same pairs
+    LFRFIDReadDecoder* decoder = lfrfid_read_decoder_alloc(instance->dict);
+    lfrfid_read_decoder_start(decoder, LFRFIDFeatureASK | LFRFIDFeaturePSK);
+    bool pass_end = false;
+    while(!pass_end) {
+        uint32_t duration, pulse;
+        furi_check(lfrfid_raw_file_read_pair(file, &duration, &pulse, &pass_end));
+
+        ProtocolId protocol = PROTOCOL_NO;
+        if(lfrfid_read_decoder_feed(decoder, pulse, duration, &protocol) !=
+           LFRFIDReadDecoderResultNone) {
+            instance->decoded++;
+        }
+    }
+    lfrfid_read_decoder_stop(decoder);
+    lfrfid_read_decoder_free(decoder);
+
+    lfrfid_raw_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    BENCH_KEEP(instance->decoded);
+}
+
+static const Bench bench_lfrfid[] = {
+    {"lfrfid/decode_em4100_all_protocols",
+     bench_lfrfid_alloc_em4100,
+     bench_lfrfid_decode_all,
+     bench_lfrfid_free},
+    {"lfrfid/decode_h10301_all_protocols",
+     bench_lfrfid_alloc_h10301,
+     bench_lfrfid_decode_all,
+     bench_lfrfid_free},
+    {"lfrfid/read_em4100_raw_all_modulations",
+     bench_lfrfid_alloc_em4100_raw,
+     bench_lfrfid_read_raw_all_modulations,
+     bench_lfrfid_free},
+};
+
+const BenchSuite bench_suite_lfrfid = {
+    .name = "lfrfid",
+    .benches = bench_lfrfid,
+    .count = COUNT_OF(bench_lfrfid),
+};
@@ -0,0 +1,179 @@
+#include "bench.h"
+
+#include <storage_host.h>
+#include <memmgr_host.h>
+#include <furi_hal.h>
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define BENCH_DEFAULT_MIN_TIME_MS (200U)
+#define BENCH_MAX_ITERATIONS      (1U << 30)
+
+static const BenchSuite* const bench_suites[] = {
+    &bench_suite_toolbox,
+    &bench_suite_flipper_format,
+    &bench_suite_keeloq,
+    &bench_suite_subghz,
+    &bench_suite_infrared,
+    &bench_suite_lfrfid,
+    &bench_suite_nfc,
+    &bench_suite_mjs,
+};
+
+typedef struct {
+    const char* filter;
+    uint32_t min_time_ms;
+    bool list_only;
+} BenchOptions;
+
+static uint64_t bench_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void
+    bench_run_one(const BenchSuite* suite, const Bench* bench, const BenchOptions* options) {
+    void* context = bench->alloc ? bench->alloc() : NULL;
+
+    // Warm up caches and lazily initialized state
+    bench->run(context);
+
+    const uint64_t min_time_ns = (uint64_t)options->min_time_ms * 1000000ULL;
+    uint64_t iterations = 1;
+    uint64_t elapsed_ns = 0;
+    MemmgrHostStats before, after;
+
+    while(true) {
+        memmgr_host_get_stats(&before);
+        const uint64_t start = bench_time_ns();
+        for(uint64_t i = 0; i < iterations; i++) {
+            bench->run(context);
+        }
+        elapsed_ns = bench_time_ns() - start;
+        memmgr_host_get_stats(&after);
+
+        if(elapsed_ns >= min_time_ns || iterations >= BENCH_MAX_ITERATIONS) break;
+
+        // Aim slightly above minimal time to avoid one more round
+        uint64_t next = elapsed_ns ? iterations * min_time_ns * 6 / 5 / elapsed_ns : 0;
+        iterations = CLAMP(next, iterations * 100, iterations * 2);
+    }
+
+    if(bench->free) bench->free(context);
+
+    printf(
+        "%-48s %12" PRIu64 " %14.1f ns/op %10.2f allocs/op %12.1f B/op\n",
+        bench->name,
+        iterations,
+        (double)elapsed_ns / (double)iterations,
+        (double)(after.alloc_count - before.alloc_count) / (double)iterations,
+        (double)(after.alloc_bytes - before.alloc_bytes) / (double)iterations);
+    UNUSED(suite);
+}
+
+static bool bench_matches(const BenchSuite* suite, const Bench* bench, const char* filter) {
+    if(!filter) return true;
+    return strstr(suite->name, filter) || strstr(bench->name, filter);
+}
+
+static void bench_prepare_storage(const char* root, const char* resources, const char* assets) {
+    FuriString* path = furi_string_alloc();
+
+    mkdir(root, 0755);
+    furi_string_printf(path, "%s/ext", root);
+    mkdir(furi_string_get_cstr(path), 0755);
+
+    // Expose repository resources without copying them
+    furi_string_printf(path, "%s/ext/unit_tests", root);
+    unlink(furi_string_get_cstr(path));
+    furi_check(symlink(resources, furi_string_get_cstr(path)) == 0);
+
+    furi_string_printf(path, "%s/ext/subghz", root);
+    unlink(furi_string_get_cstr(path));
+    furi_check(symlink(assets, furi_string_get_cstr(path)) == 0);
+
+    furi_string_free(path);
+}
+
+static void bench_usage(const char* name) {
+    printf(
+        "Usage: %s [-f filter] [-t min_time_ms] [-l] "
+        "-r resources_dir -s subghz_dir [-d storage_dir]\n",
+        name);
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = {
+        .filter = NULL,
+        .min_time_ms = BENCH_DEFAULT_MIN_TIME_MS,
+        .list_only = false,
+    };
+    const char* resources = NULL;
+    const char* subghz_assets = NULL;
+    const char* storage_root = "/tmp/furi_host_storage";
+
+    int opt;
+    while((opt = getopt(argc, argv, "f:t:lr:s:d:h")) != -1) {
+        switch(opt) {
+        case 'f':
+            options.filter = optarg;
+            break;
+        case 't':
+            options.min_time_ms = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            options.list_only = true;
+            break;
+        case 'r':
+            resources = optarg;
+            break;
+        case 's':
+            subghz_assets = optarg;
+            break;
+        case 'd':
+            storage_root = optarg;
+            break;
+        default:
+            bench_usage(argv[0]);
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if(!options.list_only && (!resources || !subghz_assets)) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    furi_init();
+    furi_hal_init();
+
+    if(!options.list_only) {
+        bench_prepare_storage(storage_root, resources, subghz_assets);
+        storage_host_init(storage_root);
+    }
+
+    for(size_t i = 0; i < COUNT_OF(bench_suites); i++) {
+        const BenchSuite* suite = bench_suites[i];
+        for(size_t j = 0; j < suite->count; j++) {
+            const Bench* bench = &suite->benches[j];
+            if(!bench_matches(suite, bench, options.filter)) continue;
+            if(options.list_only) {
+                printf("%s\n", bench->name);
+            } else {
+                bench_run_one(suite, bench, &options);
+            }
+        }
+    }
+
+    if(!options.list_only) {
+        storage_host_deinit();
+    }
+
+    return EXIT_SUCCESS;
+}
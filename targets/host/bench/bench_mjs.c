@@ -0,0 +1,161 @@
+#include "bench.h"
+
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_object_public.h>
+#include <mjs_primitive_public.h>
+
+typedef struct {
+    struct mjs* mjs;
+    mjs_val_t function;
+} BenchMjs;
+
+/* Scripts are compiled once, each run calls `bench()` again: repeated
+ * mjs_exec() would keep appending bytecode to the same instance. */
+static BenchMjs* bench_mjs_alloc(const char* script) {
+    BenchMjs* instance = malloc(sizeof(BenchMjs));
+    instance->mjs = mjs_create(NULL);
+
+    mjs_val_t result;
+    furi_check(mjs_exec(instance->mjs, script, &result) == MJS_OK);
+    instance->function = mjs_get(instance->mjs, mjs_get_global(instance->mjs), "bench", ~0);
+    mjs_own(instance->mjs, &instance->function);
+
+    return instance;
+}
+
+static void* bench_mjs_alloc_loop_sum(void) {
+    return bench_mjs_alloc(
+        "function bench() {"
+        "  let s = 0; for (let i = 0; i < 1000; i++) { s = s + i; } return s;"
+        "}");
+}
+
+static void* bench_mjs_alloc_object_props(void) {
+    return bench_mjs_alloc(
+        "let o = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8};"
+        "function bench() {"
+        "  let s = 0; for (let i = 0; i < 200; i++) { s = s + o.a + o.d + o.h; } return s;"
+        "}");
+}
+
+/* Module-like object: method looked up by a long name among many others */
+static void* bench_mjs_alloc_module_methods(void) {
+    return bench_mjs_alloc(
+        "let m = {addButton: function(a) { return a + 1; }};"
+        "m.setHeader = 0; m.setText = 0; m.setIcon = 0; m.setFocus = 0; m.setVisible = 0;"
+        "m.setLayout = 0; m.setFont = 0; m.setColor = 0; m.setOffset = 0; m.setFrame = 0;"
+        "m.setTimeout = 0; m.setCallback = 0; m.setContext = 0; m.setBuffer = 0; m.setSize = 0;"
+        "m.setPosition = 0; m.setAlign = 0; m.setBorder = 0; m.setScroll = 0; m.setState = 0;"
+        "function bench() {"
+        "  let s = 0; for (let i = 0; i < 200; i++) { s = m.addButton(s); } return s;"
+        "}");
+}
+
+/* Short-lived objects on top of a live set, like UI built every frame */
+static void* bench_mjs_alloc_gc_churn(void) {
+    return bench_mjs_alloc(
+        "let keep = []; for (let i = 0; i < 100; i++) { keep.push({x: i, name: 'item_name'}); }"
+        "function bench() {"
+        "  let s = 0; for (let f = 0; f < 100; f++) {"
+        "    let w = {a: f, b: [f, f + 1], label: 'frame_label'}; s = s + w.b[1] + keep[f].x;"
+        "  } return s;"
+        "}");
+}
+
+static void* bench_mjs_alloc_string_concat(void) {
+    return bench_mjs_alloc(
+        "function bench() {"
+        "  let t = ''; for (let i = 0; i < 200; i++) { t = t + 'x'; } return t.length;"
+        "}");
+}
+
+static void* bench_mjs_alloc_string_build(void) {
+    return bench_mjs_alloc(
+        "function bench() {"
+        "  let t = ''; for (let i = 0; i < 2000; i++) { t = t + 'line '; } return t.length;"
+        "}");
+}
+
+static void* bench_mjs_alloc_function_calls(void) {
+    return bench_mjs_alloc(
+        "function add(a, b) { return a + b; }"
+        "function bench() {"
+        "  let s = 0; for (let i = 0; i < 500; i++) { s = add(s, i); } return s;"
+        "}");
+}
+
+static void* bench_mjs_alloc_property_set(void) {
+    return bench_mjs_alloc(
+        "let o = {count: 0, total: 0};"
+        "function bench() {"
+        "  for (let i = 0; i < 200; i++) { o.count++; o.total = o.total + i; } return o.total;"
+        "}");
+}
+
+static void* bench_mjs_alloc_compare_branch(void) {
+    return bench_mjs_alloc(
+        "function bench() {"
+        "  let c = 0; for (let i = 0; i < 1000; i++) {"
+        "    if (i < 500) { c = c + 1; } else if (i === 750) { c = c + 10; }"
+        "  } return c;"
+        "}");
+}
+
+static void* bench_mjs_alloc_array_push(void) {
+    return bench_mjs_alloc(
+        "function bench() {"
+        "  let a = []; for (let i = 0; i < 500; i++) { a.push(i); } return a.length;"
+        "}");
+}
+
+static void* bench_mjs_alloc_typed_array(void) {
+    return bench_mjs_alloc(
+        "let u = Uint8Array(1000);"
+        "function bench() {"
+        "  let s = 0; for (let i = 0; i < 1000; i++) { u[i] = i; s = s + u[i]; }"
+        "  u.copyWithin(0, 500); return s + u.subarray(100, 200).length;"
+        "}");
+}
+
+static void bench_mjs_free(void* context) {
+    BenchMjs* instance = context;
+    mjs_disown(instance->mjs, &instance->function);
+    mjs_destroy(instance->mjs);
+    free(instance);
+}
+
+static void bench_mjs_call(void* context) {
+    BenchMjs* instance = context;
+    mjs_val_t result;
+    furi_check(
+        mjs_call(instance->mjs, &result, instance->function, mjs_mk_undefined(), 0) == MJS_OK);
+    BENCH_KEEP(result);
+}
+
+static void bench_mjs_create_destroy(void* context) {
+    UNUSED(context);
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_destroy(mjs);
+}
+
+static const Bench bench_mjs[] = {
+    {"mjs/create_destroy", NULL, bench_mjs_create_destroy, NULL},
+    {"mjs/loop_sum_1000", bench_mjs_alloc_loop_sum, bench_mjs_call, bench_mjs_free},
+    {"mjs/object_props_200", bench_mjs_alloc_object_props, bench_mjs_call, bench_mjs_free},
+    {"mjs/module_methods_200", bench_mjs_alloc_module_methods, bench_mjs_call, bench_mjs_free},
+    {"mjs/gc_churn_100", bench_mjs_alloc_gc_churn, bench_mjs_call, bench_mjs_free},
+    {"mjs/string_concat_200", bench_mjs_alloc_string_concat, bench_mjs_call, bench_mjs_free},
+    {"mjs/string_build_2000", bench_mjs_alloc_string_build, bench_mjs_call, bench_mjs_free},
+    {"mjs/function_calls_500", bench_mjs_alloc_function_calls, bench_mjs_call, bench_mjs_free},
+    {"mjs/property_set_200", bench_mjs_alloc_property_set, bench_mjs_call, bench_mjs_free},
+    {"mjs/compare_branch_1000", bench_mjs_alloc_compare_branch, bench_mjs_call, bench_mjs_free},
+    {"mjs/array_push_500", bench_mjs_alloc_array_push, bench_mjs_call, bench_mjs_free},
+    {"mjs/typed_array_1000", bench_mjs_alloc_typed_array, bench_mjs_call, bench_mjs_free},
+};
+
+const BenchSuite bench_suite_mjs = {
+    .name = "mjs",
+    .benches = bench_mjs,
+    .count = COUNT_OF(bench_mjs),
+};
@@ -0,0 +1,75 @@
+#include "bench.h"
+
+#include <nfc/helpers/crypto1.h>
+
+#define BENCH_NFC_BLOCK_SIZE (16U)
+
+typedef struct {
+    Crypto1* crypto;
+    BitBuffer* plain;
+    BitBuffer* encrypted;
+    uint32_t nonce;
+} BenchNfc;
+
+static void* bench_nfc_alloc(void) {
+    BenchNfc* instance = malloc(sizeof(BenchNfc));
+    instance->crypto = crypto1_alloc();
+    instance->plain = bit_buffer_alloc(BENCH_NFC_BLOCK_SIZE * 8);
+    instance->encrypted = bit_buffer_alloc(BENCH_NFC_BLOCK_SIZE * 8);
+
+    uint8_t block[BENCH_NFC_BLOCK_SIZE];
+    for(size_t i = 0; i < BENCH_NFC_BLOCK_SIZE; i++) {
+        block[i] = (uint8_t)(i * 17);
+    }
+    bit_buffer_copy_bytes(instance->plain, block, sizeof(block));
+    instance->nonce = 0x01200145;
+
+    return instance;
+}
+
+static void bench_nfc_free(void* context) {
+    BenchNfc* instance = context;
+    bit_buffer_free(instance->encrypted);
+    bit_buffer_free(instance->plain);
+    crypto1_free(instance->crypto);
+    free(instance);
+}
+
+static void bench_nfc_crypto1_init(void* context) {
+    BenchNfc* instance = context;
+    crypto1_init(instance->crypto, 0xFFFFFFFFFFFFULL);
+    BENCH_KEEP(instance->crypto->odd);
+}
+
+static void bench_nfc_crypto1_word(void* context) {
+    BenchNfc* instance = context;
+    instance->nonce = crypto1_word(instance->crypto, instance->nonce, 0);
+    BENCH_KEEP(instance->nonce);
+}
+
+static void bench_nfc_crypto1_encrypt_block(void* context) {
+    BenchNfc* instance = context;
+    crypto1_encrypt(instance->crypto, NULL, instance->plain, instance->encrypted);
+}
+
+static void bench_nfc_prng_successor(void* context) {
+    BenchNfc* instance = context;
+    instance->nonce = prng_successor(instance->nonce, 64);
+    BENCH_KEEP(instance->nonce);
+}
+
+static const Bench bench_nfc[] = {
+    {"nfc/crypto1_init", bench_nfc_alloc, bench_nfc_crypto1_init, bench_nfc_free},
+    {"nfc/crypto1_word", bench_nfc_alloc, bench_nfc_crypto1_word, bench_nfc_free},
+    {"nfc/crypto1_encrypt_block",
+     bench_nfc_alloc,
+     bench_nfc_crypto1_encrypt_block,
+     bench_nfc_free},
+    {"nfc/prng_successor_64", bench_nfc_alloc, bench_nfc_prng_successor, bench_nfc_free},
+};
+
+const BenchSuite bench_suite_nfc = {
+    .name = "nfc",
+    .benches = bench_nfc,
+    .count = COUNT_OF(bench_nfc),
+};
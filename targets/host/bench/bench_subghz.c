@@ -0,0 +1,178 @@
+#include "bench.h"
+
+#include <flipper_format/flipper_format.h>
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/protocols/protocol_items.h>
+
+#define BENCH_SUBGHZ_RAW_CHUNK  (512U)
+#define BENCH_SUBGHZ_BATCH_SIZE (64U)
+
+typedef struct {
+    SubGhzEnvironment* environment;
+    SubGhzReceiver* receiver;
+    SubGhzProtocolDecoderBase* decoder;
+    LevelDuration* durations;
+    size_t count;
+    size_t decoded;
+} BenchSubGhz;
+
+LevelDuration* bench_subghz_raw_load(const char* path, size_t* count) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    FuriString* temp_str = furi_string_alloc();
+
+    size_t capacity = BENCH_SUBGHZ_RAW_CHUNK;
+    LevelDuration* durations = malloc(sizeof(LevelDuration) * capacity);
+    int32_t* chunk = malloc(sizeof(int32_t) * BENCH_SUBGHZ_RAW_CHUNK);
+    *count = 0;
+
+    furi_check(flipper_format_file_open_existing(file, path));
+    furi_check(flipper_format_read_string(file, "Protocol", temp_str));
+    furi_check(furi_string_equal(temp_str, "RAW"));
+
+    uint32_t values = 0;
+    while(flipper_format_get_value_count(file, "RAW_Data", &values)) {
+        values = MIN(values, BENCH_SUBGHZ_RAW_CHUNK);
+        if(!flipper_format_read_int32(file, "RAW_Data", chunk, values)) break;
+
+        if(*count + values > capacity) {
+            capacity = (*count + values) * 2;
+            durations = realloc(durations, sizeof(LevelDuration) * capacity);
+        }
+        for(size_t i = 0; i < values; i++) {
+            durations[(*count)++] = level_duration_make(chunk[i] > 0, abs(chunk[i]));
+        }
+    }
+
+    free(chunk);
+    furi_string_free(temp_str);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    furi_check(*count);
+    return durations;
+}
+
+static void bench_subghz_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(decoder_base);
+    BenchSubGhz* instance = context;
+    subghz_receiver_reset(receiver);
+    instance->decoded++;
+}
+
+static BenchSubGhz* bench_subghz_alloc(const char* path) {
+    BenchSubGhz* instance = malloc(sizeof(BenchSubGhz));
+
+    instance->environment = subghz_environment_alloc();
+    subghz_environment_set_protocol_registry(
+        instance->environment, (void*)&subghz_protocol_registry);
+
+    instance->receiver = subghz_receiver_alloc_init(instance->environment);
+    subghz_receiver_set_filter(instance->receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(instance->receiver, bench_subghz_rx_callback, instance);
+
+    instance->durations = bench_subghz_raw_load(path, &instance->count);
+
+    return instance;
+}
+
+static void* bench_subghz_alloc_random(void) {
+    return bench_subghz_alloc(BENCH_RESOURCE("subghz/test_random_raw.sub"));
+}
+
+static void* bench_subghz_alloc_princeton(void) {
+    BenchSubGhz* instance = bench_subghz_alloc(BENCH_RESOURCE("subghz/princeton_raw.sub"));
+    instance->decoder = subghz_receiver_search_decoder_base_by_name(
+        instance->receiver, SUBGHZ_PROTOCOL_PRINCETON_NAME);
+    furi_check(instance->decoder);
+    return instance;
+}
+
+static void bench_subghz_free(void* context) {
+    BenchSubGhz* instance = context;
+    free(instance->durations);
+    subghz_receiver_free(instance->receiver);
+    subghz_environment_free(instance->environment);
+    free(instance);
+}
+
+static void bench_subghz_receiver_decode(void* context) {
+    BenchSubGhz* instance = context;
+    subghz_receiver_reset(instance->receiver);
+    for(size_t i = 0; i < instance->count; i++) {
+        subghz_receiver_decode(
+            instance->receiver,
+            level_duration_get_level(instance->durations[i]),
+            level_duration_get_duration(instance->durations[i]));
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static void bench_subghz_receiver_decode_batch(void* context) {
+    BenchSubGhz* instance = context;
+    subghz_receiver_reset(instance->receiver);
+    for(size_t i = 0; i < instance->count; i += BENCH_SUBGHZ_BATCH_SIZE) {
+        subghz_receiver_decode_batch(
+            instance->receiver,
+            &instance->durations[i],
+            MIN(BENCH_SUBGHZ_BATCH_SIZE, instance->count - i));
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static void bench_subghz_decoder_feed(void* context) {
+    BenchSubGhz* instance = context;
+    const SubGhzProtocolDecoder* decoder = instance->decoder->protocol->decoder;
+    decoder->reset(instance->decoder);
+    for(size_t i = 0; i < instance->count; i++) {
+        decoder->feed(
+            instance->decoder,
+            level_duration_get_level(instance->durations[i]),
+            level_duration_get_duration(instance->durations[i]));
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static void bench_subghz_decoder_feed_batch(void* context) {
+    BenchSubGhz* instance = context;
+    instance->decoder->protocol->decoder->reset(instance->decoder);
+    for(size_t i = 0; i < instance->count; i += BENCH_SUBGHZ_BATCH_SIZE) {
+        subghz_protocol_decoder_base_feed_batch(
+            instance->decoder,
+            &instance->durations[i],
+            MIN(BENCH_SUBGHZ_BATCH_SIZE, instance->count - i));
+    }
+    BENCH_KEEP(instance->decoded);
+}
+
+static const Bench bench_subghz[] = {
+    {"subghz/receiver_decode_random_raw",
+     bench_subghz_alloc_random,
+     bench_subghz_receiver_decode,
+     bench_subghz_free},
+    {"subghz/receiver_decode_princeton_raw",
+     bench_subghz_alloc_princeton,
+     bench_subghz_receiver_decode,
+     bench_subghz_free},
+    {"subghz/receiver_decode_batch_random_raw",
+     bench_subghz_alloc_random,
+     bench_subghz_receiver_decode_batch,
+     bench_subghz_free},
+    {"subghz/princeton_feed_princeton_raw",
+     bench_subghz_alloc_princeton,
+     bench_subghz_decoder_feed,
+     bench_subghz_free},
+    {"subghz/princeton_feed_batch_princeton_raw",
+     bench_subghz_alloc_princeton,
+     bench_subghz_decoder_feed_batch,
+     bench_subghz_free},
+};
+
+const BenchSuite bench_suite_subghz = {
+    .name = "subghz",
+    .benches = bench_subghz,
+    .count = COUNT_OF(bench_subghz),
+};
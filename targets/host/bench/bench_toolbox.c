@@ -0,0 +1,129 @@
+#include "bench.h"
+
+#include <toolbox/crc32_calc.h>
+#include <toolbox/varint.h>
+#include <toolbox/compress.h>
+
+#define BENCH_TOOLBOX_BUFFER_SIZE (4096U)
+#define BENCH_TOOLBOX_VARINT_COUNT (1024U)
+
+typedef struct {
+    uint8_t* data;
+    uint8_t* encoded;
+    size_t encoded_size;
+    uint8_t* decoded;
+    Compress* compress;
+    int32_t* values;
+} BenchToolbox;
+
+static void* bench_toolbox_alloc(void) {
+    BenchToolbox* instance = malloc(sizeof(BenchToolbox));
+
+    // Compressible, icon-like payload: runs with some noise
+    instance->data = malloc(BENCH_TOOLBOX_BUFFER_SIZE);
+    uint32_t seed = 0x12345678;
+    for(size_t i = 0; i < BENCH_TOOLBOX_BUFFER_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        instance->data[i] = (i / 16) % 2 ? 0xFF : (uint8_t)(seed >> 28);
+    }
+
+    instance->encoded = malloc(BENCH_TOOLBOX_BUFFER_SIZE * 2);
+    instance->decoded = malloc(BENCH_TOOLBOX_BUFFER_SIZE * 2);
+    instance->compress =
+        compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+    furi_check(compress_encode(
+        instance->compress,
+        instance->data,
+        BENCH_TOOLBOX_BUFFER_SIZE,
+        instance->encoded,
+        BENCH_TOOLBOX_BUFFER_SIZE * 2,
+        &instance->encoded_size));
+
+    // Sub-GHz RAW like durations
+    instance->values = malloc(sizeof(int32_t) * BENCH_TOOLBOX_VARINT_COUNT);
+    for(size_t i = 0; i < BENCH_TOOLBOX_VARINT_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t duration = 200 + (int32_t)((seed >> 16) % 1200);
+        instance->values[i] = i % 2 ? -duration : duration;
+    }
+
+    return instance;
+}
+
+static void bench_toolbox_free(void* context) {
+    BenchToolbox* instance = context;
+    free(instance->values);
+    compress_free(instance->compress);
+    free(instance->decoded);
+    free(instance->encoded);
+    free(instance->data);
+    free(instance);
+}
+
+static void bench_toolbox_crc32_4k(void* context) {
+    BenchToolbox* instance = context;
+    BENCH_KEEP(crc32_calc_buffer(0, instance->data, BENCH_TOOLBOX_BUFFER_SIZE));
+}
+
+static void bench_toolbox_varint_1k(void* context) {
+    BenchToolbox* instance = context;
+    uint8_t* output = instance->encoded;
+    size_t size = 0;
+    for(size_t i = 0; i < BENCH_TOOLBOX_VARINT_COUNT; i++) {
+        size += varint_int32_pack(instance->values[i], &output[size]);
+    }
+
+    int32_t sum = 0;
+    size_t offset = 0;
+    for(size_t i = 0; i < BENCH_TOOLBOX_VARINT_COUNT; i++) {
+        int32_t value;
+        offset += varint_int32_unpack(&value, &output[offset], size - offset);
+        sum += value;
+    }
+    BENCH_KEEP(sum);
+}
+
+static void bench_toolbox_heatshrink_encode_4k(void* context) {
+    BenchToolbox* instance = context;
+    size_t size;
+    furi_check(compress_encode(
+        instance->compress,
+        instance->data,
+        BENCH_TOOLBOX_BUFFER_SIZE,
+        instance->decoded,
+        BENCH_TOOLBOX_BUFFER_SIZE * 2,
+        &size));
+    BENCH_KEEP(size);
+}
+
+static void bench_toolbox_heatshrink_decode_4k(void* context) {
+    BenchToolbox* instance = context;
+    size_t size;
+    furi_check(compress_decode(
+        instance->compress,
+        instance->encoded,
+        instance->encoded_size,
+        instance->decoded,
+        BENCH_TOOLBOX_BUFFER_SIZE,
+        &size));
+    BENCH_KEEP(size);
+}
+
+static const Bench bench_toolbox[] = {
+    {"toolbox/crc32_4k", bench_toolbox_alloc, bench_toolbox_crc32_4k, bench_toolbox_free},
+    {"toolbox/varint_1k", bench_toolbox_alloc, bench_toolbox_varint_1k, bench_toolbox_free},
+    {"toolbox/heatshrink_encode_4k",
+     bench_toolbox_alloc,
+     bench_toolbox_heatshrink_encode_4k,
+     bench_toolbox_free},
+    {"toolbox/heatshrink_decode_4k",
+     bench_toolbox_alloc,
+     bench_toolbox_heatshrink_decode_4k,
+     bench_toolbox_free},
+};
+
+const BenchSuite bench_suite_toolbox = {
+    .name = "toolbox",
+    .benches = bench_toolbox,
+    .count = COUNT_OF(bench_toolbox),
+};
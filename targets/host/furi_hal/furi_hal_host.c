@@ -0,0 +1,340 @@
+/**
+ * Host Furi HAL
+ *
+ * Emulates the small set of peripherals that portable libraries touch:
+ * RNG, RTC, AES engine with crypto enclave and Sub-GHz configuration.
+ *
+ * @warning Host enclave keys are derived from the slot number and are NOT the
+ *          keys provisioned on devices. Files encrypted on device (i.e. Sub-GHz
+ *          keystores) can't be decrypted on host, encrypt test data on host.
+ */
+#include <furi_hal.h>
+#include <furi.h>
+
+#include <mbedtls/aes.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TAG "FuriHalHost"
+
+#define FURI_HAL_CRYPTO_HOST_KEY_SIZE   (32U)
+#define FURI_HAL_CRYPTO_HOST_BLOCK_SIZE (16U)
+
+typedef struct {
+    mbedtls_aes_context encrypt;
+    mbedtls_aes_context decrypt;
+    uint8_t iv[FURI_HAL_CRYPTO_HOST_BLOCK_SIZE];
+    bool loaded;
+} FuriHalCryptoHost;
+
+typedef struct {
+    uint32_t registers[FuriHalRtcRegisterMAX];
+    uint32_t flags;
+    uint8_t log_level;
+    FuriHalRtcLocaleUnits locale_units;
+    FuriHalRtcLocaleTimeFormat locale_timeformat;
+    FuriHalRtcLocaleDateFormat locale_dateformat;
+    FuriHalRtcHeapTrackMode heap_track_mode;
+    FuriHalRtcBootMode boot_mode;
+    FuriHalRtcLogDevice log_device;
+    FuriHalRtcLogBaudRate log_baud_rate;
+    int32_t timestamp_offset;
+} FuriHalRtcHost;
+
+static FuriHalCryptoHost furi_hal_crypto_host = {0};
+static FuriHalRtcHost furi_hal_rtc_host = {0};
+static int8_t furi_hal_subghz_rolling_counter_mult = 1;
+
+void furi_hal_init(void) {
+    furi_hal_random_init();
+    furi_hal_crypto_init();
+    furi_hal_rtc_init();
+}
+
+/* GPIO */
+
+void furi_hal_gpio_init(
+    const GpioPin* gpio,
+    const GpioMode mode,
+    const GpioPull pull,
+    const GpioSpeed speed) {
+    UNUSED(gpio);
+    UNUSED(mode);
+    UNUSED(pull);
+    UNUSED(speed);
+}
+
+void furi_hal_gpio_init_simple(const GpioPin* gpio, const GpioMode mode) {
+    UNUSED(gpio);
+    UNUSED(mode);
+}
+
+/* Random */
+
+void furi_hal_random_init(void) {
+    srand((unsigned int)time(NULL));
+}
+
+uint32_t furi_hal_random_get(void) {
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+void furi_hal_random_fill_buf(uint8_t* buf, uint32_t len) {
+    furi_check(buf);
+    for(uint32_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)furi_hal_random_get();
+    }
+}
+
+/* Crypto */
+
+void furi_hal_crypto_init(void) {
+    memset(&furi_hal_crypto_host, 0, sizeof(furi_hal_crypto_host));
+}
+
+bool furi_hal_crypto_enclave_verify(uint8_t* keys_nb, uint8_t* valid_keys_nb) {
+    furi_check(keys_nb);
+    furi_check(valid_keys_nb);
+    *keys_nb = FURI_HAL_CRYPTO_ENCLAVE_FACTORY_KEY_SLOT_END;
+    *valid_keys_nb = FURI_HAL_CRYPTO_ENCLAVE_FACTORY_KEY_SLOT_END;
+    return true;
+}
+
+bool furi_hal_crypto_enclave_ensure_key(uint8_t key_slot) {
+    return key_slot <= FURI_HAL_CRYPTO_ENCLAVE_USER_KEY_SLOT_END;
+}
+
+bool furi_hal_crypto_load_key(const uint8_t* key, const uint8_t* iv) {
+    furi_check(key);
+    furi_check(iv);
+    furi_check(!furi_hal_crypto_host.loaded);
+
+    mbedtls_aes_init(&furi_hal_crypto_host.encrypt);
+    mbedtls_aes_init(&furi_hal_crypto_host.decrypt);
+    mbedtls_aes_setkey_enc(&furi_hal_crypto_host.encrypt, key, FURI_HAL_CRYPTO_HOST_KEY_SIZE * 8);
+    mbedtls_aes_setkey_dec(&furi_hal_crypto_host.decrypt, key, FURI_HAL_CRYPTO_HOST_KEY_SIZE * 8);
+    memcpy(furi_hal_crypto_host.iv, iv, FURI_HAL_CRYPTO_HOST_BLOCK_SIZE);
+    furi_hal_crypto_host.loaded = true;
+
+    return true;
+}
+
+bool furi_hal_crypto_unload_key(void) {
+    furi_check(furi_hal_crypto_host.loaded);
+
+    mbedtls_aes_free(&furi_hal_crypto_host.encrypt);
+    mbedtls_aes_free(&furi_hal_crypto_host.decrypt);
+    furi_hal_crypto_host.loaded = false;
+
+    return true;
+}
+
+bool furi_hal_crypto_enclave_load_key(uint8_t slot, const uint8_t* iv) {
+    furi_check(slot > 0 && slot <= FURI_HAL_CRYPTO_ENCLAVE_USER_KEY_SLOT_END);
+
+    uint8_t key[FURI_HAL_CRYPTO_HOST_KEY_SIZE];
+    for(size_t i = 0; i < sizeof(key); i++) {
+        key[i] = (uint8_t)(slot * 0x9DU + i * 0x3BU);
+    }
+
+    return furi_hal_crypto_load_key(key, iv);
+}
+
+bool furi_hal_crypto_enclave_unload_key(uint8_t slot) {
+    furi_check(slot > 0 && slot <= FURI_HAL_CRYPTO_ENCLAVE_USER_KEY_SLOT_END);
+    return furi_hal_crypto_unload_key();
+}
+
+bool furi_hal_crypto_encrypt(const uint8_t* input, uint8_t* output, size_t size) {
+    furi_check(furi_hal_crypto_host.loaded);
+    if(size % FURI_HAL_CRYPTO_HOST_BLOCK_SIZE) return false;
+
+    return mbedtls_aes_crypt_cbc(
+               &furi_hal_crypto_host.encrypt,
+               MBEDTLS_AES_ENCRYPT,
+               size,
+               furi_hal_crypto_host.iv,
+               input,
+               output) == 0;
+}
+
+bool furi_hal_crypto_decrypt(const uint8_t* input, uint8_t* output, size_t size) {
+    furi_check(furi_hal_crypto_host.loaded);
+    if(size % FURI_HAL_CRYPTO_HOST_BLOCK_SIZE) return false;
+
+    return mbedtls_aes_crypt_cbc(
+               &furi_hal_crypto_host.decrypt,
+               MBEDTLS_AES_DECRYPT,
+               size,
+               furi_hal_crypto_host.iv,
+               input,
+               output) == 0;
+}
+
+/* RTC */
+
+void furi_hal_rtc_init_early(void) {
+    memset(&furi_hal_rtc_host, 0, sizeof(furi_hal_rtc_host));
+}
+
+void furi_hal_rtc_deinit_early(void) {
+}
+
+void furi_hal_rtc_init(void) {
+    furi_hal_rtc_host.log_level = FuriLogLevelDefault;
+}
+
+void furi_hal_rtc_sync_shadow(void) {
+}
+
+void furi_hal_rtc_reset_registers(void) {
+    memset(furi_hal_rtc_host.registers, 0, sizeof(furi_hal_rtc_host.registers));
+}
+
+uint32_t furi_hal_rtc_get_register(FuriHalRtcRegister reg) {
+    furi_check(reg < FuriHalRtcRegisterMAX);
+    return furi_hal_rtc_host.registers[reg];
+}
+
+void furi_hal_rtc_set_register(FuriHalRtcRegister reg, uint32_t value) {
+    furi_check(reg < FuriHalRtcRegisterMAX);
+    furi_hal_rtc_host.registers[reg] = value;
+}
+
+void furi_hal_rtc_set_log_level(uint8_t level) {
+    furi_hal_rtc_host.log_level = level;
+    furi_log_set_level(level);
+}
+
+uint8_t furi_hal_rtc_get_log_level(void) {
+    return furi_hal_rtc_host.log_level;
+}
+
+void furi_hal_rtc_set_log_device(FuriHalRtcLogDevice device) {
+    furi_hal_rtc_host.log_device = device;
+}
+
+FuriHalRtcLogDevice furi_hal_rtc_get_log_device(void) {
+    return furi_hal_rtc_host.log_device;
+}
+
+void furi_hal_rtc_set_log_baud_rate(FuriHalRtcLogBaudRate baud_rate) {
+    furi_hal_rtc_host.log_baud_rate = baud_rate;
+}
+
+FuriHalRtcLogBaudRate furi_hal_rtc_get_log_baud_rate(void) {
+    return furi_hal_rtc_host.log_baud_rate;
+}
+
+void furi_hal_rtc_set_flag(FuriHalRtcFlag flag) {
+    furi_hal_rtc_host.flags |= flag;
+}
+
+void furi_hal_rtc_reset_flag(FuriHalRtcFlag flag) {
+    furi_hal_rtc_host.flags &= ~flag;
+}
+
+bool furi_hal_rtc_is_flag_set(FuriHalRtcFlag flag) {
+    return furi_hal_rtc_host.flags & flag;
+}
+
+void furi_hal_rtc_set_boot_mode(FuriHalRtcBootMode mode) {
+    furi_hal_rtc_host.boot_mode = mode;
+}
+
+FuriHalRtcBootMode furi_hal_rtc_get_boot_mode(void) {
+    return furi_hal_rtc_host.boot_mode;
+}
+
+void furi_hal_rtc_set_heap_track_mode(FuriHalRtcHeapTrackMode mode) {
+    furi_hal_rtc_host.heap_track_mode = mode;
+}
+
+FuriHalRtcHeapTrackMode furi_hal_rtc_get_heap_track_mode(void) {
+    return furi_hal_rtc_host.heap_track_mode;
+}
+
+void furi_hal_rtc_set_locale_units(FuriHalRtcLocaleUnits value) {
+    furi_hal_rtc_host.locale_units = value;
+}
+
+FuriHalRtcLocaleUnits furi_hal_rtc_get_locale_units(void) {
+    return furi_hal_rtc_host.locale_units;
+}
+
+void furi_hal_rtc_set_locale_timeformat(FuriHalRtcLocaleTimeFormat value) {
+    furi_hal_rtc_host.locale_timeformat = value;
+}
+
+FuriHalRtcLocaleTimeFormat furi_hal_rtc_get_locale_timeformat(void) {
+    return furi_hal_rtc_host.locale_timeformat;
+}
+
+void furi_hal_rtc_set_locale_dateformat(FuriHalRtcLocaleDateFormat value) {
+    furi_hal_rtc_host.locale_dateformat = value;
+}
+
+FuriHalRtcLocaleDateFormat furi_hal_rtc_get_locale_dateformat(void) {
+    return furi_hal_rtc_host.locale_dateformat;
+}
+
+void furi_hal_rtc_set_datetime(DateTime* datetime) {
+    furi_check(datetime);
+    furi_hal_rtc_host.timestamp_offset =
+        (int32_t)(datetime_datetime_to_timestamp(datetime) - (uint32_t)time(NULL));
+}
+
+void furi_hal_rtc_get_datetime(DateTime* datetime) {
+    furi_check(datetime);
+    datetime_timestamp_to_datetime(furi_hal_rtc_get_timestamp(), datetime);
+}
+
+void furi_hal_rtc_set_fault_data(uint32_t value) {
+    furi_hal_rtc_set_register(FuriHalRtcRegisterFaultData, value);
+}
+
+uint32_t furi_hal_rtc_get_fault_data(void) {
+    return furi_hal_rtc_get_register(FuriHalRtcRegisterFaultData);
+}
+
+void furi_hal_rtc_set_pin_fails(uint32_t value) {
+    furi_hal_rtc_set_register(FuriHalRtcRegisterPinFails, value);
+}
+
+uint32_t furi_hal_rtc_get_pin_fails(void) {
+    return furi_hal_rtc_get_register(FuriHalRtcRegisterPinFails);
+}
+
+void furi_hal_rtc_set_pin_value(uint32_t value) {
+    furi_hal_rtc_set_register(FuriHalRtcRegisterPinValue, value);
+}
+
+uint32_t furi_hal_rtc_get_pin_value(void) {
+    return furi_hal_rtc_get_register(FuriHalRtcRegisterPinValue);
+}
+
+uint32_t furi_hal_rtc_get_timestamp(void) {
+    return (uint32_t)time(NULL) + (uint32_t)furi_hal_rtc_host.timestamp_offset;
+}
+
+/* SubGhz */
+
+bool furi_hal_subghz_is_frequency_valid(uint32_t value) {
+    return (value >= 281000000 && value <= 361000000) ||
+           (value >= 378000000 && value <= 481000000) ||
+           (value >= 749000000 && value <= 962000000);
+}
+
+bool furi_hal_subghz_is_tx_allowed(uint32_t value) {
+    return furi_hal_subghz_is_frequency_valid(value);
+}
+
+int8_t furi_hal_subghz_get_rolling_counter_mult(void) {
+    return furi_hal_subghz_rolling_counter_mult;
+}
+
+void furi_hal_subghz_set_rolling_counter_mult(int8_t mult) {
+    furi_hal_subghz_rolling_counter_mult = mult;
+}
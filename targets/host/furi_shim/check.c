@@ -0,0 +1,42 @@
+#include <core/check.h>
+#include <core/thread.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void __furi_host_print_message(const char* kind, const void* message) {
+    const char* thread_name = furi_thread_get_name(furi_thread_get_current_id());
+    fprintf(stderr, "\r\n\033[0;31m[%s]", kind);
+    if(thread_name) {
+        fprintf(stderr, " in thread \"%s\"", thread_name);
+    }
+
+    // Small values are flags used instead of messages in FURI_DEBUG builds
+    if((uintptr_t)message > 0xFFU) {
+        fprintf(stderr, ": %s", (const char*)message);
+    } else if(message) {
+        fprintf(stderr, ": %s", (uintptr_t)message == 0x01 ? "furi_assert failed" :
+                                                              "furi_check failed");
+    }
+    fprintf(stderr, "\033[0m\r\n");
+    fflush(stderr);
+}
+
+FURI_NORETURN void __furi_crash_host(const void* message) {
+    __furi_host_print_message("CRASH", message);
+    abort();
+}
+
+FURI_NORETURN void __furi_halt_host(const void* message) {
+    __furi_host_print_message("HALT", message);
+    exit(EXIT_FAILURE);
+}
+
+FURI_NORETURN void __furi_crash_implementation(void) {
+    __furi_crash_host(NULL);
+}
+
+FURI_NORETURN void __furi_halt_implementation(void) {
+    __furi_halt_host(NULL);
+}
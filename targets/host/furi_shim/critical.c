@@ -0,0 +1,23 @@
+#include <core/common_defines.h>
+
+#include <pthread.h>
+
+// There are no interrupts on host, critical section is one global recursive lock
+static pthread_mutex_t furi_host_critical_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+__FuriCriticalInfo __furi_critical_enter(void) {
+    __FuriCriticalInfo info = {
+        .isrm = 0,
+        .from_isr = false,
+        .kernel_running = true,
+    };
+
+    pthread_mutex_lock(&furi_host_critical_mutex);
+
+    return info;
+}
+
+void __furi_critical_exit(__FuriCriticalInfo info) {
+    UNUSED(info);
+    pthread_mutex_unlock(&furi_host_critical_mutex);
+}
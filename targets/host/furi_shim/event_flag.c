@@ -0,0 +1,57 @@
+#include "host_i.h"
+
+#include <core/event_flag.h>
+#include <core/check.h>
+
+#include <stdlib.h>
+
+#define FURI_EVENT_FLAG_MAX_BITS_EVENT_GROUPS 24U
+#define FURI_EVENT_FLAG_INVALID_BITS \
+    (~((1UL << FURI_EVENT_FLAG_MAX_BITS_EVENT_GROUPS) - 1U))
+
+struct FuriEventFlag {
+    FuriHostFlags flags;
+};
+
+FuriEventFlag* furi_event_flag_alloc(void) {
+    FuriEventFlag* instance = malloc(sizeof(FuriEventFlag));
+    furi_host_flags_init(&instance->flags);
+    return instance;
+}
+
+void furi_event_flag_free(FuriEventFlag* instance) {
+    furi_check(instance);
+    furi_host_flags_deinit(&instance->flags);
+    free(instance);
+}
+
+uint32_t furi_event_flag_set(FuriEventFlag* instance, uint32_t flags) {
+    furi_check(instance);
+    furi_check((flags & FURI_EVENT_FLAG_INVALID_BITS) == 0U);
+
+    return furi_host_flags_set(&instance->flags, flags);
+}
+
+uint32_t furi_event_flag_clear(FuriEventFlag* instance, uint32_t flags) {
+    furi_check(instance);
+    furi_check((flags & FURI_EVENT_FLAG_INVALID_BITS) == 0U);
+
+    return furi_host_flags_clear(&instance->flags, flags);
+}
+
+uint32_t furi_event_flag_get(FuriEventFlag* instance) {
+    furi_check(instance);
+
+    return furi_host_flags_get(&instance->flags);
+}
+
+uint32_t furi_event_flag_wait(
+    FuriEventFlag* instance,
+    uint32_t flags,
+    uint32_t options,
+    uint32_t timeout) {
+    furi_check(instance);
+    furi_check((flags & FURI_EVENT_FLAG_INVALID_BITS) == 0U);
+
+    return furi_host_flags_wait(&instance->flags, flags, options, timeout);
+}
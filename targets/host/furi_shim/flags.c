@@ -0,0 +1,78 @@
+#include "host_i.h"
+
+#include <core/check.h>
+
+void furi_host_flags_init(FuriHostFlags* flags) {
+    furi_check(pthread_mutex_init(&flags->lock, NULL) == 0);
+    furi_host_cond_init(&flags->cond);
+    flags->bits = 0;
+}
+
+void furi_host_flags_deinit(FuriHostFlags* flags) {
+    pthread_cond_destroy(&flags->cond);
+    pthread_mutex_destroy(&flags->lock);
+}
+
+uint32_t furi_host_flags_set(FuriHostFlags* flags, uint32_t bits) {
+    pthread_mutex_lock(&flags->lock);
+    flags->bits |= bits;
+    uint32_t result = flags->bits;
+    pthread_cond_broadcast(&flags->cond);
+    pthread_mutex_unlock(&flags->lock);
+
+    return result;
+}
+
+uint32_t furi_host_flags_clear(FuriHostFlags* flags, uint32_t bits) {
+    pthread_mutex_lock(&flags->lock);
+    uint32_t result = flags->bits;
+    flags->bits &= ~bits;
+    pthread_mutex_unlock(&flags->lock);
+
+    return result;
+}
+
+uint32_t furi_host_flags_get(FuriHostFlags* flags) {
+    pthread_mutex_lock(&flags->lock);
+    uint32_t result = flags->bits;
+    pthread_mutex_unlock(&flags->lock);
+
+    return result;
+}
+
+static bool furi_host_flags_satisfied(uint32_t current, uint32_t bits, uint32_t options) {
+    if(options & FuriFlagWaitAll) {
+        return (current & bits) == bits;
+    } else {
+        return (current & bits) != 0U;
+    }
+}
+
+uint32_t
+    furi_host_flags_wait(FuriHostFlags* flags, uint32_t bits, uint32_t options, uint32_t timeout) {
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&flags->lock);
+    bool satisfied;
+    while(!(satisfied = furi_host_flags_satisfied(flags->bits, bits, options))) {
+        if(timeout == 0U ||
+           !furi_host_cond_wait(&flags->cond, &flags->lock, timeout, &deadline)) {
+            break;
+        }
+    }
+
+    uint32_t result;
+    if(satisfied) {
+        // Return flags before clearing
+        result = flags->bits;
+        if(!(options & FuriFlagNoClear)) {
+            flags->bits &= ~bits;
+        }
+    } else {
+        result = timeout ? (uint32_t)FuriFlagErrorTimeout : (uint32_t)FuriFlagErrorResource;
+    }
+    pthread_mutex_unlock(&flags->lock);
+
+    return result;
+}
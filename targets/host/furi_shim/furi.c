@@ -0,0 +1,10 @@
+#include <furi.h>
+
+void furi_init(void) {
+    furi_log_init();
+    furi_record_init();
+}
+
+void furi_run(void) {
+    // Host has no scheduler to start: threads are backed by pthreads
+}
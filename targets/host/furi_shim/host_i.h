@@ -0,0 +1,75 @@
+/**
+ * @file host_i.h
+ * Internal helpers shared by host implementations of Furi primitives
+ */
+#pragma once
+
+#include <core/base.h>
+
+#include <pthread.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Initialize condition variable bound to monotonic clock
+ *
+ * @param      cond  pointer to condition variable
+ */
+void furi_host_cond_init(pthread_cond_t* cond);
+
+/** Convert Furi timeout in ticks(ms) into absolute monotonic deadline
+ *
+ * @param      timeout   timeout in ticks
+ * @param      deadline  pointer to deadline to fill
+ */
+void furi_host_deadline(uint32_t timeout, struct timespec* deadline);
+
+/** Wait on condition variable until deadline
+ *
+ * @param      cond      pointer to condition variable
+ * @param      mutex     pointer to locked mutex
+ * @param      timeout   timeout in ticks, used only to check for FuriWaitForever
+ * @param      deadline  absolute deadline from furi_host_deadline
+ *
+ * @return     false if deadline has passed, true otherwise
+ */
+bool furi_host_cond_wait(
+    pthread_cond_t* cond,
+    pthread_mutex_t* mutex,
+    uint32_t timeout,
+    const struct timespec* deadline);
+
+/** Get monotonic time in nanoseconds
+ *
+ * @return     nanoseconds since an arbitrary point
+ */
+uint64_t furi_host_get_time_ns(void);
+
+/** Flags group, shared by event flags and thread flags */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t bits;
+} FuriHostFlags;
+
+void furi_host_flags_init(FuriHostFlags* flags);
+
+void furi_host_flags_deinit(FuriHostFlags* flags);
+
+/** Set flags, returns flags after setting */
+uint32_t furi_host_flags_set(FuriHostFlags* flags, uint32_t bits);
+
+/** Clear flags, returns flags before clearing */
+uint32_t furi_host_flags_clear(FuriHostFlags* flags, uint32_t bits);
+
+uint32_t furi_host_flags_get(FuriHostFlags* flags);
+
+/** Wait for flags, semantic matches furi_event_flag_wait */
+uint32_t
+    furi_host_flags_wait(FuriHostFlags* flags, uint32_t bits, uint32_t options, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+#include "host_i.h"
+
+#include <core/kernel.h>
+#include <core/check.h>
+
+#include <errno.h>
+#include <sched.h>
+
+void furi_host_cond_init(pthread_cond_t* cond) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    furi_check(pthread_cond_init(cond, &attr) == 0);
+    pthread_condattr_destroy(&attr);
+}
+
+void furi_host_deadline(uint32_t timeout, struct timespec* deadline) {
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    if(timeout == FuriWaitForever) return;
+
+    deadline->tv_sec += timeout / 1000U;
+    deadline->tv_nsec += (long)(timeout % 1000U) * 1000000L;
+    if(deadline->tv_nsec >= 1000000000L) {
+        deadline->tv_sec += 1;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+bool furi_host_cond_wait(
+    pthread_cond_t* cond,
+    pthread_mutex_t* mutex,
+    uint32_t timeout,
+    const struct timespec* deadline) {
+    if(timeout == FuriWaitForever) {
+        pthread_cond_wait(cond, mutex);
+        return true;
+    }
+
+    return pthread_cond_timedwait(cond, mutex, deadline) != ETIMEDOUT;
+}
+
+uint64_t furi_host_get_time_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+bool furi_kernel_is_irq_or_masked(void) {
+    return false;
+}
+
+bool furi_kernel_is_running(void) {
+    return true;
+}
+
+int32_t furi_kernel_lock(void) {
+    return 0;
+}
+
+int32_t furi_kernel_unlock(void) {
+    return 0;
+}
+
+int32_t furi_kernel_restore_lock(int32_t lock) {
+    return lock;
+}
+
+uint32_t furi_kernel_get_tick_frequency(void) {
+    return 1000U;
+}
+
+void furi_delay_tick(uint32_t ticks) {
+    if(ticks == 0U) {
+        sched_yield();
+    } else {
+        furi_delay_ms(ticks);
+    }
+}
+
+FuriStatus furi_delay_until_tick(uint32_t tick) {
+    const uint32_t delay = tick - furi_get_tick();
+    // Tick is in the past if difference overflows into upper half
+    if(delay != 0U && delay < 0x7FFFFFFFU) {
+        furi_delay_tick(delay);
+    }
+    return FuriStatusOk;
+}
+
+uint32_t furi_get_tick(void) {
+    return (uint32_t)(furi_host_get_time_ns() / 1000000ULL);
+}
+
+uint32_t furi_ms_to_ticks(uint32_t milliseconds) {
+    return milliseconds;
+}
+
+void furi_delay_ms(uint32_t milliseconds) {
+    if(milliseconds == 0U) {
+        sched_yield();
+    } else {
+        furi_delay_us(milliseconds * 1000U);
+    }
+}
+
+void furi_delay_us(uint32_t microseconds) {
+    struct timespec delay = {
+        .tv_sec = microseconds / 1000000U,
+        .tv_nsec = (long)(microseconds % 1000000U) * 1000L,
+    };
+    while(nanosleep(&delay, &delay) != 0 && errno == EINTR) {
+    }
+}
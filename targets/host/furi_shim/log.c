@@ -0,0 +1,177 @@
+#include <core/log.h>
+#include <core/check.h>
+#include <core/kernel.h>
+#include <core/common_defines.h>
+
+#include <pthread.h>
+#include <string.h>
+
+#define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
+#define FURI_LOG_HANDLERS_MAX  (4U)
+
+typedef struct {
+    FuriLogLevel log_level;
+    pthread_mutex_t mutex;
+    FuriLogHandler handlers[FURI_LOG_HANDLERS_MAX];
+    size_t handlers_count;
+} FuriLogParams;
+
+static FuriLogParams furi_log = {
+    .log_level = FURI_LOG_LEVEL_DEFAULT,
+    .mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP,
+};
+
+typedef struct {
+    char letter;
+    const char* color;
+} FuriLogLevelDescription;
+
+static const FuriLogLevelDescription FURI_LOG_LEVEL_DESCRIPTIONS[] = {
+    [FuriLogLevelError] = {'E', _FURI_LOG_CLR_E},
+    [FuriLogLevelWarn] = {'W', _FURI_LOG_CLR_W},
+    [FuriLogLevelInfo] = {'I', _FURI_LOG_CLR_I},
+    [FuriLogLevelDebug] = {'D', _FURI_LOG_CLR_D},
+    [FuriLogLevelTrace] = {'T', _FURI_LOG_CLR_T},
+};
+
+typedef struct {
+    const char* str;
+    FuriLogLevel level;
+} FuriLogLevelName;
+
+static const FuriLogLevelName FURI_LOG_LEVEL_NAMES[] = {
+    {"default", FuriLogLevelDefault},
+    {"none", FuriLogLevelNone},
+    {"error", FuriLogLevelError},
+    {"warn", FuriLogLevelWarn},
+    {"info", FuriLogLevelInfo},
+    {"debug", FuriLogLevelDebug},
+    {"trace", FuriLogLevelTrace},
+};
+
+void furi_log_init(void) {
+    furi_log.log_level = FURI_LOG_LEVEL_DEFAULT;
+}
+
+bool furi_log_add_handler(FuriLogHandler handler) {
+    furi_check(handler.callback);
+
+    bool result = false;
+    pthread_mutex_lock(&furi_log.mutex);
+    if(furi_log.handlers_count < FURI_LOG_HANDLERS_MAX) {
+        furi_log.handlers[furi_log.handlers_count++] = handler;
+        result = true;
+    }
+    pthread_mutex_unlock(&furi_log.mutex);
+
+    return result;
+}
+
+bool furi_log_remove_handler(FuriLogHandler handler) {
+    bool result = false;
+    pthread_mutex_lock(&furi_log.mutex);
+    for(size_t i = 0; i < furi_log.handlers_count; i++) {
+        if(furi_log.handlers[i].callback == handler.callback &&
+           furi_log.handlers[i].context == handler.context) {
+            furi_log.handlers[i] = furi_log.handlers[--furi_log.handlers_count];
+            result = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&furi_log.mutex);
+
+    return result;
+}
+
+void furi_log_tx(const uint8_t* data, size_t size) {
+    pthread_mutex_lock(&furi_log.mutex);
+    fwrite(data, 1, size, stderr);
+    for(size_t i = 0; i < furi_log.handlers_count; i++) {
+        furi_log.handlers[i].callback(data, size, furi_log.handlers[i].context);
+    }
+    pthread_mutex_unlock(&furi_log.mutex);
+}
+
+void furi_log_puts(const char* data) {
+    furi_check(data);
+    furi_log_tx((const uint8_t*)data, strlen(data));
+}
+
+static void furi_log_print_va(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    if(level > furi_log.log_level || level <= FuriLogLevelNone) return;
+
+    char buffer[256];
+    int length = 0;
+
+    pthread_mutex_lock(&furi_log.mutex);
+    if(tag) {
+        length = snprintf(
+            buffer,
+            sizeof(buffer),
+            "%lu %s[%c][%s]: " _FURI_LOG_CLR_RESET,
+            (unsigned long)furi_get_tick(),
+            FURI_LOG_LEVEL_DESCRIPTIONS[level].color,
+            FURI_LOG_LEVEL_DESCRIPTIONS[level].letter,
+            tag);
+        furi_log_tx((const uint8_t*)buffer, MIN((size_t)length, sizeof(buffer) - 1));
+    }
+
+    length = vsnprintf(buffer, sizeof(buffer), format, args);
+    if(length > 0) {
+        furi_log_tx((const uint8_t*)buffer, MIN((size_t)length, sizeof(buffer) - 1));
+    }
+
+    if(tag) {
+        furi_log_puts("\r\n");
+    }
+    pthread_mutex_unlock(&furi_log.mutex);
+}
+
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    furi_log_print_va(level, tag ? tag : "", format, args);
+    va_end(args);
+}
+
+void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    furi_log_print_va(level, NULL, format, args);
+    va_end(args);
+}
+
+void furi_log_set_level(FuriLogLevel level) {
+    if(level == FuriLogLevelDefault) {
+        level = FURI_LOG_LEVEL_DEFAULT;
+    }
+    furi_log.log_level = level;
+}
+
+FuriLogLevel furi_log_get_level(void) {
+    return furi_log.log_level;
+}
+
+bool furi_log_level_to_string(FuriLogLevel level, const char** str) {
+    for(size_t i = 0; i < COUNT_OF(FURI_LOG_LEVEL_NAMES); i++) {
+        if(level == FURI_LOG_LEVEL_NAMES[i].level) {
+            *str = FURI_LOG_LEVEL_NAMES[i].str;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool furi_log_level_from_string(const char* str, FuriLogLevel* level) {
+    for(size_t i = 0; i < COUNT_OF(FURI_LOG_LEVEL_NAMES); i++) {
+        if(strcmp(str, FURI_LOG_LEVEL_NAMES[i].str) == 0) {
+            *level = FURI_LOG_LEVEL_NAMES[i].level;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,143 @@
+/**
+ * Host memory manager
+ *
+ * Allocation functions are wrapped at link time (-Wl,--wrap=malloc,...) to
+ * mirror firmware heap behavior: memory is zeroed and allocation failure is
+ * fatal. Every call is counted for benchmark allocation statistics.
+ */
+#include <core/memmgr.h>
+#include <core/memmgr_heap.h>
+#include <memmgr_host.h>
+
+#include <stdatomic.h>
+#include <string.h>
+
+extern void* __real_malloc(size_t size);
+extern void __real_free(void* ptr);
+extern void* __real_calloc(size_t count, size_t size);
+extern void* __real_realloc(void* ptr, size_t size);
+
+static atomic_uint_fast64_t memmgr_host_alloc_count = 0;
+static atomic_uint_fast64_t memmgr_host_free_count = 0;
+static atomic_uint_fast64_t memmgr_host_alloc_bytes = 0;
+static atomic_size_t memmgr_host_pool_used = 0;
+
+#define MEMMGR_HOST_TOTAL_HEAP (64U * 1024U * 1024U)
+#define MEMMGR_HOST_POOL_SIZE  (64U * 1024U)
+
+static inline void memmgr_host_account_alloc(size_t size) {
+    atomic_fetch_add_explicit(&memmgr_host_alloc_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&memmgr_host_alloc_bytes, size, memory_order_relaxed);
+}
+
+void* __wrap_malloc(size_t size) {
+    memmgr_host_account_alloc(size);
+    void* p = __real_calloc(1, size ? size : 1);
+    furi_check(p, size ? "out of memory" : "malloc(0)");
+    return p;
+}
+
+void __wrap_free(void* ptr) {
+    if(ptr) {
+        atomic_fetch_add_explicit(&memmgr_host_free_count, 1, memory_order_relaxed);
+    }
+    __real_free(ptr);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    memmgr_host_account_alloc(count * size);
+    void* p = __real_calloc(count ? count : 1, size ? size : 1);
+    furi_check(p, "out of memory");
+    return p;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    if(size == 0) {
+        __wrap_free(ptr);
+        return NULL;
+    }
+
+    memmgr_host_account_alloc(size);
+    void* p = __real_realloc(ptr, size);
+    furi_check(p, "out of memory");
+    return p;
+}
+
+char* __wrap_strdup(const char* s) {
+    furi_check(s);
+
+    size_t size = strlen(s) + 1;
+    char* y = __wrap_malloc(size);
+    memcpy(y, s, size);
+
+    return y;
+}
+
+void memmgr_host_get_stats(MemmgrHostStats* stats) {
+    furi_check(stats);
+    stats->alloc_count = atomic_load_explicit(&memmgr_host_alloc_count, memory_order_relaxed);
+    stats->free_count = atomic_load_explicit(&memmgr_host_free_count, memory_order_relaxed);
+    stats->alloc_bytes = atomic_load_explicit(&memmgr_host_alloc_bytes, memory_order_relaxed);
+}
+
+size_t memmgr_get_free_heap(void) {
+    return MEMMGR_HOST_TOTAL_HEAP;
+}
+
+size_t memmgr_get_total_heap(void) {
+    return MEMMGR_HOST_TOTAL_HEAP;
+}
+
+size_t memmgr_get_minimum_free_heap(void) {
+    return MEMMGR_HOST_TOTAL_HEAP;
+}
+
+void* memmgr_alloc_from_pool(size_t size) {
+    atomic_fetch_add_explicit(&memmgr_host_pool_used, size, memory_order_relaxed);
+    return malloc(size);
+}
+
+size_t memmgr_pool_get_free(void) {
+    size_t used = atomic_load_explicit(&memmgr_host_pool_used, memory_order_relaxed);
+    return used < MEMMGR_HOST_POOL_SIZE ? MEMMGR_HOST_POOL_SIZE - used : 0;
+}
+
+size_t memmgr_pool_get_max_block(void) {
+    return memmgr_pool_get_free();
+}
+
+void* aligned_malloc(size_t size, size_t alignment) {
+    void* p1; // original block
+    void** p2; // aligned block
+    int offset = alignment - 1 + sizeof(void*);
+    if((p1 = (void*)malloc(size + offset)) == NULL) {
+        return NULL;
+    }
+    p2 = (void**)(((size_t)(p1) + offset) & ~(alignment - 1));
+    p2[-1] = p1;
+    return p2;
+}
+
+void aligned_free(void* p) {
+    free(((void**)p)[-1]);
+}
+
+void memmgr_heap_enable_thread_trace(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+}
+
+void memmgr_heap_disable_thread_trace(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+}
+
+size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+    return MEMMGR_HEAP_UNKNOWN;
+}
+
+size_t memmgr_heap_get_max_free_block(void) {
+    return MEMMGR_HOST_TOTAL_HEAP;
+}
+
+void memmgr_heap_printf_free_blocks(void) {
+}
@@ -0,0 +1,140 @@
+#include "host_i.h"
+
+#include <core/message_queue.h>
+#include <core/check.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct FuriMessageQueue {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    uint32_t msg_count;
+    uint32_t msg_size;
+    uint32_t head;
+    uint32_t count;
+    uint8_t buffer[];
+};
+
+FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
+    furi_check((msg_count > 0U) && (msg_size > 0U));
+
+    FuriMessageQueue* instance = malloc(sizeof(FuriMessageQueue) + msg_count * msg_size);
+    furi_check(pthread_mutex_init(&instance->lock, NULL) == 0);
+    furi_host_cond_init(&instance->not_empty);
+    furi_host_cond_init(&instance->not_full);
+    instance->msg_count = msg_count;
+    instance->msg_size = msg_size;
+
+    return instance;
+}
+
+void furi_message_queue_free(FuriMessageQueue* instance) {
+    furi_check(instance);
+
+    pthread_cond_destroy(&instance->not_full);
+    pthread_cond_destroy(&instance->not_empty);
+    pthread_mutex_destroy(&instance->lock);
+    free(instance);
+}
+
+FuriStatus
+    furi_message_queue_put(FuriMessageQueue* instance, const void* msg_ptr, uint32_t timeout) {
+    furi_check(instance);
+    furi_check(msg_ptr);
+
+    FuriStatus status = FuriStatusOk;
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&instance->lock);
+    while(instance->count == instance->msg_count) {
+        if(timeout == 0U ||
+           !furi_host_cond_wait(&instance->not_full, &instance->lock, timeout, &deadline)) {
+            status = timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+            break;
+        }
+    }
+
+    if(status == FuriStatusOk) {
+        uint32_t tail = (instance->head + instance->count) % instance->msg_count;
+        memcpy(&instance->buffer[tail * instance->msg_size], msg_ptr, instance->msg_size);
+        instance->count++;
+        pthread_cond_signal(&instance->not_empty);
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uint32_t timeout) {
+    furi_check(instance);
+    furi_check(msg_ptr);
+
+    FuriStatus status = FuriStatusOk;
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&instance->lock);
+    while(instance->count == 0U) {
+        if(timeout == 0U ||
+           !furi_host_cond_wait(&instance->not_empty, &instance->lock, timeout, &deadline)) {
+            status = timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+            break;
+        }
+    }
+
+    if(status == FuriStatusOk) {
+        memcpy(
+            msg_ptr, &instance->buffer[instance->head * instance->msg_size], instance->msg_size);
+        instance->head = (instance->head + 1) % instance->msg_count;
+        instance->count--;
+        pthread_cond_signal(&instance->not_full);
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+uint32_t furi_message_queue_get_capacity(FuriMessageQueue* instance) {
+    furi_check(instance);
+    return instance->msg_count;
+}
+
+uint32_t furi_message_queue_get_message_size(FuriMessageQueue* instance) {
+    furi_check(instance);
+    return instance->msg_size;
+}
+
+uint32_t furi_message_queue_get_count(FuriMessageQueue* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    uint32_t count = instance->count;
+    pthread_mutex_unlock(&instance->lock);
+
+    return count;
+}
+
+uint32_t furi_message_queue_get_space(FuriMessageQueue* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    uint32_t space = instance->msg_count - instance->count;
+    pthread_mutex_unlock(&instance->lock);
+
+    return space;
+}
+
+FuriStatus furi_message_queue_reset(FuriMessageQueue* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    instance->head = 0;
+    instance->count = 0;
+    pthread_cond_broadcast(&instance->not_full);
+    pthread_mutex_unlock(&instance->lock);
+
+    return FuriStatusOk;
+}
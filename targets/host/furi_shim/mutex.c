@@ -0,0 +1,96 @@
+#include "host_i.h"
+
+#include <core/mutex.h>
+#include <core/check.h>
+
+#include <stdlib.h>
+
+struct FuriMutex {
+    FuriMutexType type;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    FuriThreadId owner;
+    uint32_t count;
+};
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type) {
+    furi_check(type == FuriMutexTypeNormal || type == FuriMutexTypeRecursive);
+
+    FuriMutex* instance = malloc(sizeof(FuriMutex));
+    instance->type = type;
+    furi_check(pthread_mutex_init(&instance->lock, NULL) == 0);
+    furi_host_cond_init(&instance->cond);
+
+    return instance;
+}
+
+void furi_mutex_free(FuriMutex* instance) {
+    furi_check(instance);
+    furi_check(instance->count == 0);
+
+    pthread_cond_destroy(&instance->cond);
+    pthread_mutex_destroy(&instance->lock);
+    free(instance);
+}
+
+FuriStatus furi_mutex_acquire(FuriMutex* instance, uint32_t timeout) {
+    furi_check(instance);
+
+    FuriThreadId current = furi_thread_get_current_id();
+    FuriStatus status = FuriStatusOk;
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&instance->lock);
+    if(instance->count && instance->owner == current) {
+        // Normal mutex taken twice by the same thread would deadlock on device
+        if(instance->type == FuriMutexTypeRecursive) {
+            instance->count++;
+        } else {
+            status = timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+        }
+    } else {
+        while(instance->count) {
+            if(timeout == 0 ||
+               !furi_host_cond_wait(&instance->cond, &instance->lock, timeout, &deadline)) {
+                status = timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+                break;
+            }
+        }
+
+        if(status == FuriStatusOk) {
+            instance->owner = current;
+            instance->count = 1;
+        }
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+FuriStatus furi_mutex_release(FuriMutex* instance) {
+    furi_check(instance);
+
+    FuriStatus status = FuriStatusOk;
+
+    pthread_mutex_lock(&instance->lock);
+    if(!instance->count || instance->owner != furi_thread_get_current_id()) {
+        status = FuriStatusErrorResource;
+    } else if(--instance->count == 0) {
+        instance->owner = NULL;
+        pthread_cond_signal(&instance->cond);
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+FuriThreadId furi_mutex_get_owner(FuriMutex* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    FuriThreadId owner = instance->count ? instance->owner : NULL;
+    pthread_mutex_unlock(&instance->lock);
+
+    return owner;
+}
@@ -0,0 +1,93 @@
+#include "host_i.h"
+
+#include <core/semaphore.h>
+#include <core/check.h>
+
+#include <stdlib.h>
+
+struct FuriSemaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t max_count;
+    uint32_t count;
+};
+
+FuriSemaphore* furi_semaphore_alloc(uint32_t max_count, uint32_t initial_count) {
+    furi_check((max_count > 0U) && (initial_count <= max_count));
+
+    FuriSemaphore* instance = malloc(sizeof(FuriSemaphore));
+    furi_check(pthread_mutex_init(&instance->lock, NULL) == 0);
+    furi_host_cond_init(&instance->cond);
+    instance->max_count = max_count;
+    instance->count = initial_count;
+
+    return instance;
+}
+
+void furi_semaphore_free(FuriSemaphore* instance) {
+    furi_check(instance);
+
+    pthread_cond_destroy(&instance->cond);
+    pthread_mutex_destroy(&instance->lock);
+    free(instance);
+}
+
+FuriStatus furi_semaphore_acquire(FuriSemaphore* instance, uint32_t timeout) {
+    furi_check(instance);
+
+    FuriStatus status = FuriStatusOk;
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&instance->lock);
+    while(instance->count == 0U) {
+        if(timeout == 0U ||
+           !furi_host_cond_wait(&instance->cond, &instance->lock, timeout, &deadline)) {
+            status = timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+            break;
+        }
+    }
+    if(status == FuriStatusOk) {
+        instance->count--;
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+FuriStatus furi_semaphore_release(FuriSemaphore* instance) {
+    furi_check(instance);
+
+    FuriStatus status = FuriStatusOk;
+
+    pthread_mutex_lock(&instance->lock);
+    if(instance->count < instance->max_count) {
+        instance->count++;
+        pthread_cond_signal(&instance->cond);
+    } else {
+        status = FuriStatusErrorResource;
+    }
+    pthread_mutex_unlock(&instance->lock);
+
+    return status;
+}
+
+uint32_t furi_semaphore_get_count(FuriSemaphore* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    uint32_t count = instance->count;
+    pthread_mutex_unlock(&instance->lock);
+
+    return count;
+}
+
+uint32_t furi_semaphore_get_space(FuriSemaphore* instance) {
+    furi_check(instance);
+
+    pthread_mutex_lock(&instance->lock);
+    uint32_t space = instance->max_count - instance->count;
+    pthread_mutex_unlock(&instance->lock);
+
+    return space;
+}
@@ -0,0 +1,173 @@
+#include "host_i.h"
+
+#include <core/stream_buffer.h>
+#include <core/check.h>
+#include <core/common_defines.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct FuriStreamBuffer {
+    pthread_mutex_t lock;
+    pthread_cond_t data_available;
+    pthread_cond_t space_available;
+    size_t size;
+    size_t trigger_level;
+    size_t head;
+    size_t count;
+    uint8_t buffer[];
+};
+
+FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level) {
+    furi_check(size != 0);
+
+    FuriStreamBuffer* stream_buffer = malloc(sizeof(FuriStreamBuffer) + size);
+    furi_check(pthread_mutex_init(&stream_buffer->lock, NULL) == 0);
+    furi_host_cond_init(&stream_buffer->data_available);
+    furi_host_cond_init(&stream_buffer->space_available);
+    stream_buffer->size = size;
+    stream_buffer->trigger_level = trigger_level ? trigger_level : 1;
+
+    return stream_buffer;
+}
+
+void furi_stream_buffer_free(FuriStreamBuffer* stream_buffer) {
+    furi_check(stream_buffer);
+
+    pthread_cond_destroy(&stream_buffer->space_available);
+    pthread_cond_destroy(&stream_buffer->data_available);
+    pthread_mutex_destroy(&stream_buffer->lock);
+    free(stream_buffer);
+}
+
+bool furi_stream_set_trigger_level(FuriStreamBuffer* stream_buffer, size_t trigger_level) {
+    furi_check(stream_buffer);
+
+    if(trigger_level > stream_buffer->size) return false;
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    stream_buffer->trigger_level = trigger_level ? trigger_level : 1;
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return true;
+}
+
+size_t furi_stream_buffer_send(
+    FuriStreamBuffer* stream_buffer,
+    const void* data,
+    size_t length,
+    uint32_t timeout) {
+    furi_check(stream_buffer);
+
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    // Same as FreeRTOS: wait for the whole message to fit, then write as much as possible
+    const size_t required = MIN(length, stream_buffer->size);
+    while(stream_buffer->size - stream_buffer->count < required) {
+        if(timeout == 0U || !furi_host_cond_wait(
+                                &stream_buffer->space_available,
+                                &stream_buffer->lock,
+                                timeout,
+                                &deadline)) {
+            break;
+        }
+    }
+
+    const size_t to_write = MIN(length, stream_buffer->size - stream_buffer->count);
+    const uint8_t* source = data;
+    for(size_t written = 0; written < to_write;) {
+        size_t tail = (stream_buffer->head + stream_buffer->count) % stream_buffer->size;
+        size_t chunk = MIN(to_write - written, stream_buffer->size - tail);
+        memcpy(&stream_buffer->buffer[tail], &source[written], chunk);
+        stream_buffer->count += chunk;
+        written += chunk;
+    }
+
+    if(stream_buffer->count >= stream_buffer->trigger_level) {
+        pthread_cond_broadcast(&stream_buffer->data_available);
+    }
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return to_write;
+}
+
+size_t furi_stream_buffer_receive(
+    FuriStreamBuffer* stream_buffer,
+    void* data,
+    size_t length,
+    uint32_t timeout) {
+    furi_check(stream_buffer);
+
+    struct timespec deadline;
+    furi_host_deadline(timeout, &deadline);
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    while(stream_buffer->count < stream_buffer->trigger_level) {
+        if(timeout == 0U || !furi_host_cond_wait(
+                                &stream_buffer->data_available,
+                                &stream_buffer->lock,
+                                timeout,
+                                &deadline)) {
+            break;
+        }
+    }
+
+    const size_t to_read = MIN(length, stream_buffer->count);
+    uint8_t* destination = data;
+    for(size_t read = 0; read < to_read;) {
+        size_t chunk = MIN(to_read - read, stream_buffer->size - stream_buffer->head);
+        memcpy(&destination[read], &stream_buffer->buffer[stream_buffer->head], chunk);
+        stream_buffer->head = (stream_buffer->head + chunk) % stream_buffer->size;
+        stream_buffer->count -= chunk;
+        read += chunk;
+    }
+
+    if(to_read > 0) {
+        pthread_cond_broadcast(&stream_buffer->space_available);
+    }
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return to_read;
+}
+
+size_t furi_stream_buffer_bytes_available(FuriStreamBuffer* stream_buffer) {
+    furi_check(stream_buffer);
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    size_t count = stream_buffer->count;
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return count;
+}
+
+size_t furi_stream_buffer_spaces_available(FuriStreamBuffer* stream_buffer) {
+    furi_check(stream_buffer);
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    size_t space = stream_buffer->size - stream_buffer->count;
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return space;
+}
+
+bool furi_stream_buffer_is_full(FuriStreamBuffer* stream_buffer) {
+    return furi_stream_buffer_spaces_available(stream_buffer) == 0;
+}
+
+bool furi_stream_buffer_is_empty(FuriStreamBuffer* stream_buffer) {
+    return furi_stream_buffer_bytes_available(stream_buffer) == 0;
+}
+
+FuriStatus furi_stream_buffer_reset(FuriStreamBuffer* stream_buffer) {
+    furi_check(stream_buffer);
+
+    pthread_mutex_lock(&stream_buffer->lock);
+    stream_buffer->head = 0;
+    stream_buffer->count = 0;
+    pthread_cond_broadcast(&stream_buffer->space_available);
+    pthread_mutex_unlock(&stream_buffer->lock);
+
+    return FuriStatusOk;
+}
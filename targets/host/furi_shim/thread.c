@@ -0,0 +1,364 @@
+#include "host_i.h"
+
+#include <core/thread.h>
+#include <core/check.h>
+#include <core/log.h>
+#include <core/common_defines.h>
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TAG "FuriThread"
+
+struct FuriThread {
+    FuriThreadState state;
+    int32_t ret;
+
+    FuriThreadCallback callback;
+    void* context;
+
+    FuriThreadStateCallback state_callback;
+    void* state_context;
+
+    FuriThreadSignalCallback signal_callback;
+    void* signal_context;
+
+    char* name;
+    char* appid;
+
+    FuriThreadPriority priority;
+    size_t stack_size;
+    bool is_service;
+    bool is_external;
+
+    pthread_t handle;
+    FuriHostFlags flags;
+
+    FuriThreadStdoutWriteCallback stdout_callback;
+};
+
+static __thread FuriThread* furi_thread_current = NULL;
+
+static void furi_thread_set_state(FuriThread* thread, FuriThreadState state) {
+    __atomic_store_n(&thread->state, state, __ATOMIC_RELEASE);
+    if(thread->state_callback) {
+        thread->state_callback(state, thread->state_context);
+    }
+}
+
+static void* furi_thread_body(void* context) {
+    FuriThread* thread = context;
+    furi_thread_current = thread;
+
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStarting);
+    furi_thread_set_state(thread, FuriThreadStateRunning);
+
+    thread->ret = thread->callback(thread->context);
+
+    furi_check(!thread->is_service, "Service threads MUST NOT return");
+
+    furi_thread_set_state(thread, FuriThreadStateStopped);
+
+    return NULL;
+}
+
+FuriThread* furi_thread_alloc(void) {
+    FuriThread* thread = malloc(sizeof(FuriThread));
+    furi_host_flags_init(&thread->flags);
+    thread->priority = FuriThreadPriorityNormal;
+
+    FuriThread* parent = furi_thread_get_current();
+    if(parent && parent->appid) {
+        furi_thread_set_appid(thread, parent->appid);
+    }
+
+    return thread;
+}
+
+FuriThread* furi_thread_alloc_service(
+    const char* name,
+    uint32_t stack_size,
+    FuriThreadCallback callback,
+    void* context) {
+    FuriThread* thread = furi_thread_alloc_ex(name, stack_size, callback, context);
+    thread->is_service = true;
+    return thread;
+}
+
+FuriThread* furi_thread_alloc_ex(
+    const char* name,
+    uint32_t stack_size,
+    FuriThreadCallback callback,
+    void* context) {
+    FuriThread* thread = furi_thread_alloc();
+    furi_thread_set_name(thread, name);
+    furi_thread_set_stack_size(thread, stack_size);
+    furi_thread_set_callback(thread, callback);
+    furi_thread_set_context(thread, context);
+    return thread;
+}
+
+void furi_thread_free(FuriThread* thread) {
+    furi_check(thread);
+    furi_check(!thread->is_service);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    furi_check(!thread->is_external);
+
+    furi_host_flags_deinit(&thread->flags);
+    free(thread->name);
+    free(thread->appid);
+    free(thread);
+}
+
+void furi_thread_set_name(FuriThread* thread, const char* name) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+
+    free(thread->name);
+    thread->name = name ? strdup(name) : NULL;
+}
+
+void furi_thread_set_appid(FuriThread* thread, const char* appid) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+
+    free(thread->appid);
+    thread->appid = appid ? strdup(appid) : NULL;
+}
+
+void furi_thread_set_stack_size(FuriThread* thread, size_t stack_size) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    thread->stack_size = stack_size;
+}
+
+void furi_thread_set_callback(FuriThread* thread, FuriThreadCallback callback) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    thread->callback = callback;
+}
+
+void furi_thread_set_context(FuriThread* thread, void* context) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    thread->context = context;
+}
+
+void furi_thread_set_priority(FuriThread* thread, FuriThreadPriority priority) {
+    furi_check(thread);
+    furi_check(priority <= FuriThreadPriorityIsr);
+    thread->priority = priority;
+}
+
+FuriThreadPriority furi_thread_get_priority(FuriThread* thread) {
+    furi_check(thread);
+    return thread->priority;
+}
+
+void furi_thread_set_current_priority(FuriThreadPriority priority) {
+    furi_check(priority <= FuriThreadPriorityIsr);
+    furi_thread_get_current()->priority = priority;
+}
+
+FuriThreadPriority furi_thread_get_current_priority(void) {
+    return furi_thread_get_current()->priority;
+}
+
+void furi_thread_set_state_callback(FuriThread* thread, FuriThreadStateCallback callback) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    thread->state_callback = callback;
+}
+
+void furi_thread_set_state_context(FuriThread* thread, void* context) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    thread->state_context = context;
+}
+
+FuriThreadState furi_thread_get_state(FuriThread* thread) {
+    furi_check(thread);
+    return __atomic_load_n(&thread->state, __ATOMIC_ACQUIRE);
+}
+
+void furi_thread_set_signal_callback(
+    FuriThread* thread,
+    FuriThreadSignalCallback callback,
+    void* context) {
+    furi_check(thread);
+    thread->signal_callback = callback;
+    thread->signal_context = context;
+}
+
+FuriThreadSignalCallback furi_thread_get_signal_callback(const FuriThread* thread) {
+    furi_check(thread);
+    return thread->signal_callback;
+}
+
+bool furi_thread_signal(const FuriThread* thread, uint32_t signal, void* arg) {
+    furi_check(thread);
+
+    bool is_consumed = false;
+    if(thread->signal_callback) {
+        is_consumed = thread->signal_callback(signal, arg, thread->signal_context);
+    }
+
+    return is_consumed;
+}
+
+void furi_thread_start(FuriThread* thread) {
+    furi_check(thread);
+    furi_check(thread->callback);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+
+    furi_thread_set_state(thread, FuriThreadStateStarting);
+
+    // Host stacks are not constrained, leave enough room for libc
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, MAX(thread->stack_size * 4, (size_t)(256 * 1024)));
+    furi_check(pthread_create(&thread->handle, &attr, furi_thread_body, thread) == 0);
+    pthread_attr_destroy(&attr);
+}
+
+bool furi_thread_join(FuriThread* thread) {
+    furi_check(thread);
+    furi_check(furi_thread_get_current() != thread);
+
+    if(thread->handle) {
+        pthread_join(thread->handle, NULL);
+        thread->handle = 0;
+    }
+
+    return true;
+}
+
+FuriThreadId furi_thread_get_id(FuriThread* thread) {
+    furi_check(thread);
+    return thread;
+}
+
+void furi_thread_enable_heap_trace(FuriThread* thread) {
+    UNUSED(thread);
+}
+
+void furi_thread_disable_heap_trace(FuriThread* thread) {
+    UNUSED(thread);
+}
+
+size_t furi_thread_get_heap_size(FuriThread* thread) {
+    UNUSED(thread);
+    return 0;
+}
+
+int32_t furi_thread_get_return_code(FuriThread* thread) {
+    furi_check(thread);
+    furi_check(furi_thread_get_state(thread) == FuriThreadStateStopped);
+    return thread->ret;
+}
+
+FuriThreadId furi_thread_get_current_id(void) {
+    return furi_thread_get_current();
+}
+
+FuriThread* furi_thread_get_current(void) {
+    // Threads not started through Furi, i.e. main, get an external record
+    if(!furi_thread_current) {
+        FuriThread* thread = calloc(1, sizeof(FuriThread));
+        furi_host_flags_init(&thread->flags);
+        thread->name = strdup("main");
+        thread->state = FuriThreadStateRunning;
+        thread->priority = FuriThreadPriorityNormal;
+        thread->is_external = true;
+        thread->handle = pthread_self();
+        furi_thread_current = thread;
+    }
+
+    return furi_thread_current;
+}
+
+void furi_thread_yield(void) {
+    sched_yield();
+}
+
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags) {
+    FuriThread* thread = thread_id;
+    furi_check(thread);
+
+    return furi_host_flags_set(&thread->flags, flags);
+}
+
+uint32_t furi_thread_flags_clear(uint32_t flags) {
+    return furi_host_flags_clear(&furi_thread_get_current()->flags, flags);
+}
+
+uint32_t furi_thread_flags_get(void) {
+    return furi_host_flags_get(&furi_thread_get_current()->flags);
+}
+
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    return furi_host_flags_wait(&furi_thread_get_current()->flags, flags, options, timeout);
+}
+
+bool furi_thread_enumerate(FuriThreadList* thread_list) {
+    UNUSED(thread_list);
+    return false;
+}
+
+const char* furi_thread_get_name(FuriThreadId thread_id) {
+    FuriThread* thread = thread_id;
+    return thread ? thread->name : NULL;
+}
+
+const char* furi_thread_get_appid(FuriThreadId thread_id) {
+    FuriThread* thread = thread_id;
+    return (thread && thread->appid) ? thread->appid : "system";
+}
+
+uint32_t furi_thread_get_stack_space(FuriThreadId thread_id) {
+    FuriThread* thread = thread_id;
+    return thread ? thread->stack_size : 0;
+}
+
+FuriThreadStdoutWriteCallback furi_thread_get_stdout_callback(void) {
+    return furi_thread_get_current()->stdout_callback;
+}
+
+void furi_thread_set_stdout_callback(FuriThreadStdoutWriteCallback callback) {
+    furi_thread_get_current()->stdout_callback = callback;
+}
+
+size_t furi_thread_stdout_write(const char* data, size_t size) {
+    FuriThread* thread = furi_thread_get_current();
+
+    if(size == 0 || data == NULL) {
+        fflush(stdout);
+    } else if(thread->stdout_callback) {
+        thread->stdout_callback(data, size);
+    } else {
+        fwrite(data, 1, size, stdout);
+    }
+
+    return size;
+}
+
+int32_t furi_thread_stdout_flush(void) {
+    fflush(stdout);
+    return 0;
+}
+
+void furi_thread_suspend(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+    FURI_LOG_W(TAG, "Thread suspend is not supported on host");
+}
+
+void furi_thread_resume(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+}
+
+bool furi_thread_is_suspended(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+    return false;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file cmsis_compiler.h
+ * Host replacement for CMSIS compiler header.
+ *
+ * There are no interrupts on host: all code runs in thread mode with
+ * interrupts enabled.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+
+#ifndef __ASM
+#define __ASM __asm
+#endif
+
+#ifndef __NOP
+#define __NOP() __asm volatile("nop")
+#endif
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void) {
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void) {
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void) {
+}
+
+__STATIC_FORCEINLINE void __enable_irq(void) {
+}
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value) {
+    value = ((value >> 1) & 0x55555555U) | ((value & 0x55555555U) << 1);
+    value = ((value >> 2) & 0x33333333U) | ((value & 0x33333333U) << 2);
+    value = ((value >> 4) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4);
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value) {
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value) {
+    return value ? (uint8_t)__builtin_clz(value) : 32U;
+}
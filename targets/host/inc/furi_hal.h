@@ -0,0 +1,26 @@
+/**
+ * @file furi_hal.h
+ * Host Furi HAL API
+ *
+ * Only the subset of Furi HAL that is used by portable libraries is
+ * available on host. Peripherals are either emulated or stubbed out.
+ */
+
+#pragma once
+
+#include <furi_hal_crypto.h>
+#include <furi_hal_gpio.h>
+#include <furi_hal_random.h>
+#include <furi_hal_rtc.h>
+#include <furi_hal_subghz.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Init host HAL: RNG seed, emulated RTC and crypto enclave */
+void furi_hal_init(void);
+
+#ifdef __cplusplus
+}
+#endif
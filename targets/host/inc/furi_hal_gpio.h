@@ -0,0 +1,98 @@
+/**
+ * @file furi_hal_gpio.h
+ * Host GPIO stub
+ *
+ * There are no pins on host: all pins read as low, writes are ignored.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Interrupt callback prototype
+ */
+typedef void (*GpioExtiCallback)(void* ctx);
+
+/**
+ * Gpio modes
+ */
+typedef enum {
+    GpioModeInput,
+    GpioModeOutputPushPull,
+    GpioModeOutputOpenDrain,
+    GpioModeAltFunctionPushPull,
+    GpioModeAltFunctionOpenDrain,
+    GpioModeAnalog,
+    GpioModeInterruptRise,
+    GpioModeInterruptFall,
+    GpioModeInterruptRiseFall,
+    GpioModeEventRise,
+    GpioModeEventFall,
+    GpioModeEventRiseFall,
+} GpioMode;
+
+/**
+ * Gpio pull modes
+ */
+typedef enum {
+    GpioPullNo,
+    GpioPullUp,
+    GpioPullDown,
+} GpioPull;
+
+/**
+ * Gpio speed modes
+ */
+typedef enum {
+    GpioSpeedLow,
+    GpioSpeedMedium,
+    GpioSpeedHigh,
+    GpioSpeedVeryHigh,
+} GpioSpeed;
+
+/**
+ * Gpio structure
+ */
+typedef struct {
+    void* port;
+    uint16_t pin;
+} GpioPin;
+
+/**
+ * GPIO initialization function, ignored on host
+ */
+void furi_hal_gpio_init(
+    const GpioPin* gpio,
+    const GpioMode mode,
+    const GpioPull pull,
+    const GpioSpeed speed);
+
+/**
+ * GPIO initialization function, simple version, ignored on host
+ */
+void furi_hal_gpio_init_simple(const GpioPin* gpio, const GpioMode mode);
+
+/**
+ * Write value to GPIO, ignored on host
+ */
+static inline void furi_hal_gpio_write(const GpioPin* gpio, const bool state) {
+    (void)gpio;
+    (void)state;
+}
+
+/**
+ * Read value from GPIO, always low on host
+ */
+static inline bool furi_hal_gpio_read(const GpioPin* gpio) {
+    (void)gpio;
+    return false;
+}
+
+#ifdef __cplusplus
+}
+#endif
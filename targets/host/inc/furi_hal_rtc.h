@@ -0,0 +1,9 @@
+/**
+ * @file furi_hal_rtc.h
+ * Host RTC HAL
+ *
+ * API is shared with f7 target, registers and flags are emulated in RAM.
+ */
+#pragma once
+
+#include "../../f7/furi_hal/furi_hal_rtc.h"
@@ -0,0 +1,44 @@
+/**
+ * @file furi_hal_subghz.h
+ * Host SubGhz HAL
+ *
+ * No radio on host, only configuration used by protocol code is available.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Check if frequency is in valid range
+ *
+ * @param      value  frequency in Hz
+ *
+ * @return     true if frequency is valid, otherwise false
+ */
+bool furi_hal_subghz_is_frequency_valid(uint32_t value);
+
+/** Check if transmission is allowed on this frequency, always true on host
+ *
+ * @param      value  frequency in Hz
+ *
+ * @return     true if allowed
+ */
+bool furi_hal_subghz_is_tx_allowed(uint32_t value);
+
+/** Get the current rolling protocols counter ++/-- value
+ * @return    int8_t current value
+ */
+int8_t furi_hal_subghz_get_rolling_counter_mult(void);
+
+/** Set the current rolling protocols counter ++/-- value
+ * @param      mult int8_t = -1, -10, -100, 0, 1, 10, 100 
+ */
+void furi_hal_subghz_set_rolling_counter_mult(int8_t mult);
+
+#ifdef __cplusplus
+}
+#endif
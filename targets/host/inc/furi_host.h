@@ -0,0 +1,18 @@
+/**
+ * @file furi_host.h
+ * Host build compatibility definitions.
+ *
+ * Force-included into every translation unit of the host build, provides the
+ * pieces of newlib and arm-none-eabi environment that portable code relies on.
+ */
+#pragma once
+
+#ifndef FURI_HOST
+#define FURI_HOST
+#endif
+
+#include <sys/cdefs.h>
+
+#ifndef _ATTRIBUTE
+#define _ATTRIBUTE(attrs) __attribute__(attrs)
+#endif
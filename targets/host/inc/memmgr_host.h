@@ -0,0 +1,27 @@
+/**
+ * @file memmgr_host.h
+ * Host memory manager statistics
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint64_t alloc_count; /**< Number of malloc/calloc/realloc/strdup calls */
+    uint64_t free_count; /**< Number of free calls with non-NULL pointer */
+    uint64_t alloc_bytes; /**< Total bytes requested */
+} MemmgrHostStats;
+
+/** Get allocation statistics since program start
+ *
+ * @param      stats  pointer to MemmgrHostStats to fill
+ */
+void memmgr_host_get_stats(MemmgrHostStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
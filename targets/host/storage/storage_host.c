@@ -0,0 +1,661 @@
+#include "storage_host.h"
+
+#include <furi.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TAG "StorageHost"
+
+#define STORAGE_HOST_COPY_BUFFER_SIZE (4096U)
+
+struct Storage {
+    FuriString* root;
+    FuriPubSub* pubsub;
+};
+
+typedef enum {
+    FileTypeClosed,
+    FileTypeOpenFile,
+    FileTypeOpenDir,
+} FileType;
+
+struct File {
+    Storage* storage;
+    FileType type;
+    FS_Error error_id;
+    int32_t internal_error_id;
+    FILE* file;
+    DIR* dir;
+};
+
+static Storage* storage_host = NULL;
+
+static FS_Error storage_host_errno_to_error(int error) {
+    switch(error) {
+    case 0:
+        return FSE_OK;
+    case ENOENT:
+    case ENOTDIR:
+        return FSE_NOT_EXIST;
+    case EEXIST:
+    case ENOTEMPTY:
+        return FSE_EXIST;
+    case EACCES:
+    case EPERM:
+    case EISDIR:
+        return FSE_DENIED;
+    case EINVAL:
+        return FSE_INVALID_PARAMETER;
+    case ENAMETOOLONG:
+        return FSE_INVALID_NAME;
+    default:
+        return FSE_INTERNAL;
+    }
+}
+
+static void storage_host_set_error(File* file, int error) {
+    file->internal_error_id = error;
+    file->error_id = storage_host_errno_to_error(error);
+}
+
+static void storage_host_resolve(Storage* storage, const char* path, FuriString* host_path) {
+    furi_check(path);
+
+    const char* suffix = path;
+    const char* storage_dir = "/ext";
+
+    if(strncmp(path, STORAGE_INT_PATH_PREFIX, strlen(STORAGE_INT_PATH_PREFIX)) == 0) {
+        suffix = path + strlen(STORAGE_INT_PATH_PREFIX);
+        storage_dir = "/int";
+    } else if(strncmp(path, STORAGE_EXT_PATH_PREFIX, strlen(STORAGE_EXT_PATH_PREFIX)) == 0) {
+        suffix = path + strlen(STORAGE_EXT_PATH_PREFIX);
+    } else if(strncmp(path, STORAGE_ANY_PATH_PREFIX, strlen(STORAGE_ANY_PATH_PREFIX)) == 0) {
+        suffix = path + strlen(STORAGE_ANY_PATH_PREFIX);
+    } else if(
+        strncmp(path, STORAGE_APP_DATA_PATH_PREFIX, strlen(STORAGE_APP_DATA_PATH_PREFIX)) == 0) {
+        suffix = path + strlen(STORAGE_APP_DATA_PATH_PREFIX);
+        storage_dir = "/ext/apps_data/host";
+    } else if(
+        strncmp(path, STORAGE_APP_ASSETS_PATH_PREFIX, strlen(STORAGE_APP_ASSETS_PATH_PREFIX)) ==
+        0) {
+        suffix = path + strlen(STORAGE_APP_ASSETS_PATH_PREFIX);
+        storage_dir = "/ext/apps_assets/host";
+    }
+
+    furi_string_printf(
+        host_path, "%s%s%s", furi_string_get_cstr(storage->root), storage_dir, suffix);
+}
+
+void storage_host_init(const char* root) {
+    furi_check(root);
+    furi_check(storage_host == NULL);
+
+    storage_host = malloc(sizeof(Storage));
+    storage_host->root = furi_string_alloc_set(root);
+    storage_host->pubsub = furi_pubsub_alloc();
+
+    mkdir(root, 0755);
+    FuriString* path = furi_string_alloc();
+    furi_string_printf(path, "%s/ext", root);
+    mkdir(furi_string_get_cstr(path), 0755);
+    furi_string_printf(path, "%s/int", root);
+    mkdir(furi_string_get_cstr(path), 0755);
+    furi_string_free(path);
+
+    furi_record_create(RECORD_STORAGE, storage_host);
+}
+
+void storage_host_deinit(void) {
+    furi_check(storage_host);
+
+    furi_record_destroy(RECORD_STORAGE);
+    furi_pubsub_free(storage_host->pubsub);
+    furi_string_free(storage_host->root);
+    free(storage_host);
+    storage_host = NULL;
+}
+
+FuriPubSub* storage_get_pubsub(Storage* storage) {
+    furi_check(storage);
+    return storage->pubsub;
+}
+
+/******************* File Functions *******************/
+
+File* storage_file_alloc(Storage* storage) {
+    furi_check(storage);
+
+    File* file = malloc(sizeof(File));
+    file->storage = storage;
+    file->type = FileTypeClosed;
+
+    return file;
+}
+
+void storage_file_free(File* file) {
+    furi_check(file);
+
+    if(file->type == FileTypeOpenFile) {
+        storage_file_close(file);
+    } else if(file->type == FileTypeOpenDir) {
+        storage_dir_close(file);
+    }
+
+    free(file);
+}
+
+bool storage_file_open(
+    File* file,
+    const char* path,
+    FS_AccessMode access_mode,
+    FS_OpenMode open_mode) {
+    furi_check(file);
+    furi_check(file->type == FileTypeClosed);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(file->storage, path, host_path);
+    const char* host_path_cstr = furi_string_get_cstr(host_path);
+
+    struct stat st;
+    bool exists = stat(host_path_cstr, &st) == 0;
+
+    const char* mode = NULL;
+    if(exists && S_ISDIR(st.st_mode)) {
+        storage_host_set_error(file, EISDIR);
+    } else if(open_mode == FSOM_OPEN_EXISTING) {
+        if(exists) mode = (access_mode & FSAM_WRITE) ? "r+b" : "rb";
+    } else if(open_mode == FSOM_CREATE_NEW) {
+        if(exists) {
+            storage_host_set_error(file, EEXIST);
+        } else {
+            mode = (access_mode & FSAM_READ) ? "w+b" : "wb";
+        }
+    } else if(open_mode == FSOM_CREATE_ALWAYS) {
+        mode = (access_mode & FSAM_READ) ? "w+b" : "wb";
+    } else if(open_mode == FSOM_OPEN_ALWAYS || open_mode == FSOM_OPEN_APPEND) {
+        mode = exists ? "r+b" : "w+b";
+    } else {
+        storage_host_set_error(file, EINVAL);
+    }
+
+    if(mode) {
+        file->file = fopen(host_path_cstr, mode);
+        if(file->file) {
+            file->type = FileTypeOpenFile;
+            storage_host_set_error(file, 0);
+            if(open_mode == FSOM_OPEN_APPEND) {
+                fseek(file->file, 0, SEEK_END);
+            }
+        } else {
+            storage_host_set_error(file, errno);
+        }
+    } else if(file->error_id == FSE_OK) {
+        storage_host_set_error(file, ENOENT);
+    }
+
+    furi_string_free(host_path);
+
+    return file->type == FileTypeOpenFile;
+}
+
+bool storage_file_close(File* file) {
+    furi_check(file);
+
+    if(file->type != FileTypeOpenFile) {
+        file->error_id = FSE_INVALID_PARAMETER;
+        return false;
+    }
+
+    bool result = fclose(file->file) == 0;
+    storage_host_set_error(file, result ? 0 : errno);
+    file->file = NULL;
+    file->type = FileTypeClosed;
+
+    StorageEvent event = {.type = StorageEventTypeFileClose};
+    furi_pubsub_publish(file->storage->pubsub, &event);
+
+    return result;
+}
+
+bool storage_file_is_open(File* file) {
+    furi_check(file);
+    return file->type != FileTypeClosed;
+}
+
+bool storage_file_is_dir(File* file) {
+    furi_check(file);
+    return file->type == FileTypeOpenDir;
+}
+
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return 0;
+
+    size_t result = fread(buff, 1, bytes_to_read, file->file);
+    storage_host_set_error(file, ferror(file->file) ? errno : 0);
+    clearerr(file->file);
+
+    return result;
+}
+
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return 0;
+
+    size_t result = fwrite(buff, 1, bytes_to_write, file->file);
+    storage_host_set_error(file, result == bytes_to_write ? 0 : errno);
+
+    return result;
+}
+
+bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return false;
+
+    // Same as on device: seeking past the end positions at the end
+    uint64_t size = storage_file_size(file);
+    uint64_t target = from_start ? offset : (uint64_t)ftello(file->file) + offset;
+    if(target > size) target = size;
+
+    bool result = fseeko(file->file, (off_t)target, SEEK_SET) == 0;
+    storage_host_set_error(file, result ? 0 : errno);
+
+    return result;
+}
+
+uint64_t storage_file_tell(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return 0;
+
+    return (uint64_t)ftello(file->file);
+}
+
+bool storage_file_expand(File* file, uint64_t size) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return false;
+
+    fflush(file->file);
+    bool result = true;
+    if(size > storage_file_size(file)) {
+        result = ftruncate(fileno(file->file), (off_t)size) == 0;
+    }
+    storage_host_set_error(file, result ? 0 : errno);
+
+    return result;
+}
+
+bool storage_file_truncate(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return false;
+
+    fflush(file->file);
+    bool result = ftruncate(fileno(file->file), ftello(file->file)) == 0;
+    storage_host_set_error(file, result ? 0 : errno);
+
+    return result;
+}
+
+uint64_t storage_file_size(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return 0;
+
+    fflush(file->file);
+    struct stat st;
+    if(fstat(fileno(file->file), &st) != 0) {
+        storage_host_set_error(file, errno);
+        return 0;
+    }
+
+    return (uint64_t)st.st_size;
+}
+
+bool storage_file_sync(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return false;
+
+    return fflush(file->file) == 0;
+}
+
+bool storage_file_eof(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenFile) return true;
+
+    return storage_file_tell(file) >= storage_file_size(file);
+}
+
+bool storage_file_exists(Storage* storage, const char* path) {
+    FileInfo fileinfo;
+    return storage_common_stat(storage, path, &fileinfo) == FSE_OK &&
+           !file_info_is_dir(&fileinfo);
+}
+
+bool storage_file_copy_to_file(File* source, File* destination, size_t size) {
+    uint8_t* buffer = malloc(STORAGE_HOST_COPY_BUFFER_SIZE);
+
+    while(size) {
+        size_t chunk = MIN(size, (size_t)STORAGE_HOST_COPY_BUFFER_SIZE);
+        size_t read = storage_file_read(source, buffer, chunk);
+        if(read != chunk) break;
+        if(storage_file_write(destination, buffer, read) != read) break;
+        size -= read;
+    }
+
+    free(buffer);
+
+    return size == 0;
+}
+
+/******************* Dir Functions *******************/
+
+bool storage_dir_open(File* file, const char* path) {
+    furi_check(file);
+    furi_check(file->type == FileTypeClosed);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(file->storage, path, host_path);
+
+    file->dir = opendir(furi_string_get_cstr(host_path));
+    if(file->dir) {
+        file->type = FileTypeOpenDir;
+        storage_host_set_error(file, 0);
+    } else {
+        storage_host_set_error(file, errno);
+    }
+
+    furi_string_free(host_path);
+
+    return file->type == FileTypeOpenDir;
+}
+
+bool storage_dir_close(File* file) {
+    furi_check(file);
+
+    if(file->type != FileTypeOpenDir) {
+        file->error_id = FSE_INVALID_PARAMETER;
+        return false;
+    }
+
+    closedir(file->dir);
+    file->dir = NULL;
+    file->type = FileTypeClosed;
+    storage_host_set_error(file, 0);
+
+    StorageEvent event = {.type = StorageEventTypeDirClose};
+    furi_pubsub_publish(file->storage->pubsub, &event);
+
+    return true;
+}
+
+bool storage_dir_read(File* file, FileInfo* fileinfo, char* name, uint16_t name_length) {
+    furi_check(file);
+    if(file->type != FileTypeOpenDir) return false;
+
+    struct dirent* entry;
+    do {
+        entry = readdir(file->dir);
+    } while(entry && (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0));
+
+    if(!entry) {
+        file->error_id = FSE_NOT_EXIST;
+        return false;
+    }
+
+    if(name && name_length) {
+        snprintf(name, name_length, "%s", entry->d_name);
+    }
+
+    if(fileinfo) {
+        struct stat st;
+        if(fstatat(dirfd(file->dir), entry->d_name, &st, 0) == 0) {
+            fileinfo->flags = S_ISDIR(st.st_mode) ? FSF_DIRECTORY : 0;
+            fileinfo->size = (uint64_t)st.st_size;
+        } else {
+            fileinfo->flags = 0;
+            fileinfo->size = 0;
+        }
+    }
+
+    storage_host_set_error(file, 0);
+
+    return true;
+}
+
+bool storage_dir_rewind(File* file) {
+    furi_check(file);
+    if(file->type != FileTypeOpenDir) return false;
+
+    rewinddir(file->dir);
+
+    return true;
+}
+
+bool storage_dir_exists(Storage* storage, const char* path) {
+    FileInfo fileinfo;
+    return storage_common_stat(storage, path, &fileinfo) == FSE_OK &&
+           file_info_is_dir(&fileinfo);
+}
+
+/******************* Common Functions *******************/
+
+FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp) {
+    furi_check(storage);
+    furi_check(timestamp);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(storage, path, host_path);
+
+    struct stat st;
+    FS_Error error = FSE_OK;
+    if(stat(furi_string_get_cstr(host_path), &st) == 0) {
+        *timestamp = (uint32_t)st.st_mtime;
+    } else {
+        error = storage_host_errno_to_error(errno);
+    }
+
+    furi_string_free(host_path);
+
+    return error;
+}
+
+FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
+    furi_check(storage);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(storage, path, host_path);
+
+    struct stat st;
+    FS_Error error = FSE_OK;
+    if(stat(furi_string_get_cstr(host_path), &st) == 0) {
+        if(fileinfo) {
+            fileinfo->flags = S_ISDIR(st.st_mode) ? FSF_DIRECTORY : 0;
+            fileinfo->size = (uint64_t)st.st_size;
+        }
+    } else {
+        error = storage_host_errno_to_error(errno);
+    }
+
+    furi_string_free(host_path);
+
+    return error;
+}
+
+FS_Error storage_common_remove(Storage* storage, const char* path) {
+    furi_check(storage);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(storage, path, host_path);
+
+    FS_Error error = FSE_OK;
+    if(remove(furi_string_get_cstr(host_path)) != 0) {
+        error = storage_host_errno_to_error(errno);
+    }
+
+    furi_string_free(host_path);
+
+    return error;
+}
+
+FS_Error storage_common_rename(Storage* storage, const char* old_path, const char* new_path) {
+    furi_check(storage);
+
+    if(storage_common_exists(storage, new_path)) {
+        return FSE_EXIST;
+    }
+
+    return storage_common_rename_safe(storage, old_path, new_path);
+}
+
+FS_Error storage_common_rename_safe(Storage* storage, const char* old_path, const char* new_path) {
+    furi_check(storage);
+
+    FuriString* host_old_path = furi_string_alloc();
+    FuriString* host_new_path = furi_string_alloc();
+    storage_host_resolve(storage, old_path, host_old_path);
+    storage_host_resolve(storage, new_path, host_new_path);
+
+    FS_Error error = FSE_OK;
+    if(rename(furi_string_get_cstr(host_old_path), furi_string_get_cstr(host_new_path)) != 0) {
+        error = storage_host_errno_to_error(errno);
+    }
+
+    furi_string_free(host_new_path);
+    furi_string_free(host_old_path);
+
+    return error;
+}
+
+FS_Error storage_common_copy(Storage* storage, const char* old_path, const char* new_path) {
+    furi_check(storage);
+
+    File* source = storage_file_alloc(storage);
+    File* destination = storage_file_alloc(storage);
+    FS_Error error = FSE_OK;
+
+    do {
+        if(!storage_file_open(source, old_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            error = source->error_id;
+            break;
+        }
+        if(!storage_file_open(destination, new_path, FSAM_WRITE, FSOM_CREATE_NEW)) {
+            error = destination->error_id;
+            break;
+        }
+        if(!storage_file_copy_to_file(source, destination, storage_file_size(source))) {
+            error = FSE_INTERNAL;
+        }
+    } while(false);
+
+    storage_file_free(destination);
+    storage_file_free(source);
+
+    return error;
+}
+
+FS_Error storage_common_mkdir(Storage* storage, const char* path) {
+    furi_check(storage);
+
+    FuriString* host_path = furi_string_alloc();
+    storage_host_resolve(storage, path, host_path);
+
+    FS_Error error = FSE_OK;
+    if(mkdir(furi_string_get_cstr(host_path), 0755) != 0) {
+        error = storage_host_errno_to_error(errno);
+    }
+
+    furi_string_free(host_path);
+
+    return error;
+}
+
+bool storage_common_exists(Storage* storage, const char* path) {
+    return storage_common_stat(storage, path, NULL) == FSE_OK;
+}
+
+/****************** Error Functions *******************/
+
+const char* storage_error_get_desc(FS_Error error_id) {
+    return filesystem_api_error_get_desc(error_id);
+}
+
+FS_Error storage_file_get_error(File* file) {
+    furi_check(file);
+    return file->error_id;
+}
+
+int32_t storage_file_get_internal_error(File* file) {
+    furi_check(file);
+    return file->internal_error_id;
+}
+
+const char* storage_file_get_error_desc(File* file) {
+    furi_check(file);
+    return filesystem_api_error_get_desc(file->error_id);
+}
+
+/***************** Simplified Functions ******************/
+
+bool storage_simply_remove(Storage* storage, const char* path) {
+    FS_Error result = storage_common_remove(storage, path);
+    return result == FSE_OK || result == FSE_NOT_EXIST;
+}
+
+bool storage_simply_remove_recursive(Storage* storage, const char* path) {
+    furi_check(storage);
+
+    File* dir = storage_file_alloc(storage);
+    FuriString* child = furi_string_alloc();
+    char name[256];
+    FileInfo fileinfo;
+
+    if(storage_dir_open(dir, path)) {
+        while(storage_dir_read(dir, &fileinfo, name, sizeof(name))) {
+            furi_string_printf(child, "%s/%s", path, name);
+            if(file_info_is_dir(&fileinfo)) {
+                storage_simply_remove_recursive(storage, furi_string_get_cstr(child));
+            } else {
+                storage_simply_remove(storage, furi_string_get_cstr(child));
+            }
+        }
+    }
+    storage_dir_close(dir);
+
+    furi_string_free(child);
+    storage_file_free(dir);
+
+    return storage_simply_remove(storage, path);
+}
+
+bool storage_simply_mkdir(Storage* storage, const char* path) {
+    FS_Error result = storage_common_mkdir(storage, path);
+    return result == FSE_OK || result == FSE_EXIST;
+}
+
+void storage_get_next_filename(
+    Storage* storage,
+    const char* dirname,
+    const char* filename,
+    const char* fileextension,
+    FuriString* nextfilename,
+    uint8_t max_len) {
+    FuriString* temp_str = furi_string_alloc();
+    uint16_t num = 0;
+
+    furi_string_printf(temp_str, "%s/%s%s", dirname, filename, fileextension);
+
+    while(storage_common_exists(storage, furi_string_get_cstr(temp_str))) {
+        num++;
+        furi_string_printf(temp_str, "%s/%s%d%s", dirname, filename, num, fileextension);
+    }
+
+    if(num && (max_len > strlen(filename))) {
+        furi_string_printf(nextfilename, "%s%d", filename, num);
+    } else {
+        furi_string_printf(nextfilename, "%s", filename);
+    }
+
+    furi_string_free(temp_str);
+}
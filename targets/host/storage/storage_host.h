@@ -0,0 +1,28 @@
+/**
+ * @file storage_host.h
+ * Host storage backed by a directory
+ *
+ * Flipper paths are mapped into root directory: `/ext/foo` is `<root>/ext/foo`,
+ * `/int/foo` is `<root>/int/foo`. `/any` is an alias for `/ext`, `/data` and
+ * `/assets` point to `/ext/apps_data/host` and `/ext/apps_assets/host`.
+ */
+#pragma once
+
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Initialize host storage and register RECORD_STORAGE
+ *
+ * @param      root  host directory that holds `ext` and `int` storages
+ */
+void storage_host_init(const char* root);
+
+/** Unregister RECORD_STORAGE and release host storage */
+void storage_host_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif